@@ -16,26 +16,53 @@ $(SONG_BUILDDIR)/%.o: $(SONG_SUBDIR)/%.s
 $(MID_BUILDDIR)/%.o: $(MID_ASM_DIR)/%.s
 	$(AS) $(ASFLAGS) -I sound -o $@ $<
 
+# Rather than starting a process per file, aif2pcm and mid2agb convert
+# every source that changed since their last batch in one go, across all
+# cores. They only write outputs whose contents change, which keeps the
+# assembly that includes them from being rebuilt, so the per-file rules
+# only have to convert files which have gone missing since the batch.
+AIF_SRCS := $(wildcard $(SOUND_BIN_DIR)/direct_sound_samples/*.aif $(SOUND_BIN_DIR)/direct_sound_samples/phonemes/*.aif $(CRY_SUBDIR)/*.aif)
+AIF_BATCH_STAMP := $(SOUND_BIN_DIR)/.aif2pcm.stamp
+
+# Cries are compressed unless they start with uncomp_.
+$(AIF_BATCH_STAMP): $(AIF_SRCS)
+	printf '%s\n' $(filter %.aif,$?) \
+	| sed -E -e 's/^(.*)\.aif$$/\1.aif \1.bin/' -e '\#^$(CRY_SUBDIR)/#{\#^$(CRY_SUBDIR)/uncomp_#!s/$$/ --compress/}' \
+	| $(AIF) --batch -
+	touch $@
+
+# An output depends on the batch's stamp rather than on its .aif, so that
+# one which the batch left alone doesn't run a recipe on every build.
+# The .aif is order-only so that these rules only match outputs which
+# have one.
+
 # Compressed cries
-$(CRY_BIN_DIR)/%.bin: $(CRY_SUBDIR)/%.aif 
-	$(AIF) $< $@ --compress
+$(CRY_BIN_DIR)/%.bin: $(AIF_BATCH_STAMP) | $(CRY_SUBDIR)/%.aif
+	$(if $(wildcard $@),,$(AIF) $(CRY_SUBDIR)/$*.aif $@ --compress)
 
 # Uncompressed cries
-$(CRY_BIN_DIR)/uncomp_%.bin: $(CRY_SUBDIR)/uncomp_%.aif 
-	$(AIF) $< $@
+$(CRY_BIN_DIR)/uncomp_%.bin: $(AIF_BATCH_STAMP) | $(CRY_SUBDIR)/uncomp_%.aif
+	$(if $(wildcard $@),,$(AIF) $(CRY_SUBDIR)/uncomp_$*.aif $@)
 
 # Uncompressed sounds
-$(SOUND_BIN_DIR)/%.bin: sound/%.aif 
-	$(AIF) $< $@
+$(SOUND_BIN_DIR)/%.bin: $(AIF_BATCH_STAMP) | sound/%.aif
+	$(if $(wildcard $@),,$(AIF) sound/$*.aif $@)
 
 # For each line in midi.cfg, we do some trickery to convert it into a make rule for the `.mid` file described on the line
 # Data following the colon in said file corresponds to arguments passed into mid2agb
 MID_CFG_PATH := $(MID_SUBDIR)/midi.cfg
 
+MID_BATCH_STAMP := $(MID_ASM_DIR)/.mid2agb.stamp
+
+# Everything is converted again when midi.cfg changes.
+$(MID_BATCH_STAMP): $(MID_SRCS) $(MID_CFG_PATH)
+	$(MID) --batch $(MID_CFG_PATH) $(if $(filter $(MID_CFG_PATH),$?),,$(filter %.mid,$?))
+	touch $@
+
 # $1: Source path no extension, $2 Options
 define MID_RULE
-$(MID_ASM_DIR)/$1.s: $(MID_SUBDIR)/$1.mid $(MID_CFG_PATH)
-	$(MID) $$< $$@ $2
+$(MID_ASM_DIR)/$1.s: $(MID_BATCH_STAMP) | $(MID_SUBDIR)/$1.mid
+	$$(if $$(wildcard $$@),,$(MID) $(MID_SUBDIR)/$1.mid $$@ $2)
 endef
 #                            source path,                             remaining text (options)
 define MID_EXPANSION
@@ -367,6 +367,42 @@ struct AiLogicData
     u8 battlerDoingPrediction; // Stores which battler is currently running its prediction calcs
 };
 
+// What AI what-if evaluation changes about one battler: its BattlePokemon,
+// the AI's cached data for it, and optionally one attacker's move data
+// against it. The side, field and weather statuses are small enough to be
+// saved whole.
+struct AiBattleState
+{
+    struct BattlePokemon battleMon;
+    u32 sideStatuses[NUM_BATTLE_SIDES];
+    u32 statuses3[MAX_BATTLERS_COUNT];
+    u32 fieldStatuses;
+    u16 battleWeather;
+    u16 ability;
+    u16 item;
+    u16 holdEffect;
+    u16 lastUsedMove;
+    u16 speedStat;
+    u8 holdEffectParam;
+    u8 hpPercent;
+    u8 moveLimitations;
+    u8 battler;
+    u8 movesAttacker; // MAX_BATTLERS_COUNT if the move data isn't saved
+    struct SimulatedDamage simulatedDmg[MAX_MON_MOVES];
+    uq4_12_t effectiveness[MAX_MON_MOVES];
+    u8 moveAccuracy[MAX_MON_MOVES];
+};
+
+// Predicted switch-in, lookahead and party mon damage calcs can nest.
+#define AI_BATTLE_STATE_STACK_SIZE 6
+#define AI_BATTLE_STATE_NONE 0xFF
+
+struct AiBattleStateStack
+{
+    struct AiBattleState states[AI_BATTLE_STATE_STACK_SIZE];
+    u8 size;
+};
+
 struct AI_ThinkingStruct
 {
     u8 aiState;
@@ -421,6 +457,7 @@ struct BattleResources
     struct AiLogicData *aiData;
     struct AIPartyData *aiParty;
     struct BattleHistory *battleHistory;
+    struct AiBattleStateStack *aiStateStack;
     u8 bufferA[MAX_BATTLERS_COUNT][0x200];
     u8 bufferB[MAX_BATTLERS_COUNT][0x200];
     u8 transferBuffer[0x100];
@@ -766,6 +803,7 @@ struct BattleStruct
     s32 aiFinalScore[MAX_BATTLERS_COUNT][MAX_BATTLERS_COUNT][MAX_MON_MOVES]; // AI, target, moves to make debugging easier
     u8 aiMoveOrAction[MAX_BATTLERS_COUNT];
     u8 aiChosenTarget[MAX_BATTLERS_COUNT];
+    u8 actionSelectionResumeBattler; // Battler to carry on choosing actions from, after the AI has spent several frames choosing.
     u8 soulheartBattlerId;
     u8 friskedBattler; // Frisk needs to identify 2 battlers in double battles.
     u8 sameMoveTurns[MAX_BATTLERS_COUNT]; // For Metronome, number of times the same moves has been SUCCESFULLY used.
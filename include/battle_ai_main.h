@@ -111,6 +111,8 @@ void BattleAI_SetupItems(void);
 void BattleAI_SetupFlags(void);
 void BattleAI_SetupAIData(u8 defaultScoreMoves, u32 battler);
 u32 BattleAI_ChooseMoveOrAction(u32 battler);
+void BattleAI_ChooseMoveOrActionInTask(u32 battler);
+bool32 BattleAI_IsChoosingMoveOrAction(void);
 void Ai_InitPartyStruct(void);
 void Ai_UpdateSwitchInData(u32 battler);
 void Ai_UpdateFaintData(u32 battler);
@@ -193,8 +193,9 @@ bool32 PartnerMoveActivatesSleepClause(u32 move);
 bool32 ShouldUseWishAromatherapy(u32 battlerAtk, u32 battlerDef, u32 move);
 
 // party logic
-struct BattlePokemon *AllocSaveBattleMons(void);
-void FreeRestoreBattleMons(struct BattlePokemon *savedBattleMons);
+u32 AI_PushBattleState(u32 battler, u32 movesAttacker);
+void AI_RestoreBattleState(u32 stateId);
+bool32 AI_PopBattleState(void);
 s32 CountUsablePartyMons(u32 battlerId);
 bool32 IsPartyFullyHealedExceptBattler(u32 battler);
 bool32 PartyHasMoveCategory(u32 battlerId, u32 category);
@@ -44,6 +44,24 @@ struct BattleAnimBackground
 
 #define ANIM_ARGS_COUNT 8
 
+#define ANIM_GFX_CACHE_ENTRIES 16
+
+struct BattleAnimGfxCacheEntry
+{
+    u8 *gfx; // Decompressed tiles followed by the decompressed palette
+    u16 index;
+    u16 tilesSize;
+    u16 size;
+    u32 lastUsed;
+};
+
+struct BattleAnimGfxCache
+{
+    struct BattleAnimGfxCacheEntry entries[ANIM_GFX_CACHE_ENTRIES];
+    u32 usedBytes;
+    u32 clock;
+};
+
 extern void (*gAnimScriptCallback)(void);
 extern bool8 gAnimScriptActive;
 extern u8 gAnimVisualTaskCount;
@@ -62,6 +80,10 @@ extern u8 gAnimCustomPanning;
 extern u16 gAnimMoveIndex;
 
 void ClearBattleAnimationVars(void);
+void AllocBattleAnimGfxCache(void);
+void FreeBattleAnimGfxCache(void);
+struct BattleAnimGfxCacheEntry *GetBattleAnimGfxCacheEntry(u32 index);
+bool32 IsBattleAnimGfxCached(u32 index);
 void DoMoveAnim(u16 move);
 void LaunchBattleAnimation(u32 animType, u32 animId);
 void DestroyAnimSprite(struct Sprite *sprite);
@@ -50,4 +50,7 @@
 // AI prediction chances
 #define PREDICT_SWITCH_CHANCE                                   50
 
+// AI performance
+#define AI_CYCLES_PER_FRAME                                     100000 // The AI stops choosing a move after using this many CPU cycles in a frame, and carries on in the next frame. A frame is about 280000 cycles. Set to 0 to always choose in one go.
+
 #endif // GUARD_CONFIG_AI_H
@@ -87,4 +87,7 @@
 #define AUTO_LOWERCASE_KEYBOARD      GEN_LATEST  // Starting in GEN_6, after entering the first uppercase character, the keyboard switches to lowercase letters.
 
 #define SAVE_TYPE_ERROR_SCREEN              FALSE   // When enabled, this shows an error message when the game is loaded on a cart without a flash chip or on an emulator with the wrong save type setting instead of crashing.
+
+// Sprites
+#define SPRITE_TILE_COMPACTION              FALSE   // If TRUE, a sprite sheet which doesn't fit in any free span of OBJ VRAM moves the loaded sheets down with CompactSpriteTiles and tries again. Sprites which cache their own tile numbers may show the wrong tiles afterwards.
 #endif // GUARD_CONFIG_GENERAL_H
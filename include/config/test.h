@@ -1136,5 +1136,7 @@
 // Flags
 #undef B_FLAG_SLEEP_CLAUSE
 #define B_FLAG_SLEEP_CLAUSE              TESTING_FLAG_SLEEP_CLAUSE
+#undef B_FLAG_AI_VS_AI_BATTLE
+#define B_FLAG_AI_VS_AI_BATTLE           TESTING_FLAG_AI_VS_AI_BATTLE
 
 #endif // GUARD_CONFIG_TEST_H
@@ -327,7 +327,7 @@
 #if TESTING
 #define TESTING_VARS_START             0x9000
 #define TESTING_VAR_DIFFICULTY         (TESTING_VARS_START + 0x0)
-#define TESTING_VAR_UNUSED_1           (TESTING_VARS_START + 0x1)
+#define TESTING_VAR_AI_CYCLES_PER_FRAME (TESTING_VARS_START + 0x1)
 #define TESTING_VAR_UNUSED_2           (TESTING_VARS_START + 0x2)
 #define TESTING_VAR_UNUSED_3           (TESTING_VARS_START + 0x3)
 #define TESTING_VAR_UNUSED_4           (TESTING_VARS_START + 0x4)
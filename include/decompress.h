@@ -5,8 +5,25 @@
 
 #define MAX_DECOMPRESSION_BUFFER_SIZE 0x4000
 
-void LZDecompressWram(const u32 *src, void *dest);
-void LZDecompressVram(const u32 *src, void *dest);
+// State for decompressing LZ77 data a bounded number of bytes at a time.
+struct LZ77Stream
+{
+    const u8 *src;
+    u8 *dest;
+    u32 remaining;
+    u16 displacement;
+    u8 flags;
+    u8 flagBitsLeft;
+    u8 copyLeft; // Bytes of the current back-reference still to copy.
+};
+
+IWRAM_CODE void LZDecompressWram(const u32 *src, void *dest);
+IWRAM_CODE void LZDecompressVram(const u32 *src, void *dest);
+IWRAM_CODE void RLDecompressWram(const void *src, void *dest);
+IWRAM_CODE void RLDecompressVram(const void *src, void *dest);
+
+void LZ77Stream_Init(struct LZ77Stream *stream, const u32 *src, void *dest);
+IWRAM_CODE bool32 LZ77Stream_Decompress(struct LZ77Stream *stream, u32 budget);
 
 u32 IsLZ77Data(const void *ptr, u32 minSize, u32 maxSize);
 
@@ -20,6 +37,9 @@ u32 LoadCompressedSpritePaletteWithTag(const u32 *pal, u16 tag);
 void LoadCompressedSpritePaletteOverrideBuffer(const struct CompressedSpritePalette *src, void *buffer);
 bool8 LoadCompressedSpritePaletteUsingHeap(const struct CompressedSpritePalette *src);
 
+u32 AcquireCompressedSpritePalette(const struct CompressedSpritePalette *src, bool32 shared);
+u16 AcquireCompressedSpriteSheet(const struct CompressedSpriteSheet *src);
+
 void DecompressPicFromTable(const struct CompressedSpriteSheet *src, void *buffer);
 
 void HandleLoadSpecialPokePic(bool32 isFrontPic, void *dest, s32 species, u32 personality);
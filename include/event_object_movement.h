@@ -107,6 +107,26 @@ struct LockedAnimObjectEvents
     u8 count;
 };
 
+#define OBJ_EVENT_COORD_BUCKET_BITS 3
+#define OBJ_EVENT_COORD_BUCKET_MASK ((1 << OBJ_EVENT_COORD_BUCKET_BITS) - 1)
+#define OBJ_EVENT_COORD_BUCKETS     (1 << (OBJ_EVENT_COORD_BUCKET_BITS * 2))
+#define OBJ_EVENT_COORD_BUCKET(x, y) ((((y) & OBJ_EVENT_COORD_BUCKET_MASK) << OBJ_EVENT_COORD_BUCKET_BITS) | ((x) & OBJ_EVENT_COORD_BUCKET_MASK))
+#define OBJ_EVENT_LOCAL_ID_BUCKETS  16
+#define OBJ_EVENT_LOCAL_ID_BUCKET(localId) ((localId) & (OBJ_EVENT_LOCAL_ID_BUCKETS - 1))
+
+// Bitmasks of object event ids, bucketed by tile and by localId.
+struct ObjectEventSpatialIndex
+{
+    u32 coordBuckets[OBJ_EVENT_COORD_BUCKETS];
+    u32 localIdBuckets[OBJ_EVENT_LOCAL_ID_BUCKETS];
+    u32 indexed;
+    u8 currentBucket[OBJECT_EVENTS_COUNT];
+    u8 previousBucket[OBJECT_EVENTS_COUNT];
+    u8 localIdBucket[OBJECT_EVENTS_COUNT];
+};
+
+STATIC_ASSERT(OBJECT_EVENTS_COUNT <= 32, ObjectEventSpatialIndexMaskTooSmall);
+
 extern const struct OamData gObjectEventBaseOam_32x8;
 extern const struct OamData gObjectEventBaseOam_32x32;
 extern const struct OamData gObjectEventBaseOam_64x64;
@@ -125,6 +145,8 @@ u8 GetMoveDirectionAnimNum(u8 direction);
 u8 GetObjectEventIdByLocalIdAndMap(u8 localId, u8 mapNum, u8 mapGroupId);
 bool8 TryGetObjectEventIdByLocalIdAndMap(u8 localId, u8 mapNum, u8 mapGroupId, u8 *objectEventId);
 u8 GetObjectEventIdByXY(s16 x, s16 y);
+void UpdateObjectEventSpatialIndex(struct ObjectEvent *objectEvent);
+void RebuildObjectEventSpatialIndex(void);
 void SetObjectEventDirection(struct ObjectEvent *objectEvent, u8 direction);
 u8 GetFirstInactiveObjectEventId(void);
 u8 GetObjectEventIdByLocalId(u8);
@@ -220,6 +242,7 @@ void OverrideTemplateCoordsForObjectEvent(const struct ObjectEvent *objectEvent)
 void ShiftStillObjectEventCoords(struct ObjectEvent *objEvent);
 void ObjectEventMoveDestCoords(struct ObjectEvent *objEvent, u32 direction, s16 *x, s16 *y);
 u8 AddCameraObject(u8 linkedSpriteId);
+void UpdateObjectEventCoordsForCameraUpdate(void);
 void UpdateObjectEventsForCameraUpdate(s16 x, s16 y);
 u8 GetWalkSlowMovementAction(u32);
 u8 GetWalkSlowStairsMovementAction(u32);
@@ -47,6 +47,9 @@ void CopyMapTilesetsToVram(struct MapLayout const *mapLayout);
 void LoadMapTilesetPalettes(struct MapLayout const *mapLayout);
 void LoadSecondaryTilesetPalette(struct MapLayout const *mapLayout);
 void CopySecondaryTilesetToVramUsingHeap(struct MapLayout const *mapLayout);
+void CopySecondaryTilesetToVramStreamed(struct MapLayout const *mapLayout);
+void UpdateConnectionTilesetStream(void);
+void CancelConnectionTilesetStream(void);
 void CopyPrimaryTilesetToVram(const struct MapLayout *);
 void CopySecondaryTilesetToVram(const struct MapLayout *);
 const struct MapHeader *const GetMapHeaderFromConnection(const struct MapConnection *connection);
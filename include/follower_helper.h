@@ -114,7 +114,13 @@ enum {
     COND_MSG_COUNT,
 };
 
+// The number of words in a bitset with one bit per conditional message.
+#define COND_MSG_WORDS ((COND_MSG_COUNT + 31) / 32)
+
 extern const struct FollowerMsgInfoExtended gFollowerConditionalMessages[COND_MSG_COUNT];
 extern const struct FollowerMessagePool gFollowerBasicMessages[FOLLOWER_EMOTION_LENGTH];
 
+bool32 CheckMsgInfo(const struct FollowerMsgInfoExtended *info, struct Pokemon *mon, u32 species, struct ObjectEvent *obj);
+void GetFollowerMsgCandidates(u32 species, u32 *candidates);
+
 #endif //GUARD_FOLLOWER_HELPER_H
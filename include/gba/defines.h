@@ -14,8 +14,20 @@
 #define UNUSED __attribute__((unused))
 #define USED __attribute__((used))
 
+#if NATIVE
+// 'make check-native' compiles some tests for the host, which has
+// neither ARM mode nor IWRAM.
+#define ARM_FUNC
+#define IWRAM_CODE __attribute__((noinline))
+#else
 #define ARM_FUNC __attribute__((target("arm")))
 
+// ARM code which crt0 copies to IWRAM, where it runs about twice as fast
+// as Thumb code in ROM. IWRAM is out of range of BL, so the declaration
+// that callers see must also use IWRAM_CODE.
+#define IWRAM_CODE __attribute__((section(".iwram.code"), target("arm"), long_call, noinline))
+#endif
+
 #if MODERN
 #define NOINLINE __attribute__((noinline))
 #else
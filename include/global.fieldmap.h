@@ -125,6 +125,10 @@ struct MapEvents
     const struct WarpEvent *warps;
     const struct CoordEvent *coordEvents;
     const struct BgEvent *bgEvents;
+    // The ids of the events above sorted by position, or NULL to search them in order
+    const u8 *warpIndex;
+    const u8 *coordEventIndex;
+    const u8 *bgEventIndex;
 };
 
 struct MapConnection
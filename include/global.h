@@ -145,6 +145,12 @@ static inline void CycleCountStart()
     REG_TM2CNT_H = TIMER_1CLK | TIMER_ENABLE;
 }
 
+// Reads the cycle count without stopping the timers
+static inline u32 CycleCountRead()
+{
+    return REG_TM2CNT_L | (REG_TM3CNT_L << 16u);
+}
+
 static inline u32 CycleCountEnd()
 {
     // stop timers
@@ -9,6 +9,42 @@ enum {
     BRIDGE_TYPE_POND_HIGH,
 };
 
+// Properties returned by MetatileBehavior_GetProperties
+#define MB_PROP_HAS_ENCOUNTERS         (1 << 0)
+#define MB_PROP_SURFABLE               (1 << 1)
+#define MB_PROP_TALL_GRASS             (1 << 2)
+#define MB_PROP_LONG_GRASS             (1 << 3)
+#define MB_PROP_SHORT_GRASS            (1 << 4)
+#define MB_PROP_SAND                   (1 << 5) // Sand or deep sand
+#define MB_PROP_DEEP_SAND              (1 << 6)
+#define MB_PROP_FOOTPRINTS             (1 << 7)
+#define MB_PROP_ICE                    (1 << 8)
+#define MB_PROP_REFLECTIVE             (1 << 9)
+#define MB_PROP_PUDDLE                 (1 << 10)
+#define MB_PROP_RIPPLES                (1 << 11)
+#define MB_PROP_SHALLOW_FLOWING_WATER  (1 << 12)
+#define MB_PROP_PACIFIDLOG_LOG         (1 << 13)
+#define MB_PROP_HOT_SPRINGS            (1 << 14)
+#define MB_PROP_SEAWEED                (1 << 15)
+#define MB_PROP_FISHABLE               (1 << 16) // Surfable water that can be fished in
+#define MB_PROP_FORCED_MOVEMENT        (1 << 17)
+#define MB_PROP_RUNNING_DISALLOWED     (1 << 18)
+#define MB_PROP_WARP                   (1 << 19) // Warps the player when there is a warp event on it
+#define MB_PROP_BRIDGE_OVER_WATER      (1 << 20)
+#define MB_PROP_SIDEWAYS_STAIRS_LEFT   (1 << 21) // Any part of the stairs
+#define MB_PROP_SIDEWAYS_STAIRS_RIGHT  (1 << 22) // Any part of the stairs
+#define MB_PROP_EAST_BLOCKED           (1 << 23)
+#define MB_PROP_WEST_BLOCKED           (1 << 24)
+#define MB_PROP_NORTH_BLOCKED          (1 << 25)
+#define MB_PROP_SOUTH_BLOCKED          (1 << 26)
+
+extern const u32 gMetatileBehaviorProperties[];
+
+static inline u32 MetatileBehavior_GetProperties(u32 metatileBehavior)
+{
+    return gMetatileBehaviorProperties[metatileBehavior];
+}
+
 bool8 MetatileBehavior_IsATile(u8);
 bool8 MetatileBehavior_IsEncounterTile(u8);
 bool8 MetatileBehavior_IsJumpEast(u8);
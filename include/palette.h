@@ -73,10 +73,12 @@ void BeginHardwarePaletteFade(u32 blendCnt, u32 delay, u32 y, u32 targetY, u32 s
 void BlendPalettes(u32 selectedPalettes, u8 coeff, u32 color);
 void BlendPalettesUnfaded(u32 selectedPalettes, u8 coeff, u32 color);
 void BlendPalettesGradually(u32 selectedPalettes, s8 delay, u8 coeff, u8 coeffTarget, u16 color, u8 priority, u8 id);
-void TintPalette_GrayScale(u16 *palette, u32 count);
+IWRAM_CODE void TintPalette_GrayScale(u16 *palette, u32 count);
 void TintPalette_GrayScale2(u16 *palette, u32 count);
-void TintPalette_SepiaTone(u16 *palette, u32 count);
+IWRAM_CODE void TintPalette_SepiaTone(u16 *palette, u32 count);
 void TintPalette_CustomTone(u16 *palette, u32 count, u16 rTone, u16 gTone, u16 bTone);
+IWRAM_CODE void BlendColors(const u16 *src, u16 *dst, u32 count, u32 coeff, u32 blendColor);
+IWRAM_CODE void ColorMapColors(const u16 *src, u16 *dst, u32 count, const u8 *colorMap);
 
 static inline void SetBackdropFromColor(u32 color)
 {
@@ -28,6 +28,20 @@ struct PokemonStorage
 
 extern struct PokemonStorage *gPokemonStoragePtr;
 
+// What the PC needs to know about the Pokémon in a box slot without
+// decrypting it. See GetBoxMonSummaryAt.
+struct BoxMonSummary
+{
+    u32 personality;
+    u16 species; // SPECIES_EGG for eggs.
+    u16 heldItem;
+    u8 level;
+    u8 form; // See GetFormIdFromFormSpeciesId.
+    u8 markings:4;
+    u8 isShiny:1;
+    u8 padding:3;
+};
+
 void DrawTextWindowAndBufferTiles(const u8 *string, void *dst, u8 zero1, u8 zero2, s32 bytesToBuffer);
 u8 CountMonsInBox(u8 boxId);
 s16 GetFirstFreeBoxSpot(u8 boxId);
@@ -39,6 +53,10 @@ void ShowPokemonStorageSystemPC(void);
 void ResetPokemonStorageSystem(void);
 s16 CompactPartySlots(void);
 u8 StorageGetCurrentBox(void);
+struct BoxMonSummary GetBoxMonSummaryAt(u8 boxId, u8 boxPosition);
+void ResetBoxMonSummaries(void);
+bool32 FindStorageMonWithSpecies(u16 species, u8 *boxId, u8 *boxPosition);
+bool32 FindStorageMonWithHeldItem(u16 itemId, u8 *boxId, u8 *boxPosition);
 u32 GetBoxMonDataAt(u8 boxId, u8 boxPosition, s32 request);
 void SetBoxMonDataAt(u8 boxId, u8 boxPosition, s32 request, const void *value);
 u32 GetCurrentBoxMonData(u8 boxPosition, s32 request);
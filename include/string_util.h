@@ -6,6 +6,8 @@ extern u8 gStringVar2[0x100];
 extern u8 gStringVar3[0x100];
 extern u8 gStringVar4[0x3E8];
 
+extern const u8 gCaseToggleTable[256];
+
 enum StringConvertMode
 {
     STR_CONV_MODE_LEFT_ALIGN,
@@ -0,0 +1,56 @@
+#ifndef GUARD_TEST_SIMULATOR_H
+#define GUARD_TEST_SIMULATOR_H
+
+#include "test/test.h"
+#include "constants/battle.h"
+
+// Battles which last longer than this are recorded as draws.
+#define SIMULATION_MAX_TURNS 200
+
+struct BattleSimulation
+{
+    u16 playerTrainer;
+    u16 opponentTrainer;
+    u16 games;
+};
+
+struct BattleSimulationTurn
+{
+    u16 moves[MAX_BATTLERS_COUNT];
+    u16 damage[MAX_BATTLERS_COUNT];
+    u8 faintedBattlers;
+};
+
+struct BattleSimulationRunnerState
+{
+    u16 game;
+    u16 turn;
+    struct BattleSimulationTurn current;
+    u16 checkProgressGame;
+    u8 checkProgressTurn;
+};
+
+extern const struct TestRunner gBattleSimulationRunner;
+extern struct BattleSimulationRunnerState gBattleSimulationRunnerState;
+
+/* Plays '_games' AI vs AI battles between two trainers from
+ * src/data/trainers.party, with the player's side controlled by the AI
+ * flags of '_player'. The games are split between all the processes
+ * that 'make simulate' spawns and each game is seeded with its index,
+ * so that a game can be replayed by itself. */
+#define BATTLE_SIMULATION(_name, _player, _opponent, _games) \
+    __attribute__((section(".tests"), used)) static const struct Test CAT(sTest, __LINE__) = \
+    { \
+        .name = _name, \
+        .filename = __FILE__, \
+        .runner = &gBattleSimulationRunner, \
+        .sourceLine = __LINE__, \
+        .data = (void *)&(const struct BattleSimulation) \
+        { \
+            .playerTrainer = _player, \
+            .opponentTrainer = _opponent, \
+            .games = _games, \
+        }, \
+    }
+
+#endif // GUARD_TEST_SIMULATOR_H
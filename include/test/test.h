@@ -25,6 +25,9 @@ struct TestRunner
     void (*tearDown)(void *);
     bool32 (*checkProgress)(void *);
     bool32 (*handleExitWithResult)(void *, enum TestResult);
+    // Run on every process instead of just one, the runner is
+    // responsible for splitting the work using gTestRunnerN/I.
+    bool8 runOnAllProcesses;
 };
 
 struct Test
@@ -51,6 +54,11 @@ struct TestRunnerState
     bool8 inBenchmark:1;
     bool8 tearDown:1;
     u32 timeoutSeconds;
+
+    // Reported to Hydra with the result.
+    u32 startVblankCounter;
+    u16 parameters;
+    u16 trials;
 };
 
 extern const u8 gTestRunnerN;
@@ -81,9 +89,18 @@ u32 SourceLineOffset(u32 sourceLine);
 
 s32 Test_MgbaPrintf(const char *fmt, ...);
 
+#if NATIVE
+// Host linkers only define __start_/__stop_ symbols for sections named
+// like C identifiers. GCC also over-aligns large static data on x86,
+// which would leave gaps between the tests.
+#define TEST_SECTION section("tests"), aligned(__alignof__(struct Test))
+#else
+#define TEST_SECTION section(".tests")
+#endif
+
 #define TEST(_name) \
     static void CAT(Test, __LINE__)(void); \
-    __attribute__((section(".tests"), used)) static const struct Test CAT(sTest, __LINE__) = \
+    __attribute__((TEST_SECTION, used)) static const struct Test CAT(sTest, __LINE__) = \
     { \
         .name = _name, \
         .filename = __FILE__, \
@@ -95,7 +112,7 @@ s32 Test_MgbaPrintf(const char *fmt, ...);
 
 #define ASSUMPTIONS \
     static void Assumptions(void); \
-    __attribute__((section(".tests"), used, no_reorder)) static const struct Test sAssumptions = \
+    __attribute__((TEST_SECTION, used, no_reorder)) static const struct Test sAssumptions = \
     { \
         .name = "ASSUMPTIONS: " __FILE__, \
         .filename = __FILE__, \
@@ -169,21 +186,43 @@ s32 Test_MgbaPrintf(const char *fmt, ...);
 
 struct Benchmark { s32 ticks; };
 
+// The ticks of a benchmark which took longer than TM3 can count.
+#define BENCHMARK_OVERFLOW -1
+
+#if NATIVE
+// Host timings say nothing about the GBA, so 'make check-native' skips
+// the tests with benchmarks.
+static inline void BenchmarkStart(void)
+{
+    Test_ExitWithResult(TEST_RESULT_ASSUMPTION_FAIL, SourceLine(0), ":L%s:%d: BENCHMARK needs a GBA", gTestRunnerState.test->filename, SourceLine(0));
+}
+
+static inline struct Benchmark BenchmarkStop(void)
+{
+    return (struct Benchmark) { 0 };
+}
+#else
 static inline void BenchmarkStart(void)
 {
     gTestRunnerState.inBenchmark = TRUE;
     // Wait for a v-blank so that comparing two benchmarks is not affected
     // by the v-count (different numbers of IRQs may run).
     VBlankIntrWait();
-    REG_TM3CNT = (TIMER_ENABLE | TIMER_64CLK) << 16;
+    // TM3's interrupt isn't enabled in REG_IE, so its flag in REG_IF stays
+    // set if it overflows.
+    REG_IF = INTR_FLAG_TIMER3;
+    REG_TM3CNT = (TIMER_ENABLE | TIMER_INTR_ENABLE | TIMER_64CLK) << 16;
 }
 
 static inline struct Benchmark BenchmarkStop(void)
 {
     REG_TM3CNT_H = 0;
     gTestRunnerState.inBenchmark = FALSE;
+    if (REG_IF & INTR_FLAG_TIMER3)
+        return (struct Benchmark) { BENCHMARK_OVERFLOW };
     return (struct Benchmark) { REG_TM3CNT_L };
 }
+#endif
 
 #define BENCHMARK(id) \
     for (BenchmarkStart(); gTestRunnerState.inBenchmark; *(id) = BenchmarkStop())
@@ -195,10 +234,18 @@ static inline struct Benchmark BenchmarkStop(void)
 // us to be confident that it's faster than another.
 #define BENCHMARK_REL 95
 
+#define EXPECT_NO_BENCHMARK_OVERFLOW(a) \
+    do \
+    { \
+        if ((a).ticks == BENCHMARK_OVERFLOW) \
+            Test_ExitWithResult(TEST_RESULT_ERROR, __LINE__, ":L%s:%d: " #a " overflowed", gTestRunnerState.test->filename, __LINE__); \
+    } while (0)
+
 #define EXPECT_FASTER(a, b) \
     do \
     { \
         u32 a_ = (a).ticks; u32 b_ = (b).ticks; \
+        EXPECT_NO_BENCHMARK_OVERFLOW(a); EXPECT_NO_BENCHMARK_OVERFLOW(b); \
         Test_MgbaPrintf(#a ": %d ticks, " #b ": %d ticks", a_, b_); \
         if (((a_ - BENCHMARK_ABS) * BENCHMARK_REL) >= (b_ * 100)) \
             Test_ExitWithResult(TEST_RESULT_FAIL, __LINE__, ":L%s:%d: EXPECT_FASTER(" #a ", " #b ") failed", gTestRunnerState.test->filename, __LINE__); \
@@ -208,11 +255,26 @@ static inline struct Benchmark BenchmarkStop(void)
     do \
     { \
         u32 a_ = (a).ticks; u32 b_ = (b).ticks; \
+        EXPECT_NO_BENCHMARK_OVERFLOW(a); EXPECT_NO_BENCHMARK_OVERFLOW(b); \
         Test_MgbaPrintf(#a ": %d ticks, " #b ": %d ticks", a_, b_); \
         if ((a_ * 100) <= ((b_ - BENCHMARK_ABS) * BENCHMARK_REL)) \
             Test_ExitWithResult(TEST_RESULT_FAIL, __LINE__, ":L%s:%d: EXPECT_SLOWER(" #a ", " #b ") failed", gTestRunnerState.test->filename, __LINE__); \
     } while (0)
 
+// Benchmarks count in ticks of TIMER_64CLK, so they overflow after
+// about 4M cycles (roughly 15 frames). Timer 2 can't be cascaded into
+// timer 3 to count further because it is the test runner's watchdog.
+#define BENCHMARK_CYCLES_PER_TICK 64
+
+// Reports a benchmark's cycles to Hydra, which 'make bench' compares
+// against the current test's baseline in test/bench/baselines.tsv.
+#define REPORT_BENCHMARK(a) \
+    do \
+    { \
+        EXPECT_NO_BENCHMARK_OVERFLOW(a); \
+        Test_MgbaPrintf(":E%d", (a).ticks * BENCHMARK_CYCLES_PER_TICK); \
+    } while (0)
+
 #define KNOWN_FAILING \
     Test_ExpectedResult(TEST_RESULT_FAIL)
 
@@ -4,6 +4,7 @@
 extern const bool8 gTestRunnerEnabled;
 extern const bool8 gTestRunnerHeadless;
 extern const bool8 gTestRunnerSkipIsFail;
+extern const bool8 gTestRunnerProfileScripts;
 
 #if TESTING
 
@@ -21,6 +22,7 @@ void TestRunner_Battle_AISetScore(const char *file, u32 line, u32 battlerId, u32
 void TestRunner_Battle_AIAdjustScore(const char *file, u32 line, u32 battlerId, u32 moveIndex, s32 score);
 void TestRunner_Battle_InvalidNoHPMon(u32 battlerId, u32 partyIndex);
 void TestRunner_CheckMemory(void);
+void TestRunner_RecordScriptCommand(const void *cmdTable, const u8 *scriptPtr);
 
 void TestRunner_Battle_CheckBattleRecordActionType(u32 battlerId, u32 recordIndex, u32 actionType);
 
@@ -42,6 +44,7 @@ u32 TestRunner_Battle_GetChosenGimmick(u32 side, u32 partyIndex);
 #define TestRunner_Battle_AISetScore(...) (void)0
 #define TestRunner_Battle_AIAdjustScore(...) (void)0
 #define TestRunner_Battle_InvalidNoHPMon(...) (void)0
+#define TestRunner_RecordScriptCommand(...) (void)0
 
 #define TestRunner_Battle_CheckBattleRecordActionType(...) (void)0
 
@@ -4,6 +4,4 @@
 void EnterUnionRoomChat(void);
 void InitUnionRoomChatRegisteredTexts(void);
 
-extern const u8 gCaseToggleTable[256];
-
 #endif // GUARD_UNION_ROOM_CHAT_H
@@ -16,6 +16,29 @@ struct WildPokemonInfo
     const struct WildPokemon *wildPokemon;
 };
 
+enum {
+    WILD_AREA_LAND,
+    WILD_AREA_WATER,
+    WILD_AREA_ROCKS,
+    WILD_AREA_FISHING,
+    WILD_AREA_HIDDEN,
+};
+
+// The levels a species can be encountered at in one area of a wild mon header.
+struct WildSpeciesEncounter
+{
+    u16 headerId;
+    u8 area;
+    u8 minLevel;
+    u8 maxLevel;
+};
+
+struct WildSpeciesEncounterList
+{
+    u16 first;
+    u16 count;
+};
+
 struct WildPokemonHeader
 {
     u8 mapGroup;
@@ -50,5 +73,7 @@ u8 ChooseWildMonIndex_Land(void);
 u8 ChooseWildMonIndex_WaterRock(void);
 u8 ChooseHiddenMonIndex(void);
 bool32 MapHasNoEncounterData(void);
+bool32 WildMonHeaderHasSpecies(u32 headerId, u32 species);
+const struct WildSpeciesEncounter *GetWildSpeciesEncounter(u32 headerId, u32 area, u32 species);
 
 #endif // GUARD_WILD_ENCOUNTER_H
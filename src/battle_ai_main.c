@@ -19,6 +19,7 @@
 #include "recorded_battle.h"
 #include "util.h"
 #include "script.h"
+#include "task.h"
 #include "constants/abilities.h"
 #include "constants/battle_ai.h"
 #include "constants/battle_move_effects.h"
@@ -32,8 +33,33 @@
 #define AI_ACTION_WATCH         (1 << 2)
 #define AI_ACTION_DO_NOT_ATTACK (1 << 3)
 
-static u32 ChooseMoveOrAction_Singles(u32 battlerAi);
-static u32 ChooseMoveOrAction_Doubles(u32 battlerAi);
+enum {
+    AI_CHOOSE_NEXT_TARGET, // Doubles only
+    AI_CHOOSE_SCORE_MOVES,
+    AI_CHOOSE_FINISH,
+    AI_CHOOSE_DONE,
+};
+
+// The AI's choice of move or action, as a job that can be spread over
+// several frames. See BattleAI_ChooseMoveOrActionInTask.
+struct AiChooseJob
+{
+    u8 battler;
+    u8 target; // Doubles only, the battler that moves are being scored against.
+    u8 battlerTarget; // gBattlerTarget while the job isn't running.
+    u8 state;
+    u8 choice;
+    bool8 isDouble;
+    u32 flags; // AI flags left to run against the current target.
+    s32 bestMovePointsForTarget[MAX_BATTLERS_COUNT];
+    u8 actionOrMoveIndex[MAX_BATTLERS_COUNT];
+    rng_value_t rng;
+};
+
+static EWRAM_DATA struct AiChooseJob sAiChooseJob = {0};
+
+static void ChooseMoveOrAction_Step(struct AiChooseJob *job);
+
 static inline void BattleAI_DoAIProcessing(struct AI_ThinkingStruct *aiThink, u32 battlerAi, u32 battlerDef);
 static inline void BattleAI_DoAIProcessing_PredictedSwitchin(struct AI_ThinkingStruct *aiThink, struct AiLogicData *aiData, u32 battlerAi, u32 battlerDef);
 static bool32 IsPinchBerryItemEffect(u32 holdEffect);
@@ -58,6 +84,7 @@ static s32 AI_DoubleBattle(u32 battlerAtk, u32 battlerDef, u32 move, s32 score);
 static s32 AI_PowerfulStatus(u32 battlerAtk, u32 battlerDef, u32 move, s32 score);
 static s32 AI_DynamicFunc(u32 battlerAtk, u32 battlerDef, u32 move, s32 score);
 static s32 AI_PredictSwitch(u32 battlerAtk, u32 battlerDef, u32 move, s32 score);
+static s32 AI_Lookahead(u32 battlerAtk, u32 battlerDef, u32 move, s32 score);
 
 static s32 (*const sBattleAiFuncTable[])(u32, u32, u32, s32) =
 {
@@ -86,7 +113,7 @@ static s32 (*const sBattleAiFuncTable[])(u32, u32, u32, s32) =
     [22] = NULL,                     // Unused
     [23] = AI_PredictSwitch,         // AI_FLAG_PREDICT_SWITCH
     [24] = NULL,                     // Unused
-    [25] = NULL,                     // Unused
+    [25] = AI_Lookahead,             // AI_FLAG_LOOKAHEAD
     [26] = NULL,                     // Unused
     [27] = NULL,                     // Unused
     [28] = AI_DynamicFunc,          // AI_FLAG_DYNAMIC_FUNC
@@ -271,22 +298,127 @@ void BattleAI_SetupAIData(u8 defaultScoreMoves, u32 battler)
     gBattleStruct->aiChosenTarget[battler] = gBattlerTarget;
 }
 
+static void StartChooseMoveOrAction(struct AiChooseJob *job, u32 battler)
+{
+    memset(job, 0, sizeof(*job));
+    job->battler = battler;
+    job->isDouble = IsDoubleBattle();
+    job->battlerTarget = gBattlerTarget;
+    job->rng = gRngValue;
+    if (job->isDouble)
+    {
+        job->state = AI_CHOOSE_NEXT_TARGET;
+    }
+    else
+    {
+        AI_DATA->partnerMove = 0;   // no ally
+        job->flags = AI_THINKING_STRUCT->aiFlags[battler];
+        job->state = AI_CHOOSE_SCORE_MOVES;
+    }
+}
+
+// The budget is measured with VCOUNT, at a scanline's resolution, rather
+// than with CycleCountStart. That takes over timers 2 and 3, which belong to
+// link battles, the test runner's timeout and BENCHMARK.
+#define CYCLES_PER_SCANLINE 1232
+#define TOTAL_SCANLINES     228
+
+static u32 GetCyclesSinceScanline(u32 startScanline)
+{
+    return ((REG_VCOUNT & 0xFF) + TOTAL_SCANLINES - startScanline) % TOTAL_SCANLINES * CYCLES_PER_SCANLINE;
+}
+
+// Runs the AI until it has made a choice, or until it has used up
+// 'cycleBudget' cycles (0 for no limit). The AI draws from its own copy of
+// the RNG so that its choice doesn't depend on how many frames it is spread
+// over; the RNG is then left where the AI finished with it, as if the AI
+// had run all in one go.
+static bool32 ContinueChooseMoveOrAction(struct AiChooseJob *job, u32 cycleBudget)
+{
+    rng_value_t rng = gRngValue;
+    u32 startScanline = REG_VCOUNT & 0xFF;
+
+    gRngValue = job->rng;
+    gBattlerTarget = job->battlerTarget;
+
+    do
+    {
+        ChooseMoveOrAction_Step(job);
+    } while (job->state != AI_CHOOSE_DONE && (cycleBudget == 0 || GetCyclesSinceScanline(startScanline) < cycleBudget));
+
+    if (job->state == AI_CHOOSE_DONE)
+        return TRUE;
+
+    job->rng = gRngValue;
+    job->battlerTarget = gBattlerTarget;
+    gRngValue = rng;
+    return FALSE;
+}
+
+static u32 GetChooseMoveOrActionCycleBudget(void)
+{
+#if TESTING
+    // Lets tests spread the AI over more frames than a real budget would.
+    if (VarGet(TESTING_VAR_AI_CYCLES_PER_FRAME) != 0)
+        return VarGet(TESTING_VAR_AI_CYCLES_PER_FRAME);
+#endif
+    return AI_CYCLES_PER_FRAME;
+}
+
+// Chooses in one go. The AI's thinking state is shared with the task, so
+// this must not be called while the task is running.
 u32 BattleAI_ChooseMoveOrAction(u32 battler)
 {
-    u32 ret;
+    struct AiChooseJob job;
+
+    AGB_ASSERT(!BattleAI_IsChoosingMoveOrAction());
+    StartChooseMoveOrAction(&job, battler);
+    ContinueChooseMoveOrAction(&job, 0);
+    return job.choice;
+}
+
+#define tSkipFrame data[0]
 
-    if (!IsDoubleBattle())
-        ret = ChooseMoveOrAction_Singles(battler);
+static void Task_ChooseMoveOrAction(u8 taskId)
+{
+    // The first slice already ran in the frame that the task was created.
+    if (gTasks[taskId].tSkipFrame)
+    {
+        gTasks[taskId].tSkipFrame = FALSE;
+        return;
+    }
+
+    AI_DATA->aiCalcInProgress = TRUE;
+    if (ContinueChooseMoveOrAction(&sAiChooseJob, GetChooseMoveOrActionCycleBudget()))
+    {
+        gBattleStruct->aiMoveOrAction[sAiChooseJob.battler] = sAiChooseJob.choice;
+        DestroyTask(taskId);
+    }
+    AI_DATA->aiCalcInProgress = FALSE;
+}
+
+// Like BattleAI_ChooseMoveOrAction, but if the AI takes longer than
+// AI_CYCLES_PER_FRAME it continues in a task on the following frames, and
+// stores its choice in aiMoveOrAction once it is done.
+void BattleAI_ChooseMoveOrActionInTask(u32 battler)
+{
+    StartChooseMoveOrAction(&sAiChooseJob, battler);
+    if (ContinueChooseMoveOrAction(&sAiChooseJob, GetChooseMoveOrActionCycleBudget()))
+    {
+        gBattleStruct->aiMoveOrAction[battler] = sAiChooseJob.choice;
+    }
     else
-        ret = ChooseMoveOrAction_Doubles(battler);
-
-    // Clear protect structures, some flags may be set during AI calcs
-    // e.g. pranksterElevated from GetBattleMovePriority
-    memset(&gProtectStructs, 0, MAX_BATTLERS_COUNT * sizeof(struct ProtectStruct));
-    #if TESTING
-    TestRunner_Battle_CheckAiMoveScores(battler);
-    #endif // TESTING
-    return ret;
+    {
+        u8 taskId = CreateTask(Task_ChooseMoveOrAction, 0);
+        gTasks[taskId].tSkipFrame = TRUE;
+    }
+}
+
+#undef tSkipFrame
+
+bool32 BattleAI_IsChoosingMoveOrAction(void)
+{
+    return FuncIsActiveTask(Task_ChooseMoveOrAction);
 }
 
 static void CopyBattlerDataToAIParty(u32 bPosition, u32 side)
@@ -496,27 +628,37 @@ void SetAiLogicDataForTurn(struct AiLogicData *aiData)
     AI_DATA->aiCalcInProgress = FALSE;
 }
 
+// Runs the next AI flag function for the current target, skipping over
+// flags which aren't set. Returns FALSE once every flag has been run.
+static bool32 ChooseMoveOrAction_ScoreMoves(struct AiChooseJob *job)
+{
+    u32 battlerAi = job->battler;
+
+    while (job->flags != 0 && !(job->flags & 1))
+    {
+        job->flags >>= 1;
+        AI_THINKING_STRUCT->aiLogicId++;
+    }
+
+    if (job->flags == 0)
+        return FALSE;
+
+    if (IsBattlerPredictedToSwitch(gBattlerTarget) && (AI_THINKING_STRUCT->aiFlags[battlerAi] & AI_FLAG_PREDICT_INCOMING_MON))
+        BattleAI_DoAIProcessing_PredictedSwitchin(AI_THINKING_STRUCT, AI_DATA, battlerAi, gBattlerTarget);
+    else
+        BattleAI_DoAIProcessing(AI_THINKING_STRUCT, battlerAi, gBattlerTarget);
+
+    job->flags >>= 1;
+    AI_THINKING_STRUCT->aiLogicId++;
+    return TRUE;
+}
+
 static u32 ChooseMoveOrAction_Singles(u32 battlerAi)
 {
     u8 currentMoveArray[MAX_MON_MOVES];
     u8 consideredMoveArray[MAX_MON_MOVES];
     u32 numOfBestMoves;
     s32 i;
-    u32 flags = AI_THINKING_STRUCT->aiFlags[battlerAi];
-
-    AI_DATA->partnerMove = 0;   // no ally
-    while (flags != 0)
-    {
-        if (flags & 1)
-        {
-            if (IsBattlerPredictedToSwitch(gBattlerTarget) && (AI_THINKING_STRUCT->aiFlags[battlerAi] & AI_FLAG_PREDICT_INCOMING_MON))
-                BattleAI_DoAIProcessing_PredictedSwitchin(AI_THINKING_STRUCT, AI_DATA, battlerAi, gBattlerTarget);
-            else
-                BattleAI_DoAIProcessing(AI_THINKING_STRUCT, battlerAi, gBattlerTarget);
-        }
-        flags >>= 1;
-        AI_THINKING_STRUCT->aiLogicId++;
-    }
 
     for (i = 0; i < MAX_MON_MOVES; i++)
     {
@@ -554,126 +696,166 @@ static u32 ChooseMoveOrAction_Singles(u32 battlerAi)
     return consideredMoveArray[Random() % numOfBestMoves];
 }
 
-static u32 ChooseMoveOrAction_Doubles(u32 battlerAi)
+static void ChooseMoveOrAction_SetupTarget_Doubles(struct AiChooseJob *job)
 {
-    s32 i, j;
-    u32 flags;
-    s32 bestMovePointsForTarget[MAX_BATTLERS_COUNT];
-    u8 mostViableTargetsArray[MAX_BATTLERS_COUNT];
-    u8 actionOrMoveIndex[MAX_BATTLERS_COUNT];
+    u32 battlerAi = job->battler;
+    u32 i = job->target;
+
+    if (gBattleTypeFlags & BATTLE_TYPE_PALACE)
+        BattleAI_SetupAIData(gBattleStruct->palaceFlags >> 4, battlerAi);
+    else
+        BattleAI_SetupAIData(0xF, battlerAi);
+
+    gBattlerTarget = i;
+
+    AI_DATA->partnerMove = GetAllyChosenMove(battlerAi);
+    AI_THINKING_STRUCT->aiLogicId = 0;
+    AI_THINKING_STRUCT->movesetIndex = 0;
+    job->flags = AI_THINKING_STRUCT->aiFlags[battlerAi];
+}
+
+static void ChooseMoveOrAction_ScoreTarget_Doubles(struct AiChooseJob *job)
+{
+    s32 j;
     s32 mostViableMovesScores[MAX_MON_MOVES];
     u8 mostViableMovesIndices[MAX_MON_MOVES];
-    u32 mostViableTargetsNo;
     u32 mostViableMovesNo;
-    s32 mostMovePoints;
+    u32 battlerAi = job->battler;
+    u32 i = job->target;
 
-    for (i = 0; i < MAX_BATTLERS_COUNT; i++)
+    if (AI_THINKING_STRUCT->aiAction & AI_ACTION_FLEE)
     {
-        if (i == battlerAi || gBattleMons[i].hp == 0)
-        {
-            actionOrMoveIndex[i] = 0xFF;
-            bestMovePointsForTarget[i] = -1;
-        }
-        else
+        job->actionOrMoveIndex[i] = AI_CHOICE_FLEE;
+    }
+    else if (AI_THINKING_STRUCT->aiAction & AI_ACTION_WATCH)
+    {
+        job->actionOrMoveIndex[i] = AI_CHOICE_WATCH;
+    }
+    else
+    {
+        mostViableMovesScores[0] = AI_THINKING_STRUCT->score[0];
+        mostViableMovesIndices[0] = 0;
+        mostViableMovesNo = 1;
+        for (j = 1; j < MAX_MON_MOVES; j++)
         {
-            if (gBattleTypeFlags & BATTLE_TYPE_PALACE)
-                BattleAI_SetupAIData(gBattleStruct->palaceFlags >> 4, battlerAi);
-            else
-                BattleAI_SetupAIData(0xF, battlerAi);
-
-            gBattlerTarget = i;
-
-            AI_DATA->partnerMove = GetAllyChosenMove(battlerAi);
-            AI_THINKING_STRUCT->aiLogicId = 0;
-            AI_THINKING_STRUCT->movesetIndex = 0;
-            flags = AI_THINKING_STRUCT->aiFlags[battlerAi];
-
-            while (flags != 0)
+            if (gBattleMons[battlerAi].moves[j] != 0)
             {
-                if (flags & 1)
-                {
-                    if (IsBattlerPredictedToSwitch(gBattlerTarget) && (AI_THINKING_STRUCT->aiFlags[battlerAi] & AI_FLAG_PREDICT_INCOMING_MON))
-                        BattleAI_DoAIProcessing_PredictedSwitchin(AI_THINKING_STRUCT, AI_DATA, battlerAi, gBattlerTarget);
-                    else
-                        BattleAI_DoAIProcessing(AI_THINKING_STRUCT, battlerAi, gBattlerTarget);
-                }
-                flags >>= 1;
-                AI_THINKING_STRUCT->aiLogicId++;
-            }
+                if (!CanTargetBattler(battlerAi, i, gBattleMons[battlerAi].moves[j]))
+                    continue;
 
-            if (AI_THINKING_STRUCT->aiAction & AI_ACTION_FLEE)
-            {
-                actionOrMoveIndex[i] = AI_CHOICE_FLEE;
-            }
-            else if (AI_THINKING_STRUCT->aiAction & AI_ACTION_WATCH)
-            {
-                actionOrMoveIndex[i] = AI_CHOICE_WATCH;
-            }
-            else
-            {
-                mostViableMovesScores[0] = AI_THINKING_STRUCT->score[0];
-                mostViableMovesIndices[0] = 0;
-                mostViableMovesNo = 1;
-                for (j = 1; j < MAX_MON_MOVES; j++)
+                if (mostViableMovesScores[0] == AI_THINKING_STRUCT->score[j])
                 {
-                    if (gBattleMons[battlerAi].moves[j] != 0)
-                    {
-                        if (!CanTargetBattler(battlerAi, i, gBattleMons[battlerAi].moves[j]))
-                            continue;
-
-                        if (mostViableMovesScores[0] == AI_THINKING_STRUCT->score[j])
-                        {
-                            mostViableMovesScores[mostViableMovesNo] = AI_THINKING_STRUCT->score[j];
-                            mostViableMovesIndices[mostViableMovesNo] = j;
-                            mostViableMovesNo++;
-                        }
-                        if (mostViableMovesScores[0] < AI_THINKING_STRUCT->score[j])
-                        {
-                            mostViableMovesScores[0] = AI_THINKING_STRUCT->score[j];
-                            mostViableMovesIndices[0] = j;
-                            mostViableMovesNo = 1;
-                        }
-                    }
+                    mostViableMovesScores[mostViableMovesNo] = AI_THINKING_STRUCT->score[j];
+                    mostViableMovesIndices[mostViableMovesNo] = j;
+                    mostViableMovesNo++;
                 }
-                actionOrMoveIndex[i] = mostViableMovesIndices[Random() % mostViableMovesNo];
-                bestMovePointsForTarget[i] = mostViableMovesScores[0];
-
-                // Don't use a move against ally if it has less than 100 points.
-                if (i == BATTLE_PARTNER(battlerAi) && bestMovePointsForTarget[i] < AI_SCORE_DEFAULT)
+                if (mostViableMovesScores[0] < AI_THINKING_STRUCT->score[j])
                 {
-                    bestMovePointsForTarget[i] = -1;
+                    mostViableMovesScores[0] = AI_THINKING_STRUCT->score[j];
+                    mostViableMovesIndices[0] = j;
+                    mostViableMovesNo = 1;
                 }
             }
+        }
+        job->actionOrMoveIndex[i] = mostViableMovesIndices[Random() % mostViableMovesNo];
+        job->bestMovePointsForTarget[i] = mostViableMovesScores[0];
 
-            for (j = 0; j < MAX_MON_MOVES; j++)
-            {
-                gBattleStruct->aiFinalScore[battlerAi][gBattlerTarget][j] = AI_THINKING_STRUCT->score[j];
-            }
+        // Don't use a move against ally if it has less than 100 points.
+        if (i == BATTLE_PARTNER(battlerAi) && job->bestMovePointsForTarget[i] < AI_SCORE_DEFAULT)
+        {
+            job->bestMovePointsForTarget[i] = -1;
         }
     }
 
-    mostMovePoints = bestMovePointsForTarget[0];
+    for (j = 0; j < MAX_MON_MOVES; j++)
+    {
+        gBattleStruct->aiFinalScore[battlerAi][gBattlerTarget][j] = AI_THINKING_STRUCT->score[j];
+    }
+}
+
+static u32 ChooseMoveOrAction_Doubles(struct AiChooseJob *job)
+{
+    s32 i;
+    u8 mostViableTargetsArray[MAX_BATTLERS_COUNT];
+    u32 mostViableTargetsNo;
+    s32 mostMovePoints;
+
+    mostMovePoints = job->bestMovePointsForTarget[0];
     mostViableTargetsArray[0] = 0;
     mostViableTargetsNo = 1;
 
     for (i = 1; i < MAX_BATTLERS_COUNT; i++)
     {
-        if (mostMovePoints == bestMovePointsForTarget[i])
+        if (mostMovePoints == job->bestMovePointsForTarget[i])
         {
             mostViableTargetsArray[mostViableTargetsNo] = i;
             mostViableTargetsNo++;
         }
-        if (mostMovePoints < bestMovePointsForTarget[i])
+        if (mostMovePoints < job->bestMovePointsForTarget[i])
         {
-            mostMovePoints = bestMovePointsForTarget[i];
+            mostMovePoints = job->bestMovePointsForTarget[i];
             mostViableTargetsArray[0] = i;
             mostViableTargetsNo = 1;
         }
     }
 
     gBattlerTarget = mostViableTargetsArray[Random() % mostViableTargetsNo];
-    gBattleStruct->aiChosenTarget[battlerAi] = gBattlerTarget;
-    return actionOrMoveIndex[gBattlerTarget];
+    gBattleStruct->aiChosenTarget[job->battler] = gBattlerTarget;
+    return job->actionOrMoveIndex[gBattlerTarget];
+}
+
+// Does the smallest unit of work that the AI can be interrupted after,
+// which is running one AI flag function over every move.
+static void ChooseMoveOrAction_Step(struct AiChooseJob *job)
+{
+    switch (job->state)
+    {
+    case AI_CHOOSE_NEXT_TARGET:
+        if (job->target == MAX_BATTLERS_COUNT)
+        {
+            job->state = AI_CHOOSE_FINISH;
+        }
+        else if (job->target == job->battler || gBattleMons[job->target].hp == 0)
+        {
+            job->actionOrMoveIndex[job->target] = 0xFF;
+            job->bestMovePointsForTarget[job->target] = -1;
+            job->target++;
+        }
+        else
+        {
+            ChooseMoveOrAction_SetupTarget_Doubles(job);
+            job->state = AI_CHOOSE_SCORE_MOVES;
+        }
+        break;
+    case AI_CHOOSE_SCORE_MOVES:
+        if (ChooseMoveOrAction_ScoreMoves(job))
+            break;
+        if (job->isDouble)
+        {
+            ChooseMoveOrAction_ScoreTarget_Doubles(job);
+            job->target++;
+            job->state = AI_CHOOSE_NEXT_TARGET;
+        }
+        else
+        {
+            job->state = AI_CHOOSE_FINISH;
+        }
+        break;
+    case AI_CHOOSE_FINISH:
+        if (job->isDouble)
+            job->choice = ChooseMoveOrAction_Doubles(job);
+        else
+            job->choice = ChooseMoveOrAction_Singles(job->battler);
+
+        // Clear protect structures, some flags may be set during AI calcs
+        // e.g. pranksterElevated from GetBattleMovePriority
+        memset(&gProtectStructs, 0, MAX_BATTLERS_COUNT * sizeof(struct ProtectStruct));
+        #if TESTING
+        TestRunner_Battle_CheckAiMoveScores(job->battler);
+        #endif // TESTING
+        job->state = AI_CHOOSE_DONE;
+        break;
+    }
 }
 
 static inline bool32 ShouldConsiderMoveForBattler(u32 battlerAi, u32 battlerDef, u32 move)
@@ -724,33 +906,27 @@ static inline void BattleAI_DoAIProcessing(struct AI_ThinkingStruct *aiThink, u3
 
 void BattleAI_DoAIProcessing_PredictedSwitchin(struct AI_ThinkingStruct *aiThink, struct AiLogicData *aiData, u32 battlerAtk, u32 battlerDef)
 {
-    struct BattlePokemon switchoutCandidate = gBattleMons[battlerDef];
-    struct SimulatedDamage simulatedDamageSwitchout[MAX_MON_MOVES];
-    uq4_12_t effectivenessSwitchout[MAX_MON_MOVES];
-    u8 moveAccuracySwitchout[MAX_MON_MOVES];
-
-    struct BattlePokemon switchinCandidate;
-    struct SimulatedDamage simulatedDamageSwitchin[MAX_MON_MOVES];
-    uq4_12_t effectivenessSwitchin[MAX_MON_MOVES];
-    u8 moveAccuracySwitchin[MAX_MON_MOVES];
-
     struct Pokemon *party = GetBattlerParty(battlerDef);
-    struct BattlePokemon *savedBattleMons = AllocSaveBattleMons();
-    u32 moveIndex;
+    u32 switchoutState, switchinState;
 
-    // Store battler moves data to save time over recalculating it
-    for (moveIndex = 0; moveIndex < MAX_MON_MOVES; moveIndex++)
+    switchoutState = AI_PushBattleState(battlerDef, battlerAtk);
+    if (switchoutState == AI_BATTLE_STATE_NONE)
     {
-        simulatedDamageSwitchout[moveIndex] = aiData->simulatedDmg[battlerAtk][battlerDef][moveIndex];
-        effectivenessSwitchout[moveIndex] = aiData->effectiveness[battlerAtk][battlerDef][moveIndex];
-        moveAccuracySwitchout[moveIndex] = aiData->moveAccuracy[battlerAtk][battlerDef][moveIndex];
+        BattleAI_DoAIProcessing(aiThink, battlerAtk, battlerDef);
+        return;
     }
 
     // Get battler and move data for predicted switchin
-    PokemonToBattleMon(&party[aiData->mostSuitableMonId[battlerDef]], &switchinCandidate);
-    gBattleMons[battlerDef] = switchinCandidate;
+    PokemonToBattleMon(&party[aiData->mostSuitableMonId[battlerDef]], &gBattleMons[battlerDef]);
     SetBattlerAiData(battlerDef, aiData);
     CalcBattlerAiMovesData(aiData, battlerAtk, battlerDef, AI_GetWeather());
+    switchinState = AI_PushBattleState(battlerDef, battlerAtk);
+    if (switchinState == AI_BATTLE_STATE_NONE)
+    {
+        AI_PopBattleState();
+        BattleAI_DoAIProcessing(aiThink, battlerAtk, battlerDef);
+        return;
+    }
 
     // Regular processing with new battler
     do
@@ -765,52 +941,25 @@ void BattleAI_DoAIProcessing_PredictedSwitchin(struct AI_ThinkingStruct *aiThink
           && aiThink->score[aiThink->movesetIndex] > 0
           && ShouldConsiderMoveForBattler(battlerAtk, battlerDef, aiThink->moveConsidered))
         {
-            if (IsChaseEffect(GetMoveEffect(aiThink->moveConsidered)))
-            {
-                // Save new switchin data
-                simulatedDamageSwitchin[aiThink->movesetIndex] = aiData->simulatedDmg[battlerAtk][battlerDef][aiThink->movesetIndex];
-                effectivenessSwitchin[aiThink->movesetIndex] = aiData->effectiveness[battlerAtk][battlerDef][aiThink->movesetIndex];
-                moveAccuracySwitchin[aiThink->movesetIndex] = aiData->moveAccuracy[battlerAtk][battlerDef][aiThink->movesetIndex];
-
-                // Restore old switchout data
-                gBattleMons[battlerDef] = switchoutCandidate;
-                SetBattlerAiData(battlerDef, aiData);
-                aiData->simulatedDmg[battlerAtk][battlerDef][aiThink->movesetIndex] = simulatedDamageSwitchout[aiThink->movesetIndex];
-                aiData->effectiveness[battlerAtk][battlerDef][aiThink->movesetIndex] = effectivenessSwitchout[aiThink->movesetIndex];
-                aiData->moveAccuracy[battlerAtk][battlerDef][aiThink->movesetIndex] = moveAccuracySwitchout[aiThink->movesetIndex];
-
-                if (aiThink->aiLogicId < ARRAY_COUNT(sBattleAiFuncTable)
-                && sBattleAiFuncTable[aiThink->aiLogicId] != NULL)
-                {
-                    // Call AI function
-                    aiThink->score[aiThink->movesetIndex] =
-                        sBattleAiFuncTable[aiThink->aiLogicId](battlerAtk,
-                        battlerDef,
-                        aiThink->moveConsidered,
-                        aiThink->score[aiThink->movesetIndex]);
-                }
+            // Chase moves hit the mon which is switching out
+            bool32 isChaseMove = IsChaseEffect(GetMoveEffect(aiThink->moveConsidered));
 
-                // Restore new switchin data
-                gBattleMons[battlerDef] = switchinCandidate;
-                SetBattlerAiData(battlerDef, aiData);
-                aiData->simulatedDmg[battlerAtk][battlerDef][aiThink->movesetIndex] = simulatedDamageSwitchin[aiThink->movesetIndex];
-                aiData->effectiveness[battlerAtk][battlerDef][aiThink->movesetIndex] = effectivenessSwitchin[aiThink->movesetIndex];
-                aiData->moveAccuracy[battlerAtk][battlerDef][aiThink->movesetIndex] = moveAccuracySwitchin[aiThink->movesetIndex];
-            }
+            if (isChaseMove)
+                AI_RestoreBattleState(switchoutState);
 
-            else
+            if (aiThink->aiLogicId < ARRAY_COUNT(sBattleAiFuncTable)
+            && sBattleAiFuncTable[aiThink->aiLogicId] != NULL)
             {
-                if (aiThink->aiLogicId < ARRAY_COUNT(sBattleAiFuncTable)
-                && sBattleAiFuncTable[aiThink->aiLogicId] != NULL)
-                {
-                    // Call AI function
-                    aiThink->score[aiThink->movesetIndex] =
-                        sBattleAiFuncTable[aiThink->aiLogicId](battlerAtk,
-                        battlerDef,
-                        aiThink->moveConsidered,
-                        aiThink->score[aiThink->movesetIndex]);
-                }
+                // Call AI function
+                aiThink->score[aiThink->movesetIndex] =
+                    sBattleAiFuncTable[aiThink->aiLogicId](battlerAtk,
+                    battlerDef,
+                    aiThink->moveConsidered,
+                    aiThink->score[aiThink->movesetIndex]);
             }
+
+            if (isChaseMove)
+                AI_RestoreBattleState(switchinState);
         }
         else
         {
@@ -822,14 +971,8 @@ void BattleAI_DoAIProcessing_PredictedSwitchin(struct AI_ThinkingStruct *aiThink
     aiThink->movesetIndex = 0;
 
     // Restore original battler data and moves
-    FreeRestoreBattleMons(savedBattleMons);
-    SetBattlerAiData(battlerDef, aiData);
-    for (moveIndex = 0; moveIndex < MAX_MON_MOVES; moveIndex++)
-    {
-        aiData->simulatedDmg[battlerAtk][battlerDef][moveIndex] = simulatedDamageSwitchout[moveIndex];
-        aiData->effectiveness[battlerAtk][battlerDef][moveIndex] = effectivenessSwitchout[moveIndex];
-        aiData->moveAccuracy[battlerAtk][battlerDef][moveIndex] = moveAccuracySwitchout[moveIndex];
-    }
+    AI_PopBattleState();
+    AI_PopBattleState();
 }
 
 // AI Score Functions
@@ -5091,6 +5234,52 @@ static s32 AI_TryTo2HKO(u32 battlerAtk, u32 battlerDef, u32 move, s32 score)
     return score;
 }
 
+// Plays out the considered move and the target's reply on a copy of the battle state,
+// then checks whether the AI is left able to KO the target next turn.
+static s32 AI_Lookahead(u32 battlerAtk, u32 battlerDef, u32 move, s32 score)
+{
+    s32 dmg = AI_DATA->simulatedDmg[battlerAtk][battlerDef][AI_THINKING_STRUCT->movesetIndex].expected;
+    s32 reply, hpAtk;
+
+    // Moves which KO are already scored by AI_FLAG_TRY_TO_FAINT
+    if (IS_TARGETING_PARTNER(battlerAtk, battlerDef)
+      || dmg <= 0
+      || dmg >= gBattleMons[battlerDef].hp)
+        return score;
+
+    reply = GetBestDmgFromBattler(battlerDef, battlerAtk);
+    hpAtk = gBattleMons[battlerAtk].hp;
+    if (AI_IsSlower(battlerAtk, battlerDef, move) && reply >= hpAtk)
+        return score;
+
+    if (AI_PushBattleState(battlerAtk, MAX_BATTLERS_COUNT) == AI_BATTLE_STATE_NONE)
+        return score;
+    if (AI_PushBattleState(battlerDef, MAX_BATTLERS_COUNT) == AI_BATTLE_STATE_NONE)
+    {
+        AI_PopBattleState();
+        return score;
+    }
+
+    gBattleMons[battlerDef].hp -= dmg;
+    if (GetMoveEffect(move) == EFFECT_ABSORB)
+        hpAtk += dmg * GetMoveAbsorbPercentage(move) / 100;
+    else if (GetMoveRecoil(move) != 0)
+        hpAtk -= dmg * GetMoveRecoil(move) / 100;
+    hpAtk = min(hpAtk, gBattleMons[battlerAtk].maxHP) - reply;
+    gBattleMons[battlerAtk].hp = max(hpAtk, 0);
+    AI_DATA->hpPercents[battlerAtk] = GetHealthPercentage(battlerAtk);
+    AI_DATA->hpPercents[battlerDef] = GetHealthPercentage(battlerDef);
+
+    if (IsBattlerAlive(battlerAtk)
+      && CanAIFaintTarget(battlerAtk, battlerDef, 1)
+      && (AI_IsFaster(battlerAtk, battlerDef, move) || reply < gBattleMons[battlerAtk].hp))
+        ADJUST_SCORE(DECENT_EFFECT);
+
+    AI_PopBattleState();
+    AI_PopBattleState();
+    return score;
+}
+
 // Prefers moves that are good for baton pass
 static s32 AI_PreferBatonPass(u32 battlerAtk, u32 battlerDef, u32 move, s32 score)
 {
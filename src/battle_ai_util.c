@@ -3591,19 +3591,90 @@ bool32 ShouldUseWishAromatherapy(u32 battlerAtk, u32 battlerDef, u32 move)
     return FALSE;
 }
 
-#define SIZE_G_BATTLE_MONS (sizeof(struct BattlePokemon) * MAX_BATTLERS_COUNT)
-
-struct BattlePokemon *AllocSaveBattleMons(void)
-{
-    struct BattlePokemon *savedBattleMons = Alloc(SIZE_G_BATTLE_MONS);
-    memcpy(savedBattleMons, gBattleMons, SIZE_G_BATTLE_MONS);
-    return savedBattleMons;
-}
+// Saves a battler, along with the AI's view of it, so that it can be changed
+// to evaluate a what-if. If movesAttacker isn't MAX_BATTLERS_COUNT, the AI's
+// move data for movesAttacker against the battler is saved too. Returns
+// AI_BATTLE_STATE_NONE without saving anything if the stack is full, in
+// which case the caller must not change the battler. Every other push must
+// be matched by a pop.
+u32 AI_PushBattleState(u32 battler, u32 movesAttacker)
+{
+    struct AiBattleStateStack *stack = gBattleResources->aiStateStack;
+    struct AiBattleState *state;
+
+    if (stack->size >= AI_BATTLE_STATE_STACK_SIZE)
+    {
+        DebugPrintfLevel(MGBA_LOG_ERROR, "AI_PushBattleState: the stack is full!");
+        return AI_BATTLE_STATE_NONE;
+    }
+
+    state = &stack->states[stack->size];
+    state->battleMon = gBattleMons[battler];
+    memcpy(state->sideStatuses, gSideStatuses, sizeof(state->sideStatuses));
+    memcpy(state->statuses3, gStatuses3, sizeof(state->statuses3));
+    state->fieldStatuses = gFieldStatuses;
+    state->battleWeather = gBattleWeather;
+    state->ability = AI_DATA->abilities[battler];
+    state->item = AI_DATA->items[battler];
+    state->holdEffect = AI_DATA->holdEffects[battler];
+    state->holdEffectParam = AI_DATA->holdEffectParams[battler];
+    state->lastUsedMove = AI_DATA->lastUsedMove[battler];
+    state->hpPercent = AI_DATA->hpPercents[battler];
+    state->moveLimitations = AI_DATA->moveLimitations[battler];
+    state->speedStat = AI_DATA->speedStats[battler];
+    state->battler = battler;
+    state->movesAttacker = movesAttacker;
+    if (movesAttacker != MAX_BATTLERS_COUNT)
+    {
+        memcpy(state->simulatedDmg, AI_DATA->simulatedDmg[movesAttacker][battler], sizeof(state->simulatedDmg));
+        memcpy(state->effectiveness, AI_DATA->effectiveness[movesAttacker][battler], sizeof(state->effectiveness));
+        memcpy(state->moveAccuracy, AI_DATA->moveAccuracy[movesAttacker][battler], sizeof(state->moveAccuracy));
+    }
+    return stack->size++;
+}
+
+// Goes back to a state returned by AI_PushBattleState without popping it.
+void AI_RestoreBattleState(u32 stateId)
+{
+    const struct AiBattleState *state = &gBattleResources->aiStateStack->states[stateId];
+    u32 battler = state->battler;
+    u32 movesAttacker = state->movesAttacker;
+
+    gBattleMons[battler] = state->battleMon;
+    memcpy(gSideStatuses, state->sideStatuses, sizeof(state->sideStatuses));
+    memcpy(gStatuses3, state->statuses3, sizeof(state->statuses3));
+    gFieldStatuses = state->fieldStatuses;
+    gBattleWeather = state->battleWeather;
+    AI_DATA->abilities[battler] = state->ability;
+    AI_DATA->items[battler] = state->item;
+    AI_DATA->holdEffects[battler] = state->holdEffect;
+    AI_DATA->holdEffectParams[battler] = state->holdEffectParam;
+    AI_DATA->lastUsedMove[battler] = state->lastUsedMove;
+    AI_DATA->hpPercents[battler] = state->hpPercent;
+    AI_DATA->moveLimitations[battler] = state->moveLimitations;
+    AI_DATA->speedStats[battler] = state->speedStat;
+    if (movesAttacker != MAX_BATTLERS_COUNT)
+    {
+        memcpy(AI_DATA->simulatedDmg[movesAttacker][battler], state->simulatedDmg, sizeof(state->simulatedDmg));
+        memcpy(AI_DATA->effectiveness[movesAttacker][battler], state->effectiveness, sizeof(state->effectiveness));
+        memcpy(AI_DATA->moveAccuracy[movesAttacker][battler], state->moveAccuracy, sizeof(state->moveAccuracy));
+    }
+}
+
+// Returns FALSE if there was nothing to pop, which means that a push which
+// returned AI_BATTLE_STATE_NONE was popped.
+bool32 AI_PopBattleState(void)
+{
+    struct AiBattleStateStack *stack = gBattleResources->aiStateStack;
+
+    if (stack->size == 0)
+    {
+        DebugPrintfLevel(MGBA_LOG_ERROR, "AI_PopBattleState: the stack is empty!");
+        return FALSE;
+    }
 
-void FreeRestoreBattleMons(struct BattlePokemon *savedBattleMons)
-{
-    memcpy(gBattleMons, savedBattleMons, SIZE_G_BATTLE_MONS);
-    Free(savedBattleMons);
+    AI_RestoreBattleState(--stack->size);
+    return TRUE;
 }
 
 // party logic
@@ -3611,8 +3682,13 @@ s32 AI_CalcPartyMonDamage(u32 move, u32 battlerAtk, u32 battlerDef, struct Battl
 {
     struct SimulatedDamage dmg;
     uq4_12_t effectiveness;
-    struct BattlePokemon *savedBattleMons = AllocSaveBattleMons();
 
+    u32 battler = isPartyMonAttacker ? battlerAtk : battlerDef;
+    struct BattlePokemon savedBattleMon;
+    bool32 pushed = AI_PushBattleState(battler, MAX_BATTLERS_COUNT) != AI_BATTLE_STATE_NONE;
+
+    if (!pushed)
+        savedBattleMon = gBattleMons[battler];
     if (isPartyMonAttacker)
     {
         gBattleMons[battlerAtk] = switchinCandidate;
@@ -3629,26 +3705,39 @@ s32 AI_CalcPartyMonDamage(u32 move, u32 battlerAtk, u32 battlerDef, struct Battl
     }
 
     dmg = AI_CalcDamage(move, battlerAtk, battlerDef, &effectiveness, FALSE, AI_GetWeather(), rollType);
-    // restores original gBattleMon struct
-    FreeRestoreBattleMons(savedBattleMons);
-
-    if (isPartyMonAttacker)
-        SetBattlerAiData(battlerAtk, AI_DATA);
+    if (pushed)
+    {
+        AI_PopBattleState();
+    }
     else
-        SetBattlerAiData(battlerDef, AI_DATA);
+    {
+        gBattleMons[battler] = savedBattleMon;
+        SetBattlerAiData(battler, AI_DATA);
+    }
 
     return dmg.expected;
 }
 
 u32 AI_WhoStrikesFirstPartyMon(u32 battlerAtk, u32 battlerDef, struct BattlePokemon switchinCandidate, u32 moveConsidered)
 {
-    struct BattlePokemon *savedBattleMons = AllocSaveBattleMons();
-    gBattleMons[battlerAtk] = switchinCandidate;
+    u32 aiMonFaster;
+    struct BattlePokemon savedBattleMon;
+    bool32 pushed = AI_PushBattleState(battlerAtk, MAX_BATTLERS_COUNT) != AI_BATTLE_STATE_NONE;
 
+    if (!pushed)
+        savedBattleMon = gBattleMons[battlerAtk];
+    gBattleMons[battlerAtk] = switchinCandidate;
     SetBattlerAiData(battlerAtk, AI_DATA);
-    u32 aiMonFaster = AI_IsFaster(battlerAtk, battlerDef, moveConsidered);
-    FreeRestoreBattleMons(savedBattleMons);
-    SetBattlerAiData(battlerAtk, AI_DATA);
+    aiMonFaster = AI_IsFaster(battlerAtk, battlerDef, moveConsidered);
+    if (pushed)
+    {
+        AI_PopBattleState();
+    }
+    else
+    {
+        gBattleMons[battlerAtk] = savedBattleMon;
+        SetBattlerAiData(battlerAtk, AI_DATA);
+    }
 
     return aiMonFaster;
 }
@@ -113,6 +113,7 @@ EWRAM_DATA static u16 sSoundAnimFramesToWait = 0;
 EWRAM_DATA static u8 sMonAnimTaskIdArray[2] = {0};
 EWRAM_DATA u8 gAnimMoveTurn = 0;
 EWRAM_DATA static u8 sAnimBackgroundFadeState = 0;
+EWRAM_DATA static struct BattleAnimGfxCache *sAnimGfxCache = NULL;
 EWRAM_DATA u16 gAnimMoveIndex = 0;
 EWRAM_DATA u8 gBattleAnimAttacker = 0;
 EWRAM_DATA u8 gBattleAnimTarget = 0;
@@ -498,14 +499,135 @@ static void RunAnimScriptCommand(void)
     } while (sAnimFramesToWait == 0 && gAnimScriptActive);
 }
 
+// Decompressed animation graphics are kept in a small LRU cache for the duration of a battle,
+// so moves and status animations that play repeatedly don't decompress them from ROM every time.
+void AllocBattleAnimGfxCache(void)
+{
+    if (B_ANIM_GFX_CACHE_SIZE != 0)
+        sAnimGfxCache = AllocZeroed(sizeof(*sAnimGfxCache));
+}
+
+void FreeBattleAnimGfxCache(void)
+{
+    u32 i;
+
+    if (sAnimGfxCache == NULL)
+        return;
+
+    for (i = 0; i < ANIM_GFX_CACHE_ENTRIES; i++)
+        TRY_FREE_AND_SET_NULL(sAnimGfxCache->entries[i].gfx);
+    FREE_AND_SET_NULL(sAnimGfxCache);
+}
+
+static void EvictBattleAnimGfxCacheEntry(struct BattleAnimGfxCacheEntry *entry)
+{
+    sAnimGfxCache->usedBytes -= entry->size;
+    FREE_AND_SET_NULL(entry->gfx);
+    entry->size = 0;
+}
+
+// Returns NULL if the graphics can't be cached.
+struct BattleAnimGfxCacheEntry *GetBattleAnimGfxCacheEntry(u32 index)
+{
+    u32 i, tilesSize, paletteSize, size;
+    struct BattleAnimGfxCacheEntry *entry, *oldest;
+
+    if (sAnimGfxCache == NULL)
+        return NULL;
+
+    for (i = 0; i < ANIM_GFX_CACHE_ENTRIES; i++)
+    {
+        entry = &sAnimGfxCache->entries[i];
+        if (entry->gfx != NULL && entry->index == index)
+        {
+            entry->lastUsed = ++sAnimGfxCache->clock;
+            return entry;
+        }
+    }
+
+    tilesSize = GetDecompressedDataSize(gBattleAnimPicTable[index].data);
+    paletteSize = GetDecompressedDataSize(gBattleAnimPaletteTable[index].data);
+    size = tilesSize + paletteSize;
+    if (size > B_ANIM_GFX_CACHE_SIZE)
+        return NULL;
+
+    // Evict the least recently used entries until there's a free entry and enough budget.
+    while (TRUE)
+    {
+        entry = NULL;
+        oldest = NULL;
+        for (i = 0; i < ANIM_GFX_CACHE_ENTRIES; i++)
+        {
+            if (sAnimGfxCache->entries[i].gfx == NULL)
+                entry = &sAnimGfxCache->entries[i];
+            else if (oldest == NULL || sAnimGfxCache->entries[i].lastUsed < oldest->lastUsed)
+                oldest = &sAnimGfxCache->entries[i];
+        }
+        if (entry != NULL && sAnimGfxCache->usedBytes + size <= B_ANIM_GFX_CACHE_SIZE)
+            break;
+        EvictBattleAnimGfxCacheEntry(oldest);
+    }
+
+    entry->gfx = Alloc(size);
+    if (entry->gfx == NULL)
+        return NULL;
+
+    LZDecompressWram(gBattleAnimPicTable[index].data, entry->gfx);
+    LZDecompressWram(gBattleAnimPaletteTable[index].data, entry->gfx + tilesSize);
+    entry->index = index;
+    entry->size = size;
+    entry->tilesSize = tilesSize;
+    entry->lastUsed = ++sAnimGfxCache->clock;
+    sAnimGfxCache->usedBytes += size;
+    return entry;
+}
+
+bool32 IsBattleAnimGfxCached(u32 index)
+{
+    u32 i;
+
+    if (sAnimGfxCache == NULL)
+        return FALSE;
+
+    for (i = 0; i < ANIM_GFX_CACHE_ENTRIES; i++)
+    {
+        if (sAnimGfxCache->entries[i].gfx != NULL && sAnimGfxCache->entries[i].index == index)
+            return TRUE;
+    }
+    return FALSE;
+}
+
+static void LoadBattleAnimGfx(u32 index)
+{
+    struct BattleAnimGfxCacheEntry *entry = NULL;
+
+    // Contests don't allocate battle resources, and their animations load
+    // the same graphics too rarely to be worth caching.
+    if (!IsContest())
+        entry = GetBattleAnimGfxCacheEntry(index);
+
+    if (entry != NULL)
+    {
+        struct SpriteSheet sheet = {entry->gfx, gBattleAnimPicTable[index].size, gBattleAnimPicTable[index].tag};
+        struct SpritePalette palette = {(const u16 *)(entry->gfx + entry->tilesSize), gBattleAnimPaletteTable[index].tag};
+
+        AcquireSpriteSheet(&sheet);
+        AcquireSpritePalette(&palette, FALSE);
+    }
+    else
+    {
+        AcquireCompressedSpriteSheet(&gBattleAnimPicTable[index]);
+        AcquireCompressedSpritePalette(&gBattleAnimPaletteTable[index], FALSE);
+    }
+}
+
 static void Cmd_loadspritegfx(void)
 {
     u16 index;
 
     sBattleAnimScriptPtr++;
     index = T1_READ_16(sBattleAnimScriptPtr);
-    LoadCompressedSpriteSheetUsingHeap(&gBattleAnimPicTable[GET_TRUE_SPRITE_INDEX(index)]);
-    LoadCompressedSpritePaletteUsingHeap(&gBattleAnimPaletteTable[GET_TRUE_SPRITE_INDEX(index)]);
+    LoadBattleAnimGfx(GET_TRUE_SPRITE_INDEX(index));
     sBattleAnimScriptPtr += 2;
     AddSpriteIndex(GET_TRUE_SPRITE_INDEX(index));
     sAnimFramesToWait = 1;
@@ -518,8 +640,9 @@ static void Cmd_unloadspritegfx(void)
 
     sBattleAnimScriptPtr++;
     index = T1_READ_16(sBattleAnimScriptPtr);
-    FreeSpriteTilesByTag(gBattleAnimPicTable[GET_TRUE_SPRITE_INDEX(index)].tag);
-    FreeSpritePaletteByTag(gBattleAnimPicTable[GET_TRUE_SPRITE_INDEX(index)].tag);
+    // Graphics which an earlier loadspritegfx also loaded stay until it is unloaded too.
+    ReleaseSpriteSheet(gBattleAnimPicTable[GET_TRUE_SPRITE_INDEX(index)].tag);
+    ReleaseSpritePalette(gBattleAnimPicTable[GET_TRUE_SPRITE_INDEX(index)].tag);
     sBattleAnimScriptPtr += 2;
     ClearSpriteIndex(GET_TRUE_SPRITE_INDEX(index));
 }
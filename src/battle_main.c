@@ -4171,8 +4171,15 @@ static void HandleTurnActionSelectionState(void)
 {
     s32 i, battler;
 
+    // Nothing else is chosen until the AI has finished, so that the AI sees
+    // the same battle state it would if it had chosen in one go.
+    if (BattleAI_IsChoosingMoveOrAction())
+        return;
+
+    battler = gBattleStruct->actionSelectionResumeBattler;
+    gBattleStruct->actionSelectionResumeBattler = 0;
     gBattleCommunication[ACTIONS_CONFIRMED_COUNT] = 0;
-    for (battler = 0; battler < gBattlersCount; battler++)
+    for (; battler < gBattlersCount; battler++)
     {
         u32 position = GetBattlerPosition(battler);
         switch (gBattleCommunication[battler])
@@ -4193,8 +4200,15 @@ static void HandleTurnActionSelectionState(void)
                 SetupAISwitchingData(battler, switchType);
 
                 // Do scoring
-                gBattleStruct->aiMoveOrAction[battler] = BattleAI_ChooseMoveOrAction(battler);
+                BattleAI_ChooseMoveOrActionInTask(battler);
                 AI_DATA->aiCalcInProgress = FALSE;
+
+                // Carry on from this battler once the AI has finished.
+                if (BattleAI_IsChoosingMoveOrAction())
+                {
+                    gBattleStruct->actionSelectionResumeBattler = battler;
+                    return;
+                }
             }
             // fallthrough
         case STATE_BEFORE_ACTION_CHOSEN: // Choose an action.
@@ -4608,6 +4622,7 @@ static void HandleTurnActionSelectionState(void)
                 gBattlescriptCurrInstr = gSelectionBattleScripts[battler];
                 if (!(gBattleControllerExecFlags & ((1u << battler) | (0xF << 28) | (1u << (battler + 4)) | (1u << (battler + 8)) | (1u << (battler + 12)))))
                 {
+                    TestRunner_RecordScriptCommand(gBattleScriptingCommandsTable, gBattlescriptCurrInstr);
                     gBattleScriptingCommandsTable[gBattlescriptCurrInstr[0]]();
                 }
                 gSelectionBattleScripts[battler] = gBattlescriptCurrInstr;
@@ -4640,6 +4655,7 @@ static void HandleTurnActionSelectionState(void)
                 gBattlescriptCurrInstr = gSelectionBattleScripts[battler];
                 if (!(gBattleControllerExecFlags & ((1u << battler) | (0xF << 28) | (1u << (battler + 4)) | (1u << (battler + 8)) | (1u << (battler + 12)))))
                 {
+                    TestRunner_RecordScriptCommand(gBattleScriptingCommandsTable, gBattlescriptCurrInstr);
                     gBattleScriptingCommandsTable[gBattlescriptCurrInstr[0]]();
                 }
                 gSelectionBattleScripts[battler] = gBattlescriptCurrInstr;
@@ -5619,7 +5635,10 @@ static void HandleEndTurn_FinishBattle(void)
     else
     {
         if (gBattleControllerExecFlags == 0)
+        {
+            TestRunner_RecordScriptCommand(gBattleScriptingCommandsTable, gBattlescriptCurrInstr);
             gBattleScriptingCommandsTable[gBattlescriptCurrInstr[0]]();
+        }
     }
 }
 
@@ -5762,14 +5781,20 @@ void RunBattleScriptCommands_PopCallbacksStack(void)
     else
     {
         if (gBattleControllerExecFlags == 0)
+        {
+            TestRunner_RecordScriptCommand(gBattleScriptingCommandsTable, gBattlescriptCurrInstr);
             gBattleScriptingCommandsTable[gBattlescriptCurrInstr[0]]();
+        }
     }
 }
 
 void RunBattleScriptCommands(void)
 {
     if (gBattleControllerExecFlags == 0)
+    {
+        TestRunner_RecordScriptCommand(gBattleScriptingCommandsTable, gBattlescriptCurrInstr);
         gBattleScriptingCommandsTable[gBattlescriptCurrInstr[0]]();
+    }
 }
 
 bool32 TrySetAteType(u32 move, u32 battlerAtk, u32 attackerAbility)
@@ -8458,7 +8458,10 @@ void ClearVariousBattlerFlags(u32 battler)
 void HandleAction_RunBattleScript(void) // identical to RunBattleScriptCommands
 {
     if (gBattleControllerExecFlags == 0)
+    {
+        TestRunner_RecordScriptCommand(gBattleScriptingCommandsTable, gBattlescriptCurrInstr);
         gBattleScriptingCommandsTable[*gBattlescriptCurrInstr]();
+    }
 }
 
 u32 SetRandomTarget(u32 battlerAtk)
@@ -32,12 +32,14 @@ void AllocateBattleResources(void)
     gBattleResources->aiData = AllocZeroed(sizeof(*gBattleResources->aiData));
     gBattleResources->aiParty = AllocZeroed(sizeof(*gBattleResources->aiParty));
     gBattleResources->battleHistory = AllocZeroed(sizeof(*gBattleResources->battleHistory));
+    gBattleResources->aiStateStack = AllocZeroed(sizeof(*gBattleResources->aiStateStack));
 
     gLinkBattleSendBuffer = AllocZeroed(BATTLE_BUFFER_LINK_SIZE);
     gLinkBattleRecvBuffer = AllocZeroed(BATTLE_BUFFER_LINK_SIZE);
 
     gBattleAnimBgTileBuffer = AllocZeroed(0x2000);
     gBattleAnimBgTilemapBuffer = AllocZeroed(0x1000);
+    AllocBattleAnimGfxCache();
 
     if (gBattleTypeFlags & BATTLE_TYPE_SECRET_BASE)
     {
@@ -64,6 +66,7 @@ void FreeBattleResources(void)
         FREE_AND_SET_NULL(gBattleResources->aiData);
         FREE_AND_SET_NULL(gBattleResources->aiParty);
         FREE_AND_SET_NULL(gBattleResources->battleHistory);
+        FREE_AND_SET_NULL(gBattleResources->aiStateStack);
         FREE_AND_SET_NULL(gBattleResources);
 
         FREE_AND_SET_NULL(gLinkBattleSendBuffer);
@@ -71,6 +74,7 @@ void FreeBattleResources(void)
 
         FREE_AND_SET_NULL(gBattleAnimBgTileBuffer);
         FREE_AND_SET_NULL(gBattleAnimBgTilemapBuffer);
+        FreeBattleAnimGfxCache();
     }
 }
 
@@ -3,6 +3,7 @@
 #include "multiboot.h"
 #include "malloc.h"
 #include "bg.h"
+#include "decompress.h"
 #include "graphics.h"
 #include "main.h"
 #include "sprite.h"
@@ -366,8 +367,8 @@ static void BerryFix_SetScene(int scene)
         break;
     }
     CopyBgTilemapBufferToVram(0);
-    LZ77UnCompVram(sBerryFixGraphics[scene].gfx, (void *)BG_CHAR_ADDR(1));
-    LZ77UnCompVram(sBerryFixGraphics[scene].tilemap, (void *)BG_SCREEN_ADDR(31));
+    LZDecompressVram(sBerryFixGraphics[scene].gfx, (void *)BG_CHAR_ADDR(1));
+    LZDecompressVram(sBerryFixGraphics[scene].tilemap, (void *)BG_SCREEN_ADDR(31));
     // These palettes range in size from 32-48 colors, so the below is interpreting whatever
     // follows the palette (by default, the corresponding tiles) as the remaining 80-96.
     CpuCopy32(sBerryFixGraphics[scene].palette, (void *)BG_PLTT, PLTT_SIZEOF(128));
@@ -1,6 +1,7 @@
 #include <limits.h>
 #include "global.h"
 #include "bg.h"
+#include "decompress.h"
 #include "dma3.h"
 #include "gpu_regs.h"
 #include "malloc.h"
@@ -874,7 +875,7 @@ void CopyToBgTilemapBuffer(u32 bg, const void *src, u32 mode, u32 destOffset)
         if (mode != 0)
             CpuCopy16(src, (void *)(sGpuBgConfigs2[bg].tilemap + (destOffset * 2)), mode);
         else
-            LZ77UnCompWram(src, (void *)(sGpuBgConfigs2[bg].tilemap + (destOffset * 2)));
+            LZDecompressWram(src, (void *)(sGpuBgConfigs2[bg].tilemap + (destOffset * 2)));
     }
 }
 
@@ -424,24 +424,24 @@ static void LoadContestPaintingFrame(u8 contestWinnerId, bool8 isForArtist)
         switch (gContestPaintingWinner->contestCategory / NUM_PAINTING_CAPTIONS)
         {
         case CONTEST_CATEGORY_COOL:
-            RLUnCompVram(sPictureFrameTiles_Cool, (void *)VRAM);
-            RLUnCompWram(sPictureFrameTilemap_Cool, gContestMonPixels);
+            RLDecompressVram(sPictureFrameTiles_Cool, (void *)VRAM);
+            RLDecompressWram(sPictureFrameTilemap_Cool, gContestMonPixels);
             break;
         case CONTEST_CATEGORY_BEAUTY:
-            RLUnCompVram(sPictureFrameTiles_Beauty, (void *)VRAM);
-            RLUnCompWram(sPictureFrameTilemap_Beauty, gContestMonPixels);
+            RLDecompressVram(sPictureFrameTiles_Beauty, (void *)VRAM);
+            RLDecompressWram(sPictureFrameTilemap_Beauty, gContestMonPixels);
             break;
         case CONTEST_CATEGORY_CUTE:
-            RLUnCompVram(sPictureFrameTiles_Cute, (void *)VRAM);
-            RLUnCompWram(sPictureFrameTilemap_Cute, gContestMonPixels);
+            RLDecompressVram(sPictureFrameTiles_Cute, (void *)VRAM);
+            RLDecompressWram(sPictureFrameTilemap_Cute, gContestMonPixels);
             break;
         case CONTEST_CATEGORY_SMART:
-            RLUnCompVram(sPictureFrameTiles_Smart, (void *)VRAM);
-            RLUnCompWram(sPictureFrameTilemap_Smart, gContestMonPixels);
+            RLDecompressVram(sPictureFrameTiles_Smart, (void *)VRAM);
+            RLDecompressWram(sPictureFrameTilemap_Smart, gContestMonPixels);
             break;
         case CONTEST_CATEGORY_TOUGH:
-            RLUnCompVram(sPictureFrameTiles_Tough, (void *)VRAM);
-            RLUnCompWram(sPictureFrameTilemap_Tough, gContestMonPixels);
+            RLDecompressVram(sPictureFrameTiles_Tough, (void *)VRAM);
+            RLDecompressWram(sPictureFrameTilemap_Tough, gContestMonPixels);
             break;
         }
 
@@ -466,8 +466,8 @@ static void LoadContestPaintingFrame(u8 contestWinnerId, bool8 isForArtist)
     else if (contestWinnerId < MUSEUM_CONTEST_WINNERS_START)
     {
         // Load Contest Hall lobby frame
-        RLUnCompVram(sPictureFrameTiles_HallLobby, (void *)VRAM);
-        RLUnCompVram(sPictureFrameTilemap_HallLobby, (void *)(BG_SCREEN_ADDR(12)));
+        RLDecompressVram(sPictureFrameTiles_HallLobby, (void *)VRAM);
+        RLDecompressVram(sPictureFrameTilemap_HallLobby, (void *)(BG_SCREEN_ADDR(12)));
     }
     else
     {
@@ -475,24 +475,24 @@ static void LoadContestPaintingFrame(u8 contestWinnerId, bool8 isForArtist)
         switch (gContestPaintingWinner->contestCategory / NUM_PAINTING_CAPTIONS)
         {
         case CONTEST_CATEGORY_COOL:
-            RLUnCompVram(sPictureFrameTiles_Cool, (void *)VRAM);
-            RLUnCompVram(sPictureFrameTilemap_Cool, (void *)(BG_SCREEN_ADDR(12)));
+            RLDecompressVram(sPictureFrameTiles_Cool, (void *)VRAM);
+            RLDecompressVram(sPictureFrameTilemap_Cool, (void *)(BG_SCREEN_ADDR(12)));
             break;
         case CONTEST_CATEGORY_BEAUTY:
-            RLUnCompVram(sPictureFrameTiles_Beauty, (void *)VRAM);
-            RLUnCompVram(sPictureFrameTilemap_Beauty, (void *)(BG_SCREEN_ADDR(12)));
+            RLDecompressVram(sPictureFrameTiles_Beauty, (void *)VRAM);
+            RLDecompressVram(sPictureFrameTilemap_Beauty, (void *)(BG_SCREEN_ADDR(12)));
             break;
         case CONTEST_CATEGORY_CUTE:
-            RLUnCompVram(sPictureFrameTiles_Cute, (void *)VRAM);
-            RLUnCompVram(sPictureFrameTilemap_Cute, (void *)(BG_SCREEN_ADDR(12)));
+            RLDecompressVram(sPictureFrameTiles_Cute, (void *)VRAM);
+            RLDecompressVram(sPictureFrameTilemap_Cute, (void *)(BG_SCREEN_ADDR(12)));
             break;
         case CONTEST_CATEGORY_SMART:
-            RLUnCompVram(sPictureFrameTiles_Smart, (void *)VRAM);
-            RLUnCompVram(sPictureFrameTilemap_Smart, (void *)(BG_SCREEN_ADDR(12)));
+            RLDecompressVram(sPictureFrameTiles_Smart, (void *)VRAM);
+            RLDecompressVram(sPictureFrameTilemap_Smart, (void *)(BG_SCREEN_ADDR(12)));
             break;
         case CONTEST_CATEGORY_TOUGH:
-            RLUnCompVram(sPictureFrameTiles_Tough, (void *)VRAM);
-            RLUnCompVram(sPictureFrameTilemap_Tough, (void *)(BG_SCREEN_ADDR(12)));
+            RLDecompressVram(sPictureFrameTiles_Tough, (void *)VRAM);
+            RLDecompressVram(sPictureFrameTilemap_Tough, (void *)(BG_SCREEN_ADDR(12)));
             break;
         }
     }
@@ -226,11 +226,4 @@ const union AnimCmd *const gAnims_Trainer[] ={
     sAnim_GeneralFrame0,
 };
 
-#include "data/trainer_parties.h"
-
-const struct Trainer gTrainers[DIFFICULTY_COUNT][TRAINERS_COUNT] =
-{
-#include "data/trainers.h"
-};
-
 #include "data/text/follower_messages.h"
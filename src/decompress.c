@@ -7,14 +7,252 @@
 #include "text.h"
 #include "menu.h"
 
-void LZDecompressWram(const u32 *src, void *dest)
+// The decompressors below read the same formats as the BIOS functions
+// (see https://problemkaputt.de/gbatek.htm#biosdecompressionfunctions)
+// and produce identical output, but run as ARM code from IWRAM.
+
+// The largest output of one LZ77 block: eight back-references of 18 bytes.
+#define LZ77_MAX_BLOCK_SIZE (8 * 18)
+
+// VRAM can't be written a byte at a time, so the VRAM decompressors
+// hold even bytes in `pending` until the odd byte of the pair is known.
+ARM_FUNC static inline void PutVramByte(u8 **dest, u32 *pending, u32 byte)
+{
+    if ((u32)*dest & 1)
+        *(vu16 *)(*dest - 1) = *pending | (byte << 8);
+    else
+        *pending = byte;
+    (*dest)++;
+}
+
+ARM_FUNC static inline void FlushVramByte(u8 *dest, u32 pending)
 {
-    LZ77UnCompWram(src, dest);
+    if ((u32)dest & 1)
+        *(vu16 *)(dest - 1) = (*(vu16 *)(dest - 1) & 0xFF00) | pending;
+}
+
+IWRAM_CODE void LZDecompressWram(const u32 *src, void *dest)
+{
+    struct LZ77Stream stream = {
+        .src = (const u8 *)src + 4,
+        .dest = dest,
+        .remaining = *src >> 8,
+    };
+
+    LZ77Stream_Decompress(&stream, stream.remaining);
+}
+
+IWRAM_CODE void LZDecompressVram(const u32 *src, void *dest)
+{
+    const u8 *in = (const u8 *)src + 4;
+    u8 *out = dest;
+    u8 *end = out + (*src >> 8);
+    u32 pending = 0;
+    u32 flags = 0;
+
+    while (out < end)
+    {
+        u32 i;
+
+        flags = *in++;
+        for (i = 0; i < 8 && out < end; i++, flags <<= 1)
+        {
+            if (flags & 0x80)
+            {
+                u32 length = (in[0] >> 4) + 3;
+                u32 displacement = (((in[0] & 0xF) << 8) | in[1]) + 1;
+
+                in += 2;
+                if (length > (u32)(end - out))
+                    length = end - out;
+                do
+                {
+                    // The byte before an odd address has not been written yet.
+                    if (displacement == 1 && ((u32)out & 1))
+                        PutVramByte(&out, &pending, pending);
+                    else
+                        PutVramByte(&out, &pending, *(out - displacement));
+                } while (--length);
+            }
+            else
+            {
+                PutVramByte(&out, &pending, *in++);
+            }
+        }
+    }
+    FlushVramByte(out, pending);
 }
 
-void LZDecompressVram(const u32 *src, void *dest)
+IWRAM_CODE void RLDecompressWram(const void *src, void *dest)
 {
-    LZ77UnCompVram(src, dest);
+    const u8 *in = (const u8 *)src + 4;
+    u8 *out = dest;
+    u8 *end = out + (in[-3] | (in[-2] << 8) | (in[-1] << 16));
+
+    while (out < end)
+    {
+        u32 flags = *in++;
+        u32 length;
+
+        if (flags & 0x80)
+        {
+            u32 byte = *in++;
+            length = (flags & 0x7F) + 3;
+            if (length > (u32)(end - out))
+                length = end - out;
+            do
+            {
+                *out++ = byte;
+            } while (--length);
+        }
+        else
+        {
+            length = (flags & 0x7F) + 1;
+            if (length > (u32)(end - out))
+                length = end - out;
+            do
+            {
+                *out++ = *in++;
+            } while (--length);
+        }
+    }
+}
+
+IWRAM_CODE void RLDecompressVram(const void *src, void *dest)
+{
+    const u8 *in = (const u8 *)src + 4;
+    u8 *out = dest;
+    u8 *end = out + (in[-3] | (in[-2] << 8) | (in[-1] << 16));
+    u32 pending = 0;
+
+    while (out < end)
+    {
+        u32 flags = *in++;
+        u32 length;
+
+        if (flags & 0x80)
+        {
+            u32 byte = *in++;
+            length = (flags & 0x7F) + 3;
+            if (length > (u32)(end - out))
+                length = end - out;
+            do
+            {
+                PutVramByte(&out, &pending, byte);
+            } while (--length);
+        }
+        else
+        {
+            length = (flags & 0x7F) + 1;
+            if (length > (u32)(end - out))
+                length = end - out;
+            do
+            {
+                PutVramByte(&out, &pending, *in++);
+            } while (--length);
+        }
+    }
+    FlushVramByte(out, pending);
+}
+
+// Resumable LZ77 decompression to WRAM, for loads that are spread across several frames.
+// The output must be in WRAM, since back-references are copied a byte at a time.
+void LZ77Stream_Init(struct LZ77Stream *stream, const u32 *src, void *dest)
+{
+    stream->src = (const u8 *)src + 4;
+    stream->dest = dest;
+    stream->remaining = GetDecompressedDataSize(src);
+    stream->displacement = 0;
+    stream->flags = 0;
+    stream->flagBitsLeft = 0;
+    stream->copyLeft = 0;
+}
+
+// Decompresses exactly `budget` bytes, or all of the remaining bytes if
+// there are fewer, stopping in the middle of a back-reference if needed.
+// Returns TRUE once all of the data has been decompressed.
+IWRAM_CODE bool32 LZ77Stream_Decompress(struct LZ77Stream *stream, u32 budget)
+{
+    const u8 *src = stream->src;
+    u8 *dest = stream->dest;
+    u32 displacement = stream->displacement;
+    u32 flags = stream->flags;
+    u32 flagBitsLeft = stream->flagBitsLeft;
+    u32 length = stream->copyLeft;
+    u8 *end;
+
+    if (budget > stream->remaining)
+        budget = stream->remaining;
+    stream->remaining -= budget;
+    end = dest + budget;
+
+    while (dest < end)
+    {
+        // Whole blocks which can't reach `end` skip the bounds checks.
+        if (flagBitsLeft == 0 && length == 0 && end - dest >= LZ77_MAX_BLOCK_SIZE)
+        {
+            u32 i;
+
+            flags = *src++;
+            for (i = 0; i < 8; i++, flags <<= 1)
+            {
+                if (flags & 0x80)
+                {
+                    length = (src[0] >> 4) + 3;
+                    displacement = (((src[0] & 0xF) << 8) | src[1]) + 1;
+                    src += 2;
+                    do
+                    {
+                        *dest = *(dest - displacement);
+                        dest++;
+                    } while (--length);
+                }
+                else
+                {
+                    *dest++ = *src++;
+                }
+            }
+            continue;
+        }
+
+        if (length == 0)
+        {
+            if (flagBitsLeft == 0)
+            {
+                flags = *src++;
+                flagBitsLeft = 8;
+            }
+            flagBitsLeft--;
+            flags <<= 1;
+            if (!(flags & 0x100))
+            {
+                *dest++ = *src++;
+                continue;
+            }
+            length = (src[0] >> 4) + 3;
+            displacement = (((src[0] & 0xF) << 8) | src[1]) + 1;
+            src += 2;
+        }
+
+        // Finish as much of the back-reference as fits before `end`.
+        {
+            u32 count = min(length, (u32)(end - dest));
+            length -= count;
+            do
+            {
+                *dest = *(dest - displacement);
+                dest++;
+            } while (--count);
+        }
+    }
+
+    stream->src = src;
+    stream->dest = dest;
+    stream->displacement = displacement;
+    stream->flags = flags;
+    stream->flagBitsLeft = flagBitsLeft;
+    stream->copyLeft = length;
+    return stream->remaining == 0;
 }
 
 // Checks if `ptr` is likely LZ77 data
@@ -95,20 +333,71 @@ u32 LoadCompressedSpritePaletteWithTag(const u32 *pal, u16 tag)
 {
     u32 index;
     struct SpritePalette dest;
-    void *buffer = malloc_and_decompress(pal, NULL);
+    void *buffer;
 
-    dest.data = buffer;
+    // LoadSpritePalette ignores the data of a loaded tag, so don't decompress it.
     dest.tag = tag;
+    if (IndexOfSpritePaletteTag(tag) != 0xFF)
+    {
+        dest.data = NULL;
+        return LoadSpritePalette(&dest);
+    }
+
+    buffer = malloc_and_decompress(pal, NULL);
+    dest.data = buffer;
     index = LoadSpritePalette(&dest);
     Free(buffer);
     return index;
 }
 
+// The compressed counterparts of AcquireSpritePalette and AcquireSpriteSheet,
+// which only decompress the data if the tag isn't loaded yet.
+u32 AcquireCompressedSpritePalette(const struct CompressedSpritePalette *src, bool32 shared)
+{
+    u32 index;
+    struct SpritePalette dest;
+    void *buffer;
+
+    dest.tag = src->tag;
+    if (IndexOfSpritePaletteTag(src->tag) != 0xFF)
+    {
+        dest.data = NULL;
+        return AcquireSpritePalette(&dest, shared);
+    }
+
+    buffer = malloc_and_decompress(src->data, NULL);
+    dest.data = buffer;
+    index = AcquireSpritePalette(&dest, shared);
+    Free(buffer);
+    return index;
+}
+
+u16 AcquireCompressedSpriteSheet(const struct CompressedSpriteSheet *src)
+{
+    u16 tileStart;
+    struct SpriteSheet dest;
+    void *buffer;
+
+    dest.size = src->size;
+    dest.tag = src->tag;
+    if (GetSpriteTileStartByTag(src->tag) != TAG_NONE)
+    {
+        dest.data = NULL;
+        return AcquireSpriteSheet(&dest);
+    }
+
+    buffer = malloc_and_decompress(src->data, NULL);
+    dest.data = buffer;
+    tileStart = AcquireSpriteSheet(&dest);
+    Free(buffer);
+    return tileStart;
+}
+
 void LoadCompressedSpritePaletteOverrideBuffer(const struct CompressedSpritePalette *src, void *buffer)
 {
     struct SpritePalette dest;
 
-    LZ77UnCompWram(src->data, buffer);
+    LZDecompressWram(src->data, buffer);
     dest.data = buffer;
     dest.tag = src->tag;
     LoadSpritePalette(&dest);
@@ -116,7 +405,7 @@ void LoadCompressedSpritePaletteOverrideBuffer(const struct CompressedSpritePale
 
 void DecompressPicFromTable(const struct CompressedSpriteSheet *src, void *buffer)
 {
-    LZ77UnCompWram(src->data, buffer);
+    LZDecompressWram(src->data, buffer);
 }
 
 void HandleLoadSpecialPokePic(bool32 isFrontPic, void *dest, s32 species, u32 personality)
@@ -134,25 +423,25 @@ void LoadSpecialPokePic(void *dest, s32 species, u32 personality, bool8 isFrontP
     {
     #if P_GENDER_DIFFERENCES
         if (gSpeciesInfo[species].frontPicFemale != NULL && IsPersonalityFemale(species, personality))
-            LZ77UnCompWram(gSpeciesInfo[species].frontPicFemale, dest);
+            LZDecompressWram(gSpeciesInfo[species].frontPicFemale, dest);
         else
     #endif
         if (gSpeciesInfo[species].frontPic != NULL)
-            LZ77UnCompWram(gSpeciesInfo[species].frontPic, dest);
+            LZDecompressWram(gSpeciesInfo[species].frontPic, dest);
         else
-            LZ77UnCompWram(gSpeciesInfo[SPECIES_NONE].frontPic, dest);
+            LZDecompressWram(gSpeciesInfo[SPECIES_NONE].frontPic, dest);
     }
     else
     {
     #if P_GENDER_DIFFERENCES
         if (gSpeciesInfo[species].backPicFemale != NULL && IsPersonalityFemale(species, personality))
-            LZ77UnCompWram(gSpeciesInfo[species].backPicFemale, dest);
+            LZDecompressWram(gSpeciesInfo[species].backPicFemale, dest);
         else
     #endif
         if (gSpeciesInfo[species].backPic != NULL)
-            LZ77UnCompWram(gSpeciesInfo[species].backPic, dest);
+            LZDecompressWram(gSpeciesInfo[species].backPic, dest);
         else
-            LZ77UnCompWram(gSpeciesInfo[SPECIES_NONE].backPic, dest);
+            LZDecompressWram(gSpeciesInfo[SPECIES_NONE].backPic, dest);
     }
 
     if (species == SPECIES_SPINDA && isFrontPic)
@@ -164,7 +453,7 @@ void LoadSpecialPokePic(void *dest, s32 species, u32 personality, bool8 isFrontP
 
 void Unused_LZDecompressWramIndirect(const void **src, void *dest)
 {
-    LZ77UnCompWram(*src, dest);
+    LZDecompressWram(*src, dest);
 }
 
 static void UNUSED StitchObjectsOn8x8Canvas(s32 object_size, s32 object_count, u8 *src_tiles, u8 *dest_tiles)
@@ -328,7 +617,7 @@ bool8 LoadCompressedSpriteSheetUsingHeap(const struct CompressedSpriteSheet *src
     void *buffer;
 
     buffer = AllocZeroed(src->data[0] >> 8);
-    LZ77UnCompWram(src->data, buffer);
+    LZDecompressWram(src->data, buffer);
 
     dest.data = buffer;
     dest.size = src->size;
@@ -345,7 +634,7 @@ bool8 LoadCompressedSpritePaletteUsingHeap(const struct CompressedSpritePalette
     void *buffer;
 
     buffer = AllocZeroed(src->data[0] >> 8);
-    LZ77UnCompWram(src->data, buffer);
+    LZDecompressWram(src->data, buffer);
     dest.data = buffer;
     dest.tag = src->tag;
 
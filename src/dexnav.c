@@ -1519,9 +1519,7 @@ static u8 GetEncounterLevelFromMapData(u16 species, u8 environment)
     const struct WildPokemonInfo *landMonsInfo = gWildMonHeaders[headerId].landMonsInfo;
     const struct WildPokemonInfo *waterMonsInfo = gWildMonHeaders[headerId].waterMonsInfo;
     const struct WildPokemonInfo *hiddenMonsInfo = gWildMonHeaders[headerId].hiddenMonsInfo;
-    u8 min = 100;
-    u8 max = 0;
-    u8 i;
+    const struct WildSpeciesEncounter *encounter;
 
     switch (environment)
     {
@@ -1529,40 +1527,19 @@ static u8 GetEncounterLevelFromMapData(u16 species, u8 environment)
         if (landMonsInfo == NULL)
             return MON_LEVEL_NONEXISTENT; //Hidden pokemon should only appear on walkable tiles or surf tiles
 
-        for (i = 0; i < LAND_WILD_COUNT; i++)
-        {
-            if (landMonsInfo->wildPokemon[i].species == species)
-            {
-                min = (min < landMonsInfo->wildPokemon[i].minLevel) ? min : landMonsInfo->wildPokemon[i].minLevel;
-                max = (max > landMonsInfo->wildPokemon[i].maxLevel) ? max : landMonsInfo->wildPokemon[i].maxLevel;
-            }
-        }
+        encounter = GetWildSpeciesEncounter(headerId, WILD_AREA_LAND, species);
         break;
     case ENCOUNTER_TYPE_WATER:    //water
         if (waterMonsInfo == NULL)
             return MON_LEVEL_NONEXISTENT; //Hidden pokemon should only appear on walkable tiles or surf tiles
 
-        for (i = 0; i < WATER_WILD_COUNT; i++)
-        {
-            if (waterMonsInfo->wildPokemon[i].species == species)
-            {
-                min = (min < waterMonsInfo->wildPokemon[i].minLevel) ? min : waterMonsInfo->wildPokemon[i].minLevel;
-                max = (max > waterMonsInfo->wildPokemon[i].maxLevel) ? max : waterMonsInfo->wildPokemon[i].maxLevel;
-            }
-        }
+        encounter = GetWildSpeciesEncounter(headerId, WILD_AREA_WATER, species);
         break;
     case ENCOUNTER_TYPE_HIDDEN:
         if (hiddenMonsInfo == NULL)
             return MON_LEVEL_NONEXISTENT;
 
-        for (i = 0; i < HIDDEN_WILD_COUNT; i++)
-        {
-            if (hiddenMonsInfo->wildPokemon[i].species == species)
-            {
-                min = (min < hiddenMonsInfo->wildPokemon[i].minLevel) ? min : hiddenMonsInfo->wildPokemon[i].minLevel;
-                max = (max > hiddenMonsInfo->wildPokemon[i].maxLevel) ? max : hiddenMonsInfo->wildPokemon[i].maxLevel;
-            }
-        }
+        encounter = GetWildSpeciesEncounter(headerId, WILD_AREA_HIDDEN, species);
 
         // use encounter rate to signify is hidden pokemon are on land or in water
         if (hiddenMonsInfo->encounterRate == 1)
@@ -1574,10 +1551,10 @@ static u8 GetEncounterLevelFromMapData(u16 species, u8 environment)
         return MON_LEVEL_NONEXISTENT;
     }
 
-    if (max == 0)
+    if (encounter == NULL || encounter->maxLevel == 0)
         return MON_LEVEL_NONEXISTENT;
 
-    return RandomUniform(RNG_DEXNAV_ENCOUNTER_LEVEL, min, max);
+    return RandomUniform(RNG_DEXNAV_ENCOUNTER_LEVEL, encounter->minLevel, encounter->maxLevel);
 }
 
 
@@ -1929,6 +1906,7 @@ static bool8 SpeciesInArray(u16 species, u8 section)
 }
 
 // get unique wild encounters on current map
+// walks the map's slots instead of the species index: the icons follow slot order, and forms are merged by dex number
 static void DexNavLoadEncounterData(void)
 {
     u8 grassIndex = 0;
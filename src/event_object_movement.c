@@ -110,6 +110,7 @@ static u8 setup##_callback(struct ObjectEvent *objectEvent, struct Sprite *sprit
 static EWRAM_DATA u8 sCurrentReflectionType = 0;
 static EWRAM_DATA u16 sCurrentSpecialObjectPaletteTag = 0;
 static EWRAM_DATA struct LockedAnimObjectEvents *sLockedAnimObjectEvents = {0};
+static EWRAM_DATA struct ObjectEventSpatialIndex sObjectEventIndex = {0};
 
 static void MoveCoordsInDirection(u32, s16 *, s16 *, s16, s16);
 static bool8 ObjectEventExecSingleMovementAction(struct ObjectEvent *, struct Sprite *);
@@ -1294,6 +1295,54 @@ static const u8 sPlayerDirectionToCopyDirection[][4] = {
 
 #include "data/object_events/movement_action_func_tables.h"
 
+// Object events are bucketed by the low bits of their current and previous coords,
+// and by the low bits of their localId. Each bucket is a mask of object event ids,
+// so position and localId lookups only have to check the few objects in one bucket
+// instead of scanning all of gObjectEvents.
+static void UnindexObjectEvent(u32 objectEventId)
+{
+    u32 bit = 1u << objectEventId;
+
+    if (!(sObjectEventIndex.indexed & bit))
+        return;
+
+    sObjectEventIndex.coordBuckets[sObjectEventIndex.currentBucket[objectEventId]] &= ~bit;
+    sObjectEventIndex.coordBuckets[sObjectEventIndex.previousBucket[objectEventId]] &= ~bit;
+    sObjectEventIndex.localIdBuckets[sObjectEventIndex.localIdBucket[objectEventId]] &= ~bit;
+    sObjectEventIndex.indexed &= ~bit;
+}
+
+void UpdateObjectEventSpatialIndex(struct ObjectEvent *objectEvent)
+{
+    u32 objectEventId = objectEvent - gObjectEvents;
+    u32 bit = 1u << objectEventId;
+    u32 currentBucket, previousBucket, localIdBucket;
+
+    UnindexObjectEvent(objectEventId);
+    if (!objectEvent->active)
+        return;
+
+    currentBucket = OBJ_EVENT_COORD_BUCKET(objectEvent->currentCoords.x, objectEvent->currentCoords.y);
+    previousBucket = OBJ_EVENT_COORD_BUCKET(objectEvent->previousCoords.x, objectEvent->previousCoords.y);
+    localIdBucket = OBJ_EVENT_LOCAL_ID_BUCKET(objectEvent->localId);
+    sObjectEventIndex.coordBuckets[currentBucket] |= bit;
+    sObjectEventIndex.coordBuckets[previousBucket] |= bit;
+    sObjectEventIndex.localIdBuckets[localIdBucket] |= bit;
+    sObjectEventIndex.currentBucket[objectEventId] = currentBucket;
+    sObjectEventIndex.previousBucket[objectEventId] = previousBucket;
+    sObjectEventIndex.localIdBucket[objectEventId] = localIdBucket;
+    sObjectEventIndex.indexed |= bit;
+}
+
+void RebuildObjectEventSpatialIndex(void)
+{
+    u32 i;
+
+    sObjectEventIndex = (struct ObjectEventSpatialIndex){};
+    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+        UpdateObjectEventSpatialIndex(&gObjectEvents[i]);
+}
+
 static void ClearObjectEvent(struct ObjectEvent *objectEvent)
 {
     *objectEvent = (struct ObjectEvent){};
@@ -1301,6 +1350,7 @@ static void ClearObjectEvent(struct ObjectEvent *objectEvent)
     objectEvent->mapNum = MAP_NUM(UNDEFINED);
     objectEvent->mapGroup = MAP_GROUP(UNDEFINED);
     objectEvent->movementActionId = MOVEMENT_ACTION_NONE;
+    UnindexObjectEvent(objectEvent - gObjectEvents);
 }
 
 static void ClearAllObjectEvents(void)
@@ -1309,6 +1359,7 @@ static void ClearAllObjectEvents(void)
 
     for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
         ClearObjectEvent(&gObjectEvents[i]);
+    sObjectEventIndex = (struct ObjectEventSpatialIndex){};
 }
 
 void ResetObjectEvents(void)
@@ -1365,22 +1416,26 @@ bool8 TryGetObjectEventIdByLocalIdAndMap(u8 localId, u8 mapNum, u8 mapGroupId, u
 
 u8 GetObjectEventIdByXY(s16 x, s16 y)
 {
-    u8 i;
-    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    u32 i;
+    u32 candidates = sObjectEventIndex.coordBuckets[OBJ_EVENT_COORD_BUCKET(x, y)];
+
+    for (i = 0; candidates != 0; i++, candidates >>= 1)
     {
-        if (gObjectEvents[i].active && gObjectEvents[i].currentCoords.x == x && gObjectEvents[i].currentCoords.y == y)
-            break;
+        if ((candidates & 1) && gObjectEvents[i].active && gObjectEvents[i].currentCoords.x == x && gObjectEvents[i].currentCoords.y == y)
+            return i;
     }
 
-    return i;
+    return OBJECT_EVENTS_COUNT;
 }
 
 static u8 GetObjectEventIdByLocalIdAndMapInternal(u8 localId, u8 mapNum, u8 mapGroupId)
 {
-    u8 i;
-    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    u32 i;
+    u32 candidates = sObjectEventIndex.localIdBuckets[OBJ_EVENT_LOCAL_ID_BUCKET(localId)];
+
+    for (i = 0; candidates != 0; i++, candidates >>= 1)
     {
-        if (gObjectEvents[i].active && gObjectEvents[i].localId == localId && gObjectEvents[i].mapNum == mapNum && gObjectEvents[i].mapGroup == mapGroupId)
+        if ((candidates & 1) && gObjectEvents[i].active && gObjectEvents[i].localId == localId && gObjectEvents[i].mapNum == mapNum && gObjectEvents[i].mapGroup == mapGroupId)
             return i;
     }
 
@@ -1389,10 +1444,12 @@ static u8 GetObjectEventIdByLocalIdAndMapInternal(u8 localId, u8 mapNum, u8 mapG
 
 u8 GetObjectEventIdByLocalId(u8 localId)
 {
-    u8 i;
-    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    u32 i;
+    u32 candidates = sObjectEventIndex.localIdBuckets[OBJ_EVENT_LOCAL_ID_BUCKET(localId)];
+
+    for (i = 0; candidates != 0; i++, candidates >>= 1)
     {
-        if (gObjectEvents[i].active && gObjectEvents[i].localId == localId)
+        if ((candidates & 1) && gObjectEvents[i].active && gObjectEvents[i].localId == localId)
             return i;
     }
 
@@ -1449,6 +1506,7 @@ static u8 InitObjectEventStateFromTemplate(const struct ObjectEventTemplate *tem
         if (objectEvent->rangeY == 0)
             objectEvent->rangeY++;
     }
+    UpdateObjectEventSpatialIndex(objectEvent);
     return objectEventId;
 }
 
@@ -1484,27 +1542,21 @@ static bool8 GetAvailableObjectEventId(u16 localId, u8 mapNum, u8 mapGroup, u8 *
 // If no slots are available, or if the object is already
 // loaded, returns TRUE.
 {
-    u8 i = 0;
+    u8 i;
 
-    for (i = 0; i < OBJECT_EVENTS_COUNT && gObjectEvents[i].active; i++)
-    {
-        if (gObjectEvents[i].localId == localId && gObjectEvents[i].mapNum == mapNum && gObjectEvents[i].mapGroup == mapGroup)
-            return TRUE;
-    }
+    if (GetObjectEventIdByLocalIdAndMapInternal(localId, mapNum, mapGroup) != OBJECT_EVENTS_COUNT)
+        return TRUE;
+    i = GetFirstInactiveObjectEventId();
     if (i >= OBJECT_EVENTS_COUNT)
         return TRUE;
     *objectEventId = i;
-    for (; i < OBJECT_EVENTS_COUNT; i++)
-    {
-        if (gObjectEvents[i].active && gObjectEvents[i].localId == localId && gObjectEvents[i].mapNum == mapNum && gObjectEvents[i].mapGroup == mapGroup)
-            return TRUE;
-    }
     return FALSE;
 }
 
 static void RemoveObjectEvent(struct ObjectEvent *objectEvent)
 {
     objectEvent->active = FALSE;
+    UpdateObjectEventSpatialIndex(objectEvent);
     RemoveObjectEventInternal(objectEvent);
     // zero potential species info
     objectEvent->graphicsId = objectEvent->shiny = 0;
@@ -1697,6 +1749,7 @@ static u8 TrySetupObjectEventSprite(const struct ObjectEventTemplate *objectEven
     if (spriteId == MAX_SPRITES)
     {
         gObjectEvents[objectEventId].active = FALSE;
+        UpdateObjectEventSpatialIndex(&gObjectEvents[objectEventId]);
         return OBJECT_EVENTS_COUNT;
     }
 
@@ -1995,7 +2048,10 @@ static const struct ObjectEventGraphicsInfo *SpeciesToGraphicsInfo(u32 species,
     return graphicsInfo;
 }
 
-// Find, or load, the palette for the specified pokemon info
+// Find, or load, the palette for the specified pokemon info.
+// A palette is only acquired when its tag isn't loaded yet, so each tag holds
+// one reference, which FieldEffectFreePaletteIfUnused drops along with the
+// slot once no sprite uses it.
 static u32 LoadDynamicFollowerPalette(u32 species, bool32 shiny, bool32 female)
 {
     u32 paletteNum;
@@ -2038,11 +2094,11 @@ static u32 LoadDynamicFollowerPalette(u32 species, bool32 shiny, bool32 female)
 
             compSpritePalette.data = (const void *) spritePalette.data;
             compSpritePalette.tag = spritePalette.tag;
-            paletteNum = LoadCompressedSpritePalette(&compSpritePalette);
+            paletteNum = AcquireCompressedSpritePalette(&compSpritePalette, TRUE);
         }
         else
         {
-            paletteNum = LoadSpritePalette(&spritePalette);
+            paletteNum = AcquireSpritePalette(&spritePalette, TRUE);
         }
     }
     else
@@ -2051,15 +2107,19 @@ static u32 LoadDynamicFollowerPalette(u32 species, bool32 shiny, bool32 female)
         // Note that the shiny palette tag is `species + SPECIES_SHINY_TAG`, which must be increased with more pokemon
         // so that palette tags do not overlap
         const u32 *palette = GetMonSpritePalFromSpecies(species, shiny, female); //ETODO
+        struct CompressedSpritePalette compSpritePalette = {palette, species};
         // palette already loaded
         if ((paletteNum = IndexOfSpritePaletteTag(species)) < 16)
             return paletteNum;
-        // Use matching front sprite's normal/shiny palettes
-        // Load compressed palette
-        LoadCompressedSpritePaletteWithTag(palette, species);
-        paletteNum = IndexOfSpritePaletteTag(species); // Tag is always present
+        // Use matching front sprite's normal/shiny palettes, sharing
+        // a slot with any other species whose palette is identical.
+        paletteNum = AcquireCompressedSpritePalette(&compSpritePalette, TRUE);
     }
 
+    // Out of palette slots; show the wrong colors rather than an invalid palette.
+    if (paletteNum == 0xFF)
+        return 0;
+
     if (gWeatherPtr->currWeather != WEATHER_FOG_HORIZONTAL) // don't want to weather blend in fog
         UpdateSpritePaletteWithWeather(paletteNum);
     return paletteNum;
@@ -2387,6 +2447,182 @@ bool32 CheckMsgInfo(const struct FollowerMsgInfoExtended *info, struct Pokemon *
     }
 }
 
+// The conditional follower messages which can only match one species,
+// type, map or map section are indexed by it, so that talking to the
+// follower only checks the messages which could match.
+#define FOLLOWER_MSG_KEY_SPECIES 0
+#define FOLLOWER_MSG_KEY_MAP     1
+#define FOLLOWER_MSG_KEY_MAPSEC  2
+#define FOLLOWER_MSG_KEY(kind, value) (((kind) << 24) | (value))
+
+// Messages with more keys than this are always checked instead.
+#define MAX_FOLLOWER_MSG_KEYS (COND_MSG_COUNT * 2)
+
+struct FollowerMsgKey
+{
+    u32 key;
+    u16 msgId;
+};
+
+static EWRAM_DATA struct
+{
+    bool8 isBuilt;
+    u16 keyCount;
+    struct FollowerMsgKey keys[MAX_FOLLOWER_MSG_KEYS]; // Sorted by key.
+    u32 byType[NUMBER_OF_MON_TYPES][COND_MSG_WORDS];
+    u32 unindexed[COND_MSG_WORDS];
+} sFollowerMsgIndex = {0};
+
+static u32 CountMsgConditions(const struct FollowerMsgInfoExtended *info)
+{
+    u32 i;
+    for (i = 0; i < ARRAY_COUNT(info->conditions) && info->conditions[i].type; i++)
+        ;
+    return i;
+}
+
+static u32 CountMsgConditionKeys(const struct MsgCondition *cond)
+{
+    switch (cond->type)
+    {
+    case MSG_COND_SPECIES:
+    case MSG_COND_MAP:
+    case MSG_COND_MAPSEC:
+        return 1;
+    case MSG_COND_TYPE:
+        // MATCH_NOT_TYPES can't be indexed by type.
+        if (cond->data.bytes[2] == 0
+         && cond->data.bytes[0] < NUMBER_OF_MON_TYPES
+         && cond->data.bytes[1] < NUMBER_OF_MON_TYPES)
+            return 0;
+        // fallthrough
+    default:
+        return MAX_FOLLOWER_MSG_KEYS + 1;
+    }
+}
+
+static void AddMsgConditionKeys(const struct MsgCondition *cond, u32 msgId)
+{
+    u32 key;
+
+    switch (cond->type)
+    {
+    case MSG_COND_SPECIES:
+        key = FOLLOWER_MSG_KEY(FOLLOWER_MSG_KEY_SPECIES, cond->data.raw);
+        break;
+    case MSG_COND_MAP:
+        key = FOLLOWER_MSG_KEY(FOLLOWER_MSG_KEY_MAP, (cond->data.bytes[0] << 8) | cond->data.bytes[1]);
+        break;
+    case MSG_COND_MAPSEC:
+        key = FOLLOWER_MSG_KEY(FOLLOWER_MSG_KEY_MAPSEC, cond->data.raw);
+        break;
+    case MSG_COND_TYPE:
+    default:
+        sFollowerMsgIndex.byType[cond->data.bytes[0]][msgId / 32] |= 1u << (msgId % 32);
+        sFollowerMsgIndex.byType[cond->data.bytes[1]][msgId / 32] |= 1u << (msgId % 32);
+        return;
+    }
+
+    sFollowerMsgIndex.keys[sFollowerMsgIndex.keyCount].key = key;
+    sFollowerMsgIndex.keys[sFollowerMsgIndex.keyCount].msgId = msgId;
+    sFollowerMsgIndex.keyCount++;
+}
+
+static void BuildFollowerMsgIndex(void)
+{
+    u32 i, j, count, keys;
+
+    for (i = 0; i < COND_MSG_COUNT; i++)
+    {
+        const struct FollowerMsgInfoExtended *info = &gFollowerConditionalMessages[i];
+
+        count = CountMsgConditions(info);
+        if (info->orFlag)
+        {
+            // Any condition can match, so each of them must be indexed.
+            for (j = 0, keys = 0; j < count; j++)
+                keys += CountMsgConditionKeys(&info->conditions[j]);
+            if (count != 0 && sFollowerMsgIndex.keyCount + keys <= MAX_FOLLOWER_MSG_KEYS)
+            {
+                for (j = 0; j < count; j++)
+                    AddMsgConditionKeys(&info->conditions[j], i);
+                continue;
+            }
+        }
+        else
+        {
+            // Every condition must match, so one of them is enough. It
+            // must come before any MSG_COND_NEAR_MB, because CheckMsgInfo
+            // stops at the first one that fails, and that one sets
+            // gSpecialVar_Result.
+            for (j = 0; j < count && info->conditions[j].type != MSG_COND_NEAR_MB; j++)
+            {
+                keys = CountMsgConditionKeys(&info->conditions[j]);
+                if (sFollowerMsgIndex.keyCount + keys <= MAX_FOLLOWER_MSG_KEYS)
+                    break;
+            }
+            if (j < count && info->conditions[j].type != MSG_COND_NEAR_MB)
+            {
+                AddMsgConditionKeys(&info->conditions[j], i);
+                continue;
+            }
+        }
+
+        sFollowerMsgIndex.unindexed[i / 32] |= 1u << (i % 32);
+    }
+
+    // Insertion sort, the keys are only sorted once.
+    for (i = 1; i < sFollowerMsgIndex.keyCount; i++)
+    {
+        struct FollowerMsgKey key = sFollowerMsgIndex.keys[i];
+        for (j = i; j > 0 && sFollowerMsgIndex.keys[j - 1].key > key.key; j--)
+            sFollowerMsgIndex.keys[j] = sFollowerMsgIndex.keys[j - 1];
+        sFollowerMsgIndex.keys[j] = key;
+    }
+
+    sFollowerMsgIndex.isBuilt = TRUE;
+}
+
+static void AddFollowerMsgCandidates(u32 key, u32 *candidates)
+{
+    u32 lo = 0, hi = sFollowerMsgIndex.keyCount;
+
+    while (lo < hi)
+    {
+        u32 mid = (lo + hi) / 2;
+        if (sFollowerMsgIndex.keys[mid].key < key)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    for (; lo < sFollowerMsgIndex.keyCount && sFollowerMsgIndex.keys[lo].key == key; lo++)
+    {
+        u32 msgId = sFollowerMsgIndex.keys[lo].msgId;
+        candidates[msgId / 32] |= 1u << (msgId % 32);
+    }
+}
+
+// Sets the bits of the conditional messages which could match 'species'
+// on the current map. CheckMsgInfo is false for all of the others.
+void GetFollowerMsgCandidates(u32 species, u32 *candidates)
+{
+    u32 i;
+
+    if (!sFollowerMsgIndex.isBuilt)
+        BuildFollowerMsgIndex();
+
+    for (i = 0; i < COND_MSG_WORDS; i++)
+    {
+        candidates[i] = sFollowerMsgIndex.unindexed[i]
+                      | sFollowerMsgIndex.byType[gSpeciesInfo[species].types[0]][i]
+                      | sFollowerMsgIndex.byType[gSpeciesInfo[species].types[1]][i];
+    }
+    AddFollowerMsgCandidates(FOLLOWER_MSG_KEY(FOLLOWER_MSG_KEY_SPECIES, species), candidates);
+    AddFollowerMsgCandidates(FOLLOWER_MSG_KEY(FOLLOWER_MSG_KEY_MAP, (gSaveBlock1Ptr->location.mapGroup << 8) | gSaveBlock1Ptr->location.mapNum), candidates);
+    AddFollowerMsgCandidates(FOLLOWER_MSG_KEY(FOLLOWER_MSG_KEY_MAPSEC, gMapHeader.regionMapSectionId), candidates);
+}
+
 // Call an applicable follower message script
 void GetFollowerAction(struct ScriptContext *ctx) // Essentially a big switch for follower messages
 {
@@ -2412,6 +2648,7 @@ void GetFollowerAction(struct ScriptContext *ctx) // Essentially a big switch fo
         [FOLLOWER_EMOTION_POISONED] = 0,
     };
     u32 i, j;
+    u32 candidates[COND_MSG_WORDS];
     bool32 pickedCondition = FALSE;
     if (mon == NULL) // failsafe
     {
@@ -2523,9 +2760,12 @@ void GetFollowerAction(struct ScriptContext *ctx) // Essentially a big switch fo
             multi = condEmotes[i].index;
     }
     // (50% chance) Match *scripted* conditional messages, from follower_helper.c
+    GetFollowerMsgCandidates(species, candidates);
     for (i = (Random() & 1) ? COND_MSG_COUNT : 0, j = 1; i < COND_MSG_COUNT; i++)
     {
         const struct FollowerMsgInfoExtended *info = &gFollowerConditionalMessages[i];
+        if (!(candidates[i / 32] & (1u << (i % 32))))
+            continue;
         if (!CheckMsgInfo(info, mon, species, objEvent))
             continue;
 
@@ -3075,6 +3315,7 @@ static void UNUSED IncrementObjectEventCoords(struct ObjectEvent *objectEvent, s
     objectEvent->previousCoords.y = objectEvent->currentCoords.y;
     objectEvent->currentCoords.x += x;
     objectEvent->currentCoords.y += y;
+    UpdateObjectEventSpatialIndex(objectEvent);
 }
 
 void ShiftObjectEventCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
@@ -3083,6 +3324,7 @@ void ShiftObjectEventCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
     objectEvent->previousCoords.y = objectEvent->currentCoords.y;
     objectEvent->currentCoords.x = x;
     objectEvent->currentCoords.y = y;
+    UpdateObjectEventSpatialIndex(objectEvent);
 }
 
 static void SetObjectEventCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
@@ -3091,6 +3333,7 @@ static void SetObjectEventCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
     objectEvent->previousCoords.y = y;
     objectEvent->currentCoords.x = x;
     objectEvent->currentCoords.y = y;
+    UpdateObjectEventSpatialIndex(objectEvent);
 }
 
 void MoveObjectEventToMapCoords(struct ObjectEvent *objectEvent, s16 x, s16 y)
@@ -3149,16 +3392,18 @@ void UpdateObjectEventCoordsForCameraUpdate(void)
                 gObjectEvents[i].previousCoords.y -= dy;
             }
         }
+        RebuildObjectEventSpatialIndex();
     }
 }
 
 u8 GetObjectEventIdByPosition(u16 x, u16 y, u8 elevation)
 {
-    u8 i;
+    u32 i;
+    u32 candidates = sObjectEventIndex.coordBuckets[OBJ_EVENT_COORD_BUCKET(x, y)];
 
-    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    for (i = 0; candidates != 0; i++, candidates >>= 1)
     {
-        if (gObjectEvents[i].active)
+        if ((candidates & 1) && gObjectEvents[i].active)
         {
             if (gObjectEvents[i].currentCoords.x == x
              && gObjectEvents[i].currentCoords.y == y
@@ -6237,7 +6482,7 @@ static bool8 IsMetatileDirectionallyImpassable(struct ObjectEvent *objectEvent,
 
 u32 GetObjectObjectCollidesWith(struct ObjectEvent *objectEvent, s16 x, s16 y, bool32 addCoords)
 {
-    u8 i;
+    u32 i, candidates;
     struct ObjectEvent *curObject;
 
     if (objectEvent->localId == OBJ_EVENT_ID_FOLLOWER)
@@ -6249,8 +6494,11 @@ u32 GetObjectObjectCollidesWith(struct ObjectEvent *objectEvent, s16 x, s16 y, b
         y += objectEvent->currentCoords.y;
     }
 
-    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    candidates = sObjectEventIndex.coordBuckets[OBJ_EVENT_COORD_BUCKET(x, y)];
+    for (i = 0; candidates != 0; i++, candidates >>= 1)
     {
+        if (!(candidates & 1))
+            continue;
         curObject = &gObjectEvents[i];
         if (curObject->active && (curObject->movementType != MOVEMENT_TYPE_FOLLOW_PLAYER || objectEvent != &gObjectEvents[gPlayerAvatar.objectEventId]) && curObject != objectEvent)
         {
@@ -9345,25 +9593,25 @@ static void GetGroundEffectFlags_Reflection(struct ObjectEvent *objEvent, u32 *f
 
 static void GetGroundEffectFlags_TallGrassOnSpawn(struct ObjectEvent *objEvent, u32 *flags)
 {
-    if (MetatileBehavior_IsTallGrass(objEvent->currentMetatileBehavior))
+    if (MetatileBehavior_GetProperties(objEvent->currentMetatileBehavior) & MB_PROP_TALL_GRASS)
         *flags |= GROUND_EFFECT_FLAG_TALL_GRASS_ON_SPAWN;
 }
 
 static void GetGroundEffectFlags_TallGrassOnBeginStep(struct ObjectEvent *objEvent, u32 *flags)
 {
-    if (MetatileBehavior_IsTallGrass(objEvent->currentMetatileBehavior))
+    if (MetatileBehavior_GetProperties(objEvent->currentMetatileBehavior) & MB_PROP_TALL_GRASS)
         *flags |= GROUND_EFFECT_FLAG_TALL_GRASS_ON_MOVE;
 }
 
 static void GetGroundEffectFlags_LongGrassOnSpawn(struct ObjectEvent *objEvent, u32 *flags)
 {
-    if (MetatileBehavior_IsLongGrass(objEvent->currentMetatileBehavior))
+    if (MetatileBehavior_GetProperties(objEvent->currentMetatileBehavior) & MB_PROP_LONG_GRASS)
         *flags |= GROUND_EFFECT_FLAG_LONG_GRASS_ON_SPAWN;
 }
 
 static void GetGroundEffectFlags_LongGrassOnBeginStep(struct ObjectEvent *objEvent, u32 *flags)
 {
-    if (MetatileBehavior_IsLongGrass(objEvent->currentMetatileBehavior))
+    if (MetatileBehavior_GetProperties(objEvent->currentMetatileBehavior) & MB_PROP_LONG_GRASS)
         *flags |= GROUND_EFFECT_FLAG_LONG_GRASS_ON_MOVE;
 }
 
@@ -9372,17 +9620,17 @@ static void GetGroundEffectFlags_Tracks(struct ObjectEvent *objEvent, u32 *flags
     if (objEvent->directionOverwrite)
         return;
 
-    if (MetatileBehavior_IsDeepSand(objEvent->previousMetatileBehavior))
+    u32 previous = MetatileBehavior_GetProperties(objEvent->previousMetatileBehavior);
+
+    if (previous & MB_PROP_DEEP_SAND)
         *flags |= GROUND_EFFECT_FLAG_DEEP_SAND;
-    else if (MetatileBehavior_IsSandOrDeepSand(objEvent->previousMetatileBehavior)
-             || MetatileBehavior_IsFootprints(objEvent->previousMetatileBehavior))
+    else if (previous & (MB_PROP_SAND | MB_PROP_FOOTPRINTS))
         *flags |= GROUND_EFFECT_FLAG_SAND;
 }
 
 static void GetGroundEffectFlags_SandHeap(struct ObjectEvent *objEvent, u32 *flags)
 {
-    if (MetatileBehavior_IsDeepSand(objEvent->currentMetatileBehavior)
-        && MetatileBehavior_IsDeepSand(objEvent->previousMetatileBehavior))
+    if (MetatileBehavior_GetProperties(objEvent->currentMetatileBehavior) & MetatileBehavior_GetProperties(objEvent->previousMetatileBehavior) & MB_PROP_DEEP_SAND)
     {
         if (!objEvent->inSandPile)
         {
@@ -9399,10 +9647,9 @@ static void GetGroundEffectFlags_SandHeap(struct ObjectEvent *objEvent, u32 *fla
 
 static void GetGroundEffectFlags_ShallowFlowingWater(struct ObjectEvent *objEvent, u32 *flags)
 {
-    if ((MetatileBehavior_IsShallowFlowingWater(objEvent->currentMetatileBehavior)
-         && MetatileBehavior_IsShallowFlowingWater(objEvent->previousMetatileBehavior))
-        || (MetatileBehavior_IsPacifidlogLog(objEvent->currentMetatileBehavior)
-            && MetatileBehavior_IsPacifidlogLog(objEvent->previousMetatileBehavior)))
+    u32 properties = MetatileBehavior_GetProperties(objEvent->currentMetatileBehavior) & MetatileBehavior_GetProperties(objEvent->previousMetatileBehavior);
+
+    if (properties & (MB_PROP_SHALLOW_FLOWING_WATER | MB_PROP_PACIFIDLOG_LOG))
     {
         if (!objEvent->inShallowFlowingWater)
         {
@@ -9419,21 +9666,19 @@ static void GetGroundEffectFlags_ShallowFlowingWater(struct ObjectEvent *objEven
 
 static void GetGroundEffectFlags_Puddle(struct ObjectEvent *objEvent, u32 *flags)
 {
-    if (MetatileBehavior_IsPuddle(objEvent->currentMetatileBehavior)
-        && MetatileBehavior_IsPuddle(objEvent->previousMetatileBehavior))
+    if (MetatileBehavior_GetProperties(objEvent->currentMetatileBehavior) & MetatileBehavior_GetProperties(objEvent->previousMetatileBehavior) & MB_PROP_PUDDLE)
         *flags |= GROUND_EFFECT_FLAG_PUDDLE;
 }
 
 static void GetGroundEffectFlags_Ripple(struct ObjectEvent *objEvent, u32 *flags)
 {
-    if (MetatileBehavior_HasRipples(objEvent->currentMetatileBehavior))
+    if (MetatileBehavior_GetProperties(objEvent->currentMetatileBehavior) & MB_PROP_RIPPLES)
         *flags |= GROUND_EFFECT_FLAG_RIPPLES;
 }
 
 static void GetGroundEffectFlags_ShortGrass(struct ObjectEvent *objEvent, u32 *flags)
 {
-    if (MetatileBehavior_IsShortGrass(objEvent->currentMetatileBehavior)
-        && MetatileBehavior_IsShortGrass(objEvent->previousMetatileBehavior))
+    if (MetatileBehavior_GetProperties(objEvent->currentMetatileBehavior) & MetatileBehavior_GetProperties(objEvent->previousMetatileBehavior) & MB_PROP_SHORT_GRASS)
     {
         if (!objEvent->inShortGrass)
         {
@@ -9450,8 +9695,7 @@ static void GetGroundEffectFlags_ShortGrass(struct ObjectEvent *objEvent, u32 *f
 
 static void GetGroundEffectFlags_HotSprings(struct ObjectEvent *objEvent, u32 *flags)
 {
-    if (MetatileBehavior_IsHotSprings(objEvent->currentMetatileBehavior)
-        && MetatileBehavior_IsHotSprings(objEvent->previousMetatileBehavior))
+    if (MetatileBehavior_GetProperties(objEvent->currentMetatileBehavior) & MetatileBehavior_GetProperties(objEvent->previousMetatileBehavior) & MB_PROP_HOT_SPRINGS)
     {
         if (!objEvent->inHotSprings)
         {
@@ -9468,21 +9712,18 @@ static void GetGroundEffectFlags_HotSprings(struct ObjectEvent *objEvent, u32 *f
 
 static void GetGroundEffectFlags_Seaweed(struct ObjectEvent *objEvent, u32 *flags)
 {
-    if (MetatileBehavior_IsSeaweed(objEvent->currentMetatileBehavior))
+    if (MetatileBehavior_GetProperties(objEvent->currentMetatileBehavior) & MB_PROP_SEAWEED)
         *flags |= GROUND_EFFECT_FLAG_SEAWEED;
 }
 
 static void GetGroundEffectFlags_JumpLanding(struct ObjectEvent *objEvent, u32 *flags)
 {
-    typedef bool8 (*MetatileFunc)(u8);
-
-    static const MetatileFunc metatileFuncs[] = {
-        MetatileBehavior_IsTallGrass,
-        MetatileBehavior_IsLongGrass,
-        MetatileBehavior_IsPuddle,
-        MetatileBehavior_IsSurfableWaterOrUnderwater,
-        MetatileBehavior_IsShallowFlowingWater,
-        MetatileBehavior_IsATile,
+    static const u32 metatileProperties[] = {
+        MB_PROP_TALL_GRASS,
+        MB_PROP_LONG_GRASS,
+        MB_PROP_PUDDLE,
+        MB_PROP_SURFABLE,
+        MB_PROP_SHALLOW_FLOWING_WATER,
     };
 
     static const u32 jumpLandingFlags[] = {
@@ -9491,21 +9732,22 @@ static void GetGroundEffectFlags_JumpLanding(struct ObjectEvent *objEvent, u32 *
         GROUND_EFFECT_FLAG_LAND_IN_SHALLOW_WATER,
         GROUND_EFFECT_FLAG_LAND_IN_DEEP_WATER,
         GROUND_EFFECT_FLAG_LAND_IN_SHALLOW_WATER,
-        GROUND_EFFECT_FLAG_LAND_ON_NORMAL_GROUND,
     };
 
     if (objEvent->landingJump && !objEvent->disableJumpLandingGroundEffect)
     {
-        u8 i;
+        u32 i;
+        u32 properties = MetatileBehavior_GetProperties(objEvent->currentMetatileBehavior);
 
-        for (i = 0; i < ARRAY_COUNT(metatileFuncs); i++)
+        for (i = 0; i < ARRAY_COUNT(metatileProperties); i++)
         {
-            if (metatileFuncs[i](objEvent->currentMetatileBehavior))
+            if (properties & metatileProperties[i])
             {
                 *flags |= jumpLandingFlags[i];
                 return;
             }
         }
+        *flags |= GROUND_EFFECT_FLAG_LAND_ON_NORMAL_GROUND;
     }
 }
 
@@ -9546,9 +9788,11 @@ static u8 ObjectEventGetNearbyReflectionType(struct ObjectEvent *objEvent)
 
 static u8 GetReflectionTypeByMetatileBehavior(u32 behavior)
 {
-    if (MetatileBehavior_IsIce(behavior))
+    u32 properties = MetatileBehavior_GetProperties(behavior);
+
+    if (properties & MB_PROP_ICE)
         return REFL_TYPE_ICE;
-    else if (MetatileBehavior_IsReflective(behavior))
+    else if (properties & MB_PROP_REFLECTIVE)
         return REFL_TYPE_WATER;
     else
         return REFL_TYPE_NONE;
@@ -9585,10 +9829,7 @@ static void SetObjectEventSpriteOamTableForLongGrass(struct ObjectEvent *objEven
     if (objEvent->disableCoveringGroundEffects)
         return;
 
-    if (!MetatileBehavior_IsLongGrass(objEvent->currentMetatileBehavior))
-        return;
-
-    if (!MetatileBehavior_IsLongGrass(objEvent->previousMetatileBehavior))
+    if (!(MetatileBehavior_GetProperties(objEvent->currentMetatileBehavior) & MetatileBehavior_GetProperties(objEvent->previousMetatileBehavior) & MB_PROP_LONG_GRASS))
         return;
 
     sprite->subspriteTableNum = 4;
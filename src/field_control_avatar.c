@@ -899,16 +899,7 @@ static bool8 TryStartWarpEventScript(struct MapPosition *position, u16 metatileB
 
 static bool8 IsWarpMetatileBehavior(u16 metatileBehavior)
 {
-    if (MetatileBehavior_IsWarpDoor(metatileBehavior) != TRUE
-     && MetatileBehavior_IsLadder(metatileBehavior) != TRUE
-     && MetatileBehavior_IsEscalator(metatileBehavior) != TRUE
-     && MetatileBehavior_IsNonAnimDoor(metatileBehavior) != TRUE
-     && MetatileBehavior_IsLavaridgeB1FWarp(metatileBehavior) != TRUE
-     && MetatileBehavior_IsLavaridge1FWarp(metatileBehavior) != TRUE
-     && MetatileBehavior_IsAquaHideoutWarp(metatileBehavior) != TRUE
-     && MetatileBehavior_IsMtPyreHole(metatileBehavior) != TRUE
-     && MetatileBehavior_IsMossdeepGymWarp(metatileBehavior) != TRUE
-     && MetatileBehavior_IsUnionRoomWarp(metatileBehavior) != TRUE)
+    if (!(MetatileBehavior_GetProperties(metatileBehavior) & MB_PROP_WARP))
         return FALSE;
     return TRUE;
 }
@@ -1006,12 +997,56 @@ static bool8 TryDoorWarp(struct MapPosition *position, u16 metatileBehavior, u8
     return FALSE;
 }
 
+// The event indexes that mapjson generates list a map's events sorted by
+// position, so the events on a tile can be found with a binary search.
+// Every kind of event starts with its x and y coordinates.
+STATIC_ASSERT(offsetof(struct WarpEvent, y) == sizeof(u16) && offsetof(struct CoordEvent, y) == sizeof(u16) && offsetof(struct BgEvent, y) == sizeof(u16), EventsStartWithPosition);
+
+#define EVENT_POSITION_KEY(x, y) (((u32)(u16)(y) << 16) | (u16)(x))
+
+static u32 GetEventPositionKey(const void *events, u32 eventSize, u32 eventId)
+{
+    const u16 *position = (const u16 *)((const u8 *)events + eventId * eventSize);
+    return EVENT_POSITION_KEY(position[0], position[1]);
+}
+
+// Returns the first entry of the index that is at or after (x, y).
+static u32 FindIndexedEventsAtPosition(const u8 *index, u32 count, const void *events, u32 eventSize, u16 x, u16 y)
+{
+    u32 key = EVENT_POSITION_KEY(x, y);
+    u32 low = 0, high = count;
+
+    while (low < high)
+    {
+        u32 mid = (low + high) / 2;
+        if (GetEventPositionKey(events, eventSize, index[mid]) < key)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+    return low;
+}
+
 static s8 GetWarpEventAtPosition(struct MapHeader *mapHeader, u16 x, u16 y, u8 elevation)
 {
     s32 i;
     const struct WarpEvent *warpEvent = mapHeader->events->warps;
+    const u8 *warpIndex = mapHeader->events->warpIndex;
     u8 warpCount = mapHeader->events->warpCount;
 
+    if (warpIndex != NULL)
+    {
+        for (i = FindIndexedEventsAtPosition(warpIndex, warpCount, warpEvent, sizeof(*warpEvent), x, y); i < warpCount; i++)
+        {
+            const struct WarpEvent *indexedWarp = &warpEvent[warpIndex[i]];
+            if ((u16)indexedWarp->x != x || (u16)indexedWarp->y != y)
+                break;
+            if (indexedWarp->elevation == elevation || indexedWarp->elevation == 0)
+                return warpIndex[i];
+        }
+        return WARP_ID_NONE;
+    }
+
     for (i = 0; i < warpCount; i++, warpEvent++)
     {
         if ((u16)warpEvent->x == x && (u16)warpEvent->y == y)
@@ -1057,8 +1092,26 @@ static const u8 *GetCoordEventScriptAtPosition(struct MapHeader *mapHeader, u16
 {
     s32 i;
     const struct CoordEvent *coordEvents = mapHeader->events->coordEvents;
+    const u8 *coordEventIndex = mapHeader->events->coordEventIndex;
     u8 coordEventCount = mapHeader->events->coordEventCount;
 
+    if (coordEventIndex != NULL)
+    {
+        for (i = FindIndexedEventsAtPosition(coordEventIndex, coordEventCount, coordEvents, sizeof(*coordEvents), x, y); i < coordEventCount; i++)
+        {
+            const struct CoordEvent *coordEvent = &coordEvents[coordEventIndex[i]];
+            if ((u16)coordEvent->x != x || (u16)coordEvent->y != y)
+                break;
+            if (coordEvent->elevation == elevation || coordEvent->elevation == 0)
+            {
+                const u8 *script = TryRunCoordEventScript(coordEvent);
+                if (script != NULL)
+                    return script;
+            }
+        }
+        return NULL;
+    }
+
     for (i = 0; i < coordEventCount; i++)
     {
         if ((u16)coordEvents[i].x == x && (u16)coordEvents[i].y == y)
@@ -1081,10 +1134,24 @@ const u8 *GetCoordEventScriptAtMapPosition(struct MapPosition *position)
 
 static const struct BgEvent *GetBackgroundEventAtPosition(struct MapHeader *mapHeader, u16 x, u16 y, u8 elevation)
 {
-    u8 i;
+    u32 i;
     const struct BgEvent *bgEvents = mapHeader->events->bgEvents;
+    const u8 *bgEventIndex = mapHeader->events->bgEventIndex;
     u8 bgEventCount = mapHeader->events->bgEventCount;
 
+    if (bgEventIndex != NULL)
+    {
+        for (i = FindIndexedEventsAtPosition(bgEventIndex, bgEventCount, bgEvents, sizeof(*bgEvents), x, y); i < bgEventCount; i++)
+        {
+            const struct BgEvent *bgEvent = &bgEvents[bgEventIndex[i]];
+            if (bgEvent->x != x || bgEvent->y != y)
+                break;
+            if (bgEvent->elevation == elevation || bgEvent->elevation == 0)
+                return bgEvent;
+        }
+        return NULL;
+    }
+
     for (i = 0; i < bgEventCount; i++)
     {
         if ((u16)bgEvents[i].x == x && (u16)bgEvents[i].y == y)
@@ -474,22 +474,14 @@ static void ApplyColorMap(u8 startPalIndex, u8 numPalettes, s8 colorMapIndex)
             }
             else
             {
-                u8 r, g, b;
-
                 if (sPaletteColorMapTypes[curPalIndex] == COLOR_MAP_CONTRAST || curPalIndex - 16 == gWeatherPtr->contrastColorMapSpritePalIndex)
                     colorMap = sContrastColorMaps[colorMapIndex];
                 else
                     colorMap = sDarkenedContrastColorMaps[colorMapIndex];
 
-                for (i = 0; i < 16; i++)
-                {
-                    // Apply color map to the original color.
-                    struct RGBColor baseColor = *(struct RGBColor *)&gPlttBufferUnfaded[palOffset];
-                    r = colorMap[baseColor.r];
-                    g = colorMap[baseColor.g];
-                    b = colorMap[baseColor.b];
-                    gPlttBufferFaded[palOffset++] = RGB2(r, g, b);
-                }
+                // Apply color map to the original colors.
+                ColorMapColors(&gPlttBufferUnfaded[palOffset], &gPlttBufferFaded[palOffset], 16, colorMap);
+                palOffset += 16;
             }
 
             curPalIndex++;
@@ -534,11 +526,6 @@ static void ApplyColorMapWithBlend(u8 startPalIndex, u8 numPalettes, s8 colorMap
 {
     u16 palOffset;
     u16 curPalIndex;
-    u32 i;
-    struct RGBColor color = *(struct RGBColor *)&blendColor;
-    u8 rBlend = color.r;
-    u8 gBlend = color.g;
-    u8 bBlend = color.b;
 
     palOffset = PLTT_ID(startPalIndex);
     numPalettes += startPalIndex;
@@ -562,19 +549,10 @@ static void ApplyColorMapWithBlend(u8 startPalIndex, u8 numPalettes, s8 colorMap
             else
                 colorMap = sContrastColorMaps[colorMapIndex];
 
-            for (i = 0; i < 16; i++)
-            {
-                struct RGBColor baseColor = *(struct RGBColor *)&gPlttBufferUnfaded[palOffset];
-                u8 r = colorMap[baseColor.r];
-                u8 g = colorMap[baseColor.g];
-                u8 b = colorMap[baseColor.b];
-
-                // Apply color map and target blend color to the original color.
-                r += ((rBlend - r) * blendCoeff) >> 4;
-                g += ((gBlend - g) * blendCoeff) >> 4;
-                b += ((bBlend - b) * blendCoeff) >> 4;
-                gPlttBufferFaded[palOffset++] = RGB2(r, g, b);
-            }
+            // Apply color map and target blend color to the original colors.
+            ColorMapColors(&gPlttBufferUnfaded[palOffset], &gPlttBufferFaded[palOffset], 16, colorMap);
+            BlendColors(&gPlttBufferFaded[palOffset], &gPlttBufferFaded[palOffset], 16, blendCoeff, blendColor);
+            palOffset += 16;
         }
 
         curPalIndex++;
@@ -583,19 +561,11 @@ static void ApplyColorMapWithBlend(u8 startPalIndex, u8 numPalettes, s8 colorMap
 
 static void ApplyDroughtColorMapWithBlend(s8 colorMapIndex, u8 blendCoeff, u32 blendColor)
 {
-    struct RGBColor color;
-    u8 rBlend;
-    u8 gBlend;
-    u8 bBlend;
     u16 curPalIndex;
     u16 palOffset;
     u16 i;
 
     colorMapIndex = -colorMapIndex - 1;
-    color = *(struct RGBColor *)&blendColor;
-    rBlend = color.r;
-    gBlend = color.g;
-    bBlend = color.b;
     palOffset = 0;
     for (curPalIndex = 0; curPalIndex < 32; curPalIndex++)
     {
@@ -608,73 +578,28 @@ static void ApplyDroughtColorMapWithBlend(s8 colorMapIndex, u8 blendCoeff, u32 b
         else
         {
             for (i = 0; i < 16; i++)
-            {
-                u32 offset;
-                struct RGBColor color1;
-                struct RGBColor color2;
-                u8 r1, g1, b1;
-                u8 r2, g2, b2;
-
-                color1 = *(struct RGBColor *)&gPlttBufferUnfaded[palOffset];
-                r1 = color1.r;
-                g1 = color1.g;
-                b1 = color1.b;
-
-                offset = ((b1 & 0x1E) << 7) | ((g1 & 0x1E) << 3) | ((r1 & 0x1E) >> 1);
-                color2 = *(struct RGBColor *)&sDroughtWeatherColors[colorMapIndex][offset];
-                r2 = color2.r;
-                g2 = color2.g;
-                b2 = color2.b;
-
-                r2 += ((rBlend - r2) * blendCoeff) >> 4;
-                g2 += ((gBlend - g2) * blendCoeff) >> 4;
-                b2 += ((bBlend - b2) * blendCoeff) >> 4;
-
-                gPlttBufferFaded[palOffset++] = RGB2(r2, g2, b2);
-            }
+                gPlttBufferFaded[palOffset + i] = sDroughtWeatherColors[colorMapIndex][DROUGHT_COLOR_INDEX(gPlttBufferUnfaded[palOffset + i])];
+            BlendColors(&gPlttBufferFaded[palOffset], &gPlttBufferFaded[palOffset], 16, blendCoeff, blendColor);
+            palOffset += 16;
         }
     }
 }
 
 static void ApplyFogBlend(u8 blendCoeff, u32 blendColor)
 {
-    struct RGBColor color;
-    u8 rBlend;
-    u8 gBlend;
-    u8 bBlend;
     u16 curPalIndex;
 
     BlendPalette(BG_PLTT_ID(0), 16 * 16, blendCoeff, blendColor);
-    color = *(struct RGBColor *)&blendColor;
-    rBlend = color.r;
-    gBlend = color.g;
-    bBlend = color.b;
 
     for (curPalIndex = 16; curPalIndex < 32; curPalIndex++)
     {
         if (LightenSpritePaletteInFog(curPalIndex))
         {
-            u16 palEnd = PLTT_ID(curPalIndex + 1);
             u16 palOffset = PLTT_ID(curPalIndex);
 
-            while (palOffset < palEnd)
-            {
-                struct RGBColor color = *(struct RGBColor *)&gPlttBufferUnfaded[palOffset];
-                u8 r = color.r;
-                u8 g = color.g;
-                u8 b = color.b;
-
-                r += ((28 - r) * 3) >> 2;
-                g += ((31 - g) * 3) >> 2;
-                b += ((28 - b) * 3) >> 2;
-
-                r += ((rBlend - r) * blendCoeff) >> 4;
-                g += ((gBlend - g) * blendCoeff) >> 4;
-                b += ((bBlend - b) * blendCoeff) >> 4;
-
-                gPlttBufferFaded[palOffset] = RGB2(r, g, b);
-                palOffset++;
-            }
+            // Lighten by 3/4 towards the fog's color, then blend.
+            BlendColors(&gPlttBufferUnfaded[palOffset], &gPlttBufferFaded[palOffset], 16, 12, RGB(28, 31, 28));
+            BlendColors(&gPlttBufferFaded[palOffset], &gPlttBufferFaded[palOffset], 16, blendCoeff, blendColor);
         }
         else
         {
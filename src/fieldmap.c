@@ -1,10 +1,12 @@
 #include "global.h"
 #include "battle_pyramid.h"
 #include "bg.h"
+#include "decompress.h"
 #include "fieldmap.h"
 #include "fldeff.h"
 #include "fldeff_misc.h"
 #include "frontier_util.h"
+#include "malloc.h"
 #include "menu.h"
 #include "mirage_tower.h"
 #include "overworld.h"
@@ -26,10 +28,26 @@ struct ConnectionFlags
     u8 east:1;
 };
 
+// How close (in metatiles) the player has to be to a connection before its tileset starts streaming
+#define TILESET_STREAM_DISTANCE 6
+// Bytes decompressed per frame. A full secondary tileset takes 8 frames,
+// which is less than a single step at walking speed.
+#define TILESET_STREAM_BYTES_PER_FRAME 0x800
+
+struct TilesetStream
+{
+    const struct Tileset *tileset;
+    const struct Tileset *leftTileset; // secondary tileset of the map the camera last crossed out of
+    u8 *buffer;
+    struct LZ77Stream lz;
+    bool8 complete;
+};
+
 EWRAM_DATA u16 ALIGNED(4) sBackupMapData[MAX_MAP_DATA_SIZE] = {0};
 EWRAM_DATA struct MapHeader gMapHeader = {0};
 EWRAM_DATA struct Camera gCamera = {0};
 EWRAM_DATA static struct ConnectionFlags sMapConnectionFlags = {0};
+EWRAM_DATA static struct TilesetStream sTilesetStream = {0};
 
 COMMON_DATA struct BackupMapLayout gBackupMapLayout = {0};
 
@@ -47,6 +65,8 @@ static bool8 SkipCopyingMetatileFromSavedMap(u16 *mapBlock, u16 mapWidth, u8 yMo
 static const struct MapConnection *GetIncomingConnection(u8 direction, int x, int y);
 static bool8 IsPosInIncomingConnectingMap(u8 direction, int x, int y, const struct MapConnection *connection);
 static bool8 IsCoordInIncomingConnectingMap(int coord, int srcMax, int destMax, int offset);
+static int IsPosInConnectingMap(const struct MapConnection *connection, int x, int y);
+static void TryStartConnectionTilesetStream(void);
 
 static inline u16 GetBorderBlockAt(int x, int y)
 {
@@ -647,6 +667,7 @@ bool8 CameraMove(int x, int y)
 {
     int direction;
     const struct MapConnection *connection;
+    const struct Tileset *leftTileset;
     int old_x, old_y;
     gCamera.active = FALSE;
     direction = GetPostCameraMoveMapBorderId(x, y);
@@ -654,6 +675,8 @@ bool8 CameraMove(int x, int y)
     {
         gSaveBlock1Ptr->pos.x += x;
         gSaveBlock1Ptr->pos.y += y;
+        if (OW_STREAM_CONNECTION_TILESETS)
+            TryStartConnectionTilesetStream();
     }
     else
     {
@@ -664,8 +687,10 @@ bool8 CameraMove(int x, int y)
         connection = GetIncomingConnection(direction, gSaveBlock1Ptr->pos.x, gSaveBlock1Ptr->pos.y);
         if (connection)
         {
+            leftTileset = gMapHeader.mapLayout->secondaryTileset;
             SetPositionFromConnection(connection, direction, x, y);
             LoadMapFromCameraTransition(connection->mapGroup, connection->mapNum);
+            sTilesetStream.leftTileset = leftTileset;
             gCamera.active = TRUE;
             gCamera.x = old_x - gSaveBlock1Ptr->pos.x;
             gCamera.y = old_y - gSaveBlock1Ptr->pos.y;
@@ -917,6 +942,126 @@ void CopySecondaryTilesetToVramUsingHeap(struct MapLayout const *mapLayout)
     CopyTilesetToVramUsingHeap(mapLayout->secondaryTileset, NUM_TILES_TOTAL - NUM_TILES_IN_PRIMARY, NUM_TILES_IN_PRIMARY);
 }
 
+// Connection tileset streaming
+// When the player gets close to a map connection whose secondary tileset differs from the
+// current one, that tileset is decompressed into a heap buffer a chunk at a time every frame.
+// VRAM keeps the current tileset until the camera crosses the connection, at which point
+// the finished buffer only has to be queued for DMA.
+static void StopConnectionTilesetStream(void)
+{
+    TRY_FREE_AND_SET_NULL(sTilesetStream.buffer);
+    sTilesetStream.tileset = NULL;
+    sTilesetStream.complete = FALSE;
+}
+
+void CancelConnectionTilesetStream(void)
+{
+    StopConnectionTilesetStream();
+    sTilesetStream.leftTileset = NULL;
+}
+
+static void StartConnectionTilesetStream(const struct Tileset *tileset)
+{
+    StopConnectionTilesetStream();
+    sTilesetStream.buffer = Alloc(GetDecompressedDataSize(tileset->tiles));
+    if (sTilesetStream.buffer == NULL)
+        return;
+
+    sTilesetStream.tileset = tileset;
+    LZ77Stream_Init(&sTilesetStream.lz, tileset->tiles, sTilesetStream.buffer);
+}
+
+static u32 GetDistanceToConnection(const struct MapConnection *connection, int x, int y)
+{
+    switch (connection->direction)
+    {
+    case CONNECTION_NORTH:
+        return y;
+    case CONNECTION_SOUTH:
+        return gMapHeader.mapLayout->height - 1 - y;
+    case CONNECTION_WEST:
+        return x;
+    case CONNECTION_EAST:
+        return gMapHeader.mapLayout->width - 1 - x;
+    }
+    return UINT32_MAX;
+}
+
+static void TryStartConnectionTilesetStream(void)
+{
+    int i;
+    int x = gSaveBlock1Ptr->pos.x;
+    int y = gSaveBlock1Ptr->pos.y;
+    u32 distance, closestDistance = TILESET_STREAM_DISTANCE + 1;
+    const struct Tileset *tileset, *closestTileset = NULL;
+    const struct MapConnection *connection;
+    bool32 nearLeftMap = FALSE;
+
+    if (gMapHeader.connections == NULL)
+        return;
+
+    connection = gMapHeader.connections->connections;
+    for (i = 0; i < gMapHeader.connections->count; i++, connection++)
+    {
+        distance = GetDistanceToConnection(connection, x, y);
+        if (distance > TILESET_STREAM_DISTANCE || !IsPosInConnectingMap(connection, x, y))
+            continue;
+
+        tileset = GetMapHeaderFromConnection(connection)->mapLayout->secondaryTileset;
+        if (tileset == NULL || !tileset->isCompressed || tileset == gMapHeader.mapLayout->secondaryTileset)
+            continue;
+
+        // Right after a transition the player still stands at the seam of the map they came
+        // from, which is rarely where they are headed. Leave it until they have walked away.
+        if (tileset == sTilesetStream.leftTileset)
+        {
+            nearLeftMap = TRUE;
+            continue;
+        }
+
+        if (distance < closestDistance)
+        {
+            closestDistance = distance;
+            closestTileset = tileset;
+        }
+    }
+
+    if (!nearLeftMap)
+        sTilesetStream.leftTileset = NULL;
+
+    if (closestTileset != NULL && closestTileset != sTilesetStream.tileset)
+        StartConnectionTilesetStream(closestTileset);
+}
+
+// Called every frame in the overworld
+void UpdateConnectionTilesetStream(void)
+{
+    if (sTilesetStream.tileset != NULL && !sTilesetStream.complete)
+        sTilesetStream.complete = LZ77Stream_Decompress(&sTilesetStream.lz, TILESET_STREAM_BYTES_PER_FRAME);
+}
+
+// Loads the map's secondary tileset from the stream if it was prepared, otherwise decompresses it now.
+void CopySecondaryTilesetToVramStreamed(struct MapLayout const *mapLayout)
+{
+    if (sTilesetStream.tileset != NULL && sTilesetStream.tileset == mapLayout->secondaryTileset)
+    {
+        if (!sTilesetStream.complete)
+            LZ77Stream_Decompress(&sTilesetStream.lz, sTilesetStream.lz.remaining);
+
+        // Same upload size as CopySecondaryTilesetToVramUsingHeap.
+        // The buffer is freed by the copy task once the DMA has finished.
+        LoadBgGfxFromHeapBuffer(2, sTilesetStream.buffer, (NUM_TILES_TOTAL - NUM_TILES_IN_PRIMARY) * 32, NUM_TILES_IN_PRIMARY, 0);
+        sTilesetStream.buffer = NULL;
+        sTilesetStream.tileset = NULL;
+        sTilesetStream.complete = FALSE;
+    }
+    else
+    {
+        StopConnectionTilesetStream();
+        CopySecondaryTilesetToVramUsingHeap(mapLayout);
+    }
+}
+
 static void LoadPrimaryTilesetPalette(struct MapLayout const *mapLayout)
 {
     LoadTilesetPalette(mapLayout->primaryTileset, BG_PLTT_ID(0), NUM_PALS_IN_PRIMARY * PLTT_SIZE_4BPP);
@@ -26,7 +26,27 @@ static bool8 CheckPyramidBagHasSpace(u16 itemId, u16 count);
 static const u8 *ItemId_GetPluralName(u16);
 static bool32 DoesItemHavePluralName(u16);
 
+#define BAG_SLOT_NONE     0xFF
+#define BAG_SLOT_MULTIPLE 0xFE // The item is in more than one slot, so its pocket has to be searched.
+
+// The slot each item is in and the number of used slots in each pocket,
+// so that looking up an item doesn't have to search its whole pocket.
+// Anything which moves items between slots must invalidate it.
+struct BagItemIndex
+{
+    u8 slots[ITEMS_COUNT];
+    u8 usedSlots[POCKETS_COUNT];
+    bool8 valid;
+};
+
+STATIC_ASSERT(BAG_ITEMS_COUNT < BAG_SLOT_MULTIPLE
+           && BAG_KEYITEMS_COUNT < BAG_SLOT_MULTIPLE
+           && BAG_POKEBALLS_COUNT < BAG_SLOT_MULTIPLE
+           && BAG_TMHM_COUNT < BAG_SLOT_MULTIPLE
+           && BAG_BERRIES_COUNT < BAG_SLOT_MULTIPLE, BagPocketTooLargeForItemIndex);
+
 EWRAM_DATA struct BagPocket gBagPockets[POCKETS_COUNT] = {0};
+static EWRAM_DATA struct BagItemIndex sBagItemIndex = {0};
 
 #include "data/pokemon/item_effects.h"
 #include "data/items.h"
@@ -66,6 +86,63 @@ void ApplyNewEncryptionKeyToBagItems_(u32 newKey) // really GF?
     ApplyNewEncryptionKeyToBagItems(newKey);
 }
 
+void InvalidateBagItemIndex(void)
+{
+    sBagItemIndex.valid = FALSE;
+}
+
+static void IndexBagItemSlot(u16 itemId, u32 slot)
+{
+    if (sBagItemIndex.slots[itemId] == BAG_SLOT_NONE)
+        sBagItemIndex.slots[itemId] = slot;
+    else if (sBagItemIndex.slots[itemId] != slot)
+        sBagItemIndex.slots[itemId] = BAG_SLOT_MULTIPLE;
+}
+
+static void BuildBagItemIndex(void)
+{
+    u32 pocket, i;
+    u16 itemId;
+
+    memset(sBagItemIndex.slots, BAG_SLOT_NONE, sizeof(sBagItemIndex.slots));
+    for (pocket = 0; pocket < POCKETS_COUNT; pocket++)
+    {
+        sBagItemIndex.usedSlots[pocket] = 0;
+        for (i = 0; i < gBagPockets[pocket].capacity; i++)
+        {
+            itemId = gBagPockets[pocket].itemSlots[i].itemId;
+            if (itemId == ITEM_NONE)
+                continue;
+            sBagItemIndex.usedSlots[pocket]++;
+            if (itemId < ITEMS_COUNT)
+                IndexBagItemSlot(itemId, i);
+        }
+    }
+    sBagItemIndex.valid = TRUE;
+}
+
+// Returns the slot of itemId in its pocket, BAG_SLOT_NONE if it isn't in the bag
+// or BAG_SLOT_MULTIPLE if the pocket has to be searched.
+static u32 GetBagItemSlot(u32 pocket, u16 itemId)
+{
+    u32 slot;
+
+    if (!sBagItemIndex.valid)
+        BuildBagItemIndex();
+    if (itemId >= ITEMS_COUNT)
+        return BAG_SLOT_MULTIPLE;
+
+    slot = sBagItemIndex.slots[itemId];
+    if (slot < BAG_SLOT_MULTIPLE
+     && (slot >= gBagPockets[pocket].capacity || gBagPockets[pocket].itemSlots[slot].itemId != itemId))
+    {
+        // The item is in the wrong pocket, or the index is stale
+        InvalidateBagItemIndex();
+        return BAG_SLOT_MULTIPLE;
+    }
+    return slot;
+}
+
 void SetBagItemsPointers(void)
 {
     gBagPockets[ITEMS_POCKET].itemSlots = gSaveBlock1Ptr->bagPocket_Items;
@@ -82,6 +159,8 @@ void SetBagItemsPointers(void)
 
     gBagPockets[BERRIES_POCKET].itemSlots = gSaveBlock1Ptr->bagPocket_Berries;
     gBagPockets[BERRIES_POCKET].capacity = BAG_BERRIES_COUNT;
+
+    InvalidateBagItemIndex();
 }
 
 u8 *CopyItemName(u16 itemId, u8 *dst)
@@ -124,12 +203,18 @@ bool8 CheckBagHasItem(u16 itemId, u16 count)
 {
     u8 i;
     u8 pocket;
+    u32 slot;
 
     if (ItemId_GetPocket(itemId) == 0)
         return FALSE;
     if (InBattlePyramid() || FlagGet(FLAG_STORING_ITEMS_IN_PYRAMID_BAG) == TRUE)
         return CheckPyramidBagHasItem(itemId, count);
     pocket = ItemId_GetPocket(itemId) - 1;
+    slot = GetBagItemSlot(pocket, itemId);
+    // A hit has been checked against the pocket, but a miss hasn't. The
+    // pocket is searched in case the index missed a change to it.
+    if (slot != BAG_SLOT_NONE && slot != BAG_SLOT_MULTIPLE)
+        return GetBagItemQuantity(&gBagPockets[pocket].itemSlots[slot].quantity) >= count;
     // Check for item slots that contain the item
     for (i = 0; i < gBagPockets[pocket].capacity; i++)
     {
@@ -193,11 +278,24 @@ u32 GetFreeSpaceForItemInBag(u16 itemId)
     u8 i;
     u8 pocket = ItemId_GetPocket(itemId) - 1;
     u16 ownedCount;
+    u32 slot;
     u32 spaceForItem = 0;
 
     if (ItemId_GetPocket(itemId) == POCKET_NONE)
         return 0;
 
+    slot = GetBagItemSlot(pocket, itemId);
+    if (slot != BAG_SLOT_MULTIPLE)
+    {
+        spaceForItem = (gBagPockets[pocket].capacity - sBagItemIndex.usedSlots[pocket]) * MAX_BAG_ITEM_CAPACITY;
+        if (slot != BAG_SLOT_NONE)
+        {
+            ownedCount = GetBagItemQuantity(&gBagPockets[pocket].itemSlots[slot].quantity);
+            spaceForItem += max(0, MAX_BAG_ITEM_CAPACITY - ownedCount);
+        }
+        return spaceForItem;
+    }
+
     // Check space in any existing item slots that already contain this item
     for (i = 0; i < gBagPockets[pocket].capacity; i++)
     {
@@ -232,8 +330,36 @@ bool8 AddBagItem(u16 itemId, u16 count)
         struct ItemSlot *newItems;
         u16 ownedCount;
         u8 pocket = ItemId_GetPocket(itemId) - 1;
+        u32 slot = GetBagItemSlot(pocket, itemId);
 
         itemPocket = &gBagPockets[pocket];
+
+        // Common cases which only need a single slot
+        if (slot < BAG_SLOT_MULTIPLE)
+        {
+            ownedCount = GetBagItemQuantity(&itemPocket->itemSlots[slot].quantity);
+            if (ownedCount + count <= MAX_BAG_ITEM_CAPACITY)
+            {
+                SetBagItemQuantity(&itemPocket->itemSlots[slot].quantity, ownedCount + count);
+                return TRUE;
+            }
+        }
+        else if (slot == BAG_SLOT_NONE && count != 0 && count <= MAX_BAG_ITEM_CAPACITY)
+        {
+            for (i = 0; i < itemPocket->capacity; i++)
+            {
+                if (itemPocket->itemSlots[i].itemId == ITEM_NONE)
+                {
+                    itemPocket->itemSlots[i].itemId = itemId;
+                    SetBagItemQuantity(&itemPocket->itemSlots[i].quantity, count);
+                    IndexBagItemSlot(itemId, i);
+                    sBagItemIndex.usedSlots[pocket]++;
+                    return TRUE;
+                }
+            }
+            return FALSE;
+        }
+
         newItems = AllocZeroed(itemPocket->capacity * sizeof(struct ItemSlot));
         memcpy(newItems, itemPocket->itemSlots, itemPocket->capacity * sizeof(struct ItemSlot));
 
@@ -311,6 +437,7 @@ bool8 AddBagItem(u16 itemId, u16 count)
         }
         memcpy(itemPocket->itemSlots, newItems, itemPocket->capacity * sizeof(struct ItemSlot));
         Free(newItems);
+        InvalidateBagItemIndex();
         return TRUE;
     }
 }
@@ -333,15 +460,24 @@ bool8 RemoveBagItem(u16 itemId, u16 count)
         u8 pocket;
         u8 var;
         u16 ownedCount;
+        u32 slot;
         struct BagPocket *itemPocket;
 
         pocket = ItemId_GetPocket(itemId) - 1;
         itemPocket = &gBagPockets[pocket];
+        slot = GetBagItemSlot(pocket, itemId);
 
-        for (i = 0; i < itemPocket->capacity; i++)
+        if (slot < BAG_SLOT_MULTIPLE)
         {
-            if (itemPocket->itemSlots[i].itemId == itemId)
-                totalQuantity += GetBagItemQuantity(&itemPocket->itemSlots[i].quantity);
+            totalQuantity = GetBagItemQuantity(&itemPocket->itemSlots[slot].quantity);
+        }
+        else if (slot == BAG_SLOT_MULTIPLE)
+        {
+            for (i = 0; i < itemPocket->capacity; i++)
+            {
+                if (itemPocket->itemSlots[i].itemId == itemId)
+                    totalQuantity += GetBagItemQuantity(&itemPocket->itemSlots[i].quantity);
+            }
         }
 
         if (totalQuantity < count)
@@ -353,6 +489,19 @@ bool8 RemoveBagItem(u16 itemId, u16 count)
             VarSet(VAR_SECRET_BASE_LAST_ITEM_USED, itemId);
         }
 
+        if (slot < BAG_SLOT_MULTIPLE)
+        {
+            SetBagItemQuantity(&itemPocket->itemSlots[slot].quantity, totalQuantity - count);
+            if (totalQuantity == count)
+            {
+                itemPocket->itemSlots[slot].itemId = ITEM_NONE;
+                sBagItemIndex.slots[itemId] = BAG_SLOT_NONE;
+                sBagItemIndex.usedSlots[pocket]--;
+            }
+            return TRUE;
+        }
+
+        InvalidateBagItemIndex();
         var = GetItemListPosition(pocket);
         if (itemPocket->capacity > var
          && itemPocket->itemSlots[var].itemId == itemId)
@@ -417,6 +566,7 @@ void ClearItemSlots(struct ItemSlot *itemSlots, u8 itemCount)
         itemSlots[i].itemId = ITEM_NONE;
         SetBagItemQuantity(&itemSlots[i].quantity, 0);
     }
+    InvalidateBagItemIndex();
 }
 
 static s32 FindFreePCItemSlot(void)
@@ -583,6 +733,7 @@ void CompactItemsInBagPocket(struct BagPocket *bagPocket)
                 SwapItemSlots(&bagPocket->itemSlots[i], &bagPocket->itemSlots[j]);
         }
     }
+    InvalidateBagItemIndex();
 }
 
 void SortBerriesOrTMHMs(struct BagPocket *bagPocket)
@@ -603,6 +754,7 @@ void SortBerriesOrTMHMs(struct BagPocket *bagPocket)
             SwapItemSlots(&bagPocket->itemSlots[i], &bagPocket->itemSlots[j]);
         }
     }
+    InvalidateBagItemIndex();
 }
 
 void MoveItemSlotInList(struct ItemSlot* itemSlots_, u32 from, u32 to_)
@@ -628,6 +780,7 @@ void MoveItemSlotInList(struct ItemSlot* itemSlots_, u32 from, u32 to_)
                 itemSlots[i] = itemSlots[i - 1];
         }
         itemSlots[to] = firstSlot;
+        InvalidateBagItemIndex();
     }
 }
 
@@ -645,7 +798,19 @@ u16 CountTotalItemQuantityInBag(u16 itemId)
 {
     u16 i;
     u16 ownedCount = 0;
-    struct BagPocket *bagPocket = &gBagPockets[ItemId_GetPocket(itemId) - 1];
+    u32 pocket, slot;
+    struct BagPocket *bagPocket;
+
+    if (ItemId_GetPocket(itemId) == POCKET_NONE)
+        return 0;
+
+    pocket = ItemId_GetPocket(itemId) - 1;
+    bagPocket = &gBagPockets[pocket];
+    slot = GetBagItemSlot(pocket, itemId);
+    if (slot == BAG_SLOT_NONE)
+        return 0;
+    if (slot != BAG_SLOT_MULTIPLE)
+        return GetBagItemQuantity(&bagPocket->itemSlots[slot].quantity);
 
     for (i = 0; i < bagPocket->capacity; i++)
     {
@@ -1,6 +1,7 @@
 #include "global.h"
 #include "malloc.h"
 #include "berry_powder.h"
+#include "event_object_movement.h"
 #include "item.h"
 #include "load_save.h"
 #include "main.h"
@@ -73,6 +74,7 @@ void ClearSav2(void)
 void ClearSav1(void)
 {
     CpuFill16(0, &gSaveblock1, sizeof(struct SaveBlock1ASLR));
+    InvalidateBagItemIndex();
 }
 
 // Offset is the sum of the trainer id bytes
@@ -238,6 +240,7 @@ void LoadObjectEvents(void)
             gObjectEvents[i].graphicsId & OBJ_EVENT_MON)
             gObjectEvents[i].active = TRUE;
     }
+    RebuildObjectEventSpatialIndex();
 }
 
 void CopyPartyAndObjectsToSave(void)
@@ -316,6 +319,7 @@ void SavePlayerBag(void)
     gSaveBlock2Ptr->encryptionKey = gLastEncryptionKey;
     ApplyNewEncryptionKeyToBagItems(encryptionKeyBackup);
     gSaveBlock2Ptr->encryptionKey = encryptionKeyBackup; // updated twice?
+    InvalidateBagItemIndex();
 }
 
 void ApplyNewEncryptionKeyToHword(u16 *hWord, u32 newKey)
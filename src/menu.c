@@ -2,6 +2,7 @@
 #include "malloc.h"
 #include "bg.h"
 #include "blit.h"
+#include "decompress.h"
 #include "dma3.h"
 #include "event_data.h"
 #include "field_weather.h"
@@ -1925,11 +1926,15 @@ void DecompressAndLoadBgGfxUsingHeap(u8 bgId, const void *src, u32 size, u16 off
     if (!size)
         size = sizeOut;
     if (ptr)
-    {
-        u8 taskId = CreateTask(task_free_buf_after_copying_tile_data_to_vram, 0);
-        gTasks[taskId].data[0] = copy_decompressed_tile_data_to_vram(bgId, ptr, size, offset, mode);
-        SetWordTaskArg(taskId, 1, (u32)ptr);
-    }
+        LoadBgGfxFromHeapBuffer(bgId, ptr, size, offset, mode);
+}
+
+// Queues the copy of an already decompressed heap buffer, which is freed once the DMA is done
+void LoadBgGfxFromHeapBuffer(u8 bgId, void *buffer, u32 size, u16 offset, u8 mode)
+{
+    u8 taskId = CreateTask(task_free_buf_after_copying_tile_data_to_vram, 0);
+    gTasks[taskId].data[0] = copy_decompressed_tile_data_to_vram(bgId, buffer, size, offset, mode);
+    SetWordTaskArg(taskId, 1, (u32)buffer);
 }
 
 void task_free_buf_after_copying_tile_data_to_vram(u8 taskId)
@@ -1959,7 +1964,7 @@ void *malloc_and_decompress(const void *src, u32 *size)
 
     ptr = Alloc(*size);
     if (ptr)
-        LZ77UnCompWram(src, ptr);
+        LZDecompressWram(src, ptr);
     return ptr;
 }
 
@@ -2,137 +2,100 @@
 #include "metatile_behavior.h"
 #include "constants/metatile_behaviors.h"
 
-#define TILE_FLAG_HAS_ENCOUNTERS (1 << 0)
-#define TILE_FLAG_SURFABLE       (1 << 1)
-#define TILE_FLAG_UNUSED         (1 << 2) // Roughly all of the traversable metatiles. Set but never read
-
-static const u8 sTileBitAttributes[NUM_METATILE_BEHAVIORS] =
-{
-    [MB_NORMAL]                             = TILE_FLAG_UNUSED,
-    [MB_TALL_GRASS]                         = TILE_FLAG_UNUSED | TILE_FLAG_HAS_ENCOUNTERS,
-    [MB_LONG_GRASS]                         = TILE_FLAG_UNUSED | TILE_FLAG_HAS_ENCOUNTERS,
-    [MB_UNUSED_05]                          = TILE_FLAG_HAS_ENCOUNTERS,
-    [MB_DEEP_SAND]                          = TILE_FLAG_UNUSED | TILE_FLAG_HAS_ENCOUNTERS,
-    [MB_SHORT_GRASS]                        = TILE_FLAG_UNUSED,
-    [MB_CAVE]                               = TILE_FLAG_UNUSED | TILE_FLAG_HAS_ENCOUNTERS,
-    [MB_LONG_GRASS_SOUTH_EDGE]              = TILE_FLAG_UNUSED,
-    [MB_NO_RUNNING]                         = TILE_FLAG_UNUSED,
-    [MB_INDOOR_ENCOUNTER]                   = TILE_FLAG_UNUSED | TILE_FLAG_HAS_ENCOUNTERS,
-    [MB_MOUNTAIN_TOP]                       = TILE_FLAG_UNUSED,
-    [MB_BATTLE_PYRAMID_WARP]                = TILE_FLAG_UNUSED,
-    [MB_MOSSDEEP_GYM_WARP]                  = TILE_FLAG_UNUSED,
-    [MB_MT_PYRE_HOLE]                       = TILE_FLAG_UNUSED,
-    [MB_POND_WATER]                         = TILE_FLAG_UNUSED | TILE_FLAG_SURFABLE | TILE_FLAG_HAS_ENCOUNTERS,
-    [MB_INTERIOR_DEEP_WATER]                = TILE_FLAG_UNUSED | TILE_FLAG_SURFABLE | TILE_FLAG_HAS_ENCOUNTERS,
-    [MB_DEEP_WATER]                         = TILE_FLAG_UNUSED | TILE_FLAG_SURFABLE | TILE_FLAG_HAS_ENCOUNTERS,
-    [MB_WATERFALL]                          = TILE_FLAG_UNUSED | TILE_FLAG_SURFABLE,
-    [MB_SOOTOPOLIS_DEEP_WATER]              = TILE_FLAG_UNUSED | TILE_FLAG_SURFABLE,
-    [MB_OCEAN_WATER]                        = TILE_FLAG_UNUSED | TILE_FLAG_SURFABLE | TILE_FLAG_HAS_ENCOUNTERS,
-    [MB_PUDDLE]                             = TILE_FLAG_UNUSED,
-    [MB_SHALLOW_WATER]                      = TILE_FLAG_UNUSED,
-    [MB_NO_SURFACING]                       = TILE_FLAG_UNUSED | TILE_FLAG_SURFABLE,
-    [MB_STAIRS_OUTSIDE_ABANDONED_SHIP]      = TILE_FLAG_UNUSED,
-    [MB_SHOAL_CAVE_ENTRANCE]                = TILE_FLAG_UNUSED,
-    [MB_ICE]                                = TILE_FLAG_UNUSED,
-    [MB_SAND]                               = TILE_FLAG_UNUSED,
-    [MB_SEAWEED]                            = TILE_FLAG_UNUSED | TILE_FLAG_SURFABLE | TILE_FLAG_HAS_ENCOUNTERS,
-    [MB_UNUSED_23]                          = TILE_FLAG_UNUSED,
-    [MB_ASHGRASS]                           = TILE_FLAG_UNUSED | TILE_FLAG_HAS_ENCOUNTERS,
-    [MB_FOOTPRINTS]                         = TILE_FLAG_UNUSED | TILE_FLAG_HAS_ENCOUNTERS,
-    [MB_THIN_ICE]                           = TILE_FLAG_UNUSED,
-    [MB_CRACKED_ICE]                        = TILE_FLAG_UNUSED,
-    [MB_HOT_SPRINGS]                        = TILE_FLAG_UNUSED,
-    [MB_LAVARIDGE_GYM_B1F_WARP]             = TILE_FLAG_UNUSED,
-    [MB_SEAWEED_NO_SURFACING]               = TILE_FLAG_UNUSED | TILE_FLAG_SURFABLE | TILE_FLAG_HAS_ENCOUNTERS,
-    [MB_REFLECTION_UNDER_BRIDGE]            = TILE_FLAG_UNUSED,
-    [MB_IMPASSABLE_EAST]                    = TILE_FLAG_UNUSED,
-    [MB_IMPASSABLE_WEST]                    = TILE_FLAG_UNUSED,
-    [MB_IMPASSABLE_NORTH]                   = TILE_FLAG_UNUSED,
-    [MB_IMPASSABLE_SOUTH]                   = TILE_FLAG_UNUSED,
-    [MB_IMPASSABLE_NORTHEAST]               = TILE_FLAG_UNUSED,
-    [MB_IMPASSABLE_NORTHWEST]               = TILE_FLAG_UNUSED,
-    [MB_IMPASSABLE_SOUTHEAST]               = TILE_FLAG_UNUSED,
-    [MB_IMPASSABLE_SOUTHWEST]               = TILE_FLAG_UNUSED,
-    [MB_JUMP_NORTHEAST]                     = TILE_FLAG_UNUSED,
-    [MB_JUMP_NORTHWEST]                     = TILE_FLAG_UNUSED,
-    [MB_JUMP_SOUTHEAST]                     = TILE_FLAG_UNUSED,
-    [MB_JUMP_SOUTHWEST]                     = TILE_FLAG_UNUSED,
-    [MB_WALK_EAST]                          = TILE_FLAG_UNUSED,
-    [MB_WALK_WEST]                          = TILE_FLAG_UNUSED,
-    [MB_WALK_NORTH]                         = TILE_FLAG_UNUSED,
-    [MB_WALK_SOUTH]                         = TILE_FLAG_UNUSED,
-    [MB_SLIDE_EAST]                         = TILE_FLAG_UNUSED,
-    [MB_SLIDE_WEST]                         = TILE_FLAG_UNUSED,
-    [MB_SLIDE_NORTH]                        = TILE_FLAG_UNUSED,
-    [MB_SLIDE_SOUTH]                        = TILE_FLAG_UNUSED,
-    [MB_TRICK_HOUSE_PUZZLE_8_FLOOR]         = TILE_FLAG_UNUSED,
-    [MB_EASTWARD_CURRENT]                   = TILE_FLAG_UNUSED | TILE_FLAG_SURFABLE,
-    [MB_WESTWARD_CURRENT]                   = TILE_FLAG_UNUSED | TILE_FLAG_SURFABLE,
-    [MB_NORTHWARD_CURRENT]                  = TILE_FLAG_UNUSED | TILE_FLAG_SURFABLE,
-    [MB_SOUTHWARD_CURRENT]                  = TILE_FLAG_UNUSED | TILE_FLAG_SURFABLE,
-    [MB_NON_ANIMATED_DOOR]                  = TILE_FLAG_UNUSED,
-    [MB_LADDER]                             = TILE_FLAG_UNUSED,
-    [MB_EAST_ARROW_WARP]                    = TILE_FLAG_UNUSED,
-    [MB_WEST_ARROW_WARP]                    = TILE_FLAG_UNUSED,
-    [MB_NORTH_ARROW_WARP]                   = TILE_FLAG_UNUSED,
-    [MB_SOUTH_ARROW_WARP]                   = TILE_FLAG_UNUSED,
-    [MB_CRACKED_FLOOR_HOLE]                 = TILE_FLAG_UNUSED,
-    [MB_AQUA_HIDEOUT_WARP]                  = TILE_FLAG_UNUSED,
-    [MB_LAVARIDGE_GYM_1F_WARP]              = TILE_FLAG_UNUSED,
-    [MB_ANIMATED_DOOR]                      = TILE_FLAG_UNUSED,
-    [MB_UP_ESCALATOR]                       = TILE_FLAG_UNUSED,
-    [MB_DOWN_ESCALATOR]                     = TILE_FLAG_UNUSED,
-    [MB_WATER_DOOR]                         = TILE_FLAG_UNUSED | TILE_FLAG_SURFABLE,
-    [MB_WATER_SOUTH_ARROW_WARP]             = TILE_FLAG_UNUSED | TILE_FLAG_SURFABLE,
-    [MB_DEEP_SOUTH_WARP]                    = TILE_FLAG_UNUSED,
-    [MB_UNUSED_6F]                          = TILE_FLAG_UNUSED | TILE_FLAG_SURFABLE,
-    [MB_BRIDGE_OVER_POND_LOW]               = TILE_FLAG_UNUSED,
-    [MB_BRIDGE_OVER_POND_MED]               = TILE_FLAG_UNUSED,
-    [MB_BRIDGE_OVER_POND_HIGH]              = TILE_FLAG_UNUSED,
-    [MB_PACIFIDLOG_VERTICAL_LOG_TOP]        = TILE_FLAG_UNUSED,
-    [MB_PACIFIDLOG_VERTICAL_LOG_BOTTOM]     = TILE_FLAG_UNUSED,
-    [MB_PACIFIDLOG_HORIZONTAL_LOG_LEFT]     = TILE_FLAG_UNUSED,
-    [MB_PACIFIDLOG_HORIZONTAL_LOG_RIGHT]    = TILE_FLAG_UNUSED,
-    [MB_FORTREE_BRIDGE]                     = TILE_FLAG_UNUSED,
-    [MB_BRIDGE_OVER_POND_MED_EDGE_1]        = TILE_FLAG_UNUSED,
-    [MB_BRIDGE_OVER_POND_MED_EDGE_2]        = TILE_FLAG_UNUSED,
-    [MB_BRIDGE_OVER_POND_HIGH_EDGE_1]       = TILE_FLAG_UNUSED,
-    [MB_BRIDGE_OVER_POND_HIGH_EDGE_2]       = TILE_FLAG_UNUSED,
-    [MB_UNUSED_BRIDGE]                      = TILE_FLAG_UNUSED,
-    [MB_BIKE_BRIDGE_OVER_BARRIER]           = TILE_FLAG_UNUSED,
-    [MB_SECRET_BASE_SCENERY]                = TILE_FLAG_UNUSED,
-    [MB_SECRET_BASE_TRAINER_SPOT]           = TILE_FLAG_UNUSED,
-    [MB_HOLDS_SMALL_DECORATION]             = TILE_FLAG_UNUSED,
-    [MB_SECRET_BASE_BALLOON]                = TILE_FLAG_UNUSED,
-    [MB_SECRET_BASE_IMPASSABLE]             = TILE_FLAG_UNUSED,
-    [MB_SECRET_BASE_GLITTER_MAT]            = TILE_FLAG_UNUSED,
-    [MB_SECRET_BASE_JUMP_MAT]               = TILE_FLAG_UNUSED,
-    [MB_SECRET_BASE_SPIN_MAT]               = TILE_FLAG_UNUSED,
-    [MB_SECRET_BASE_SOUND_MAT]              = TILE_FLAG_UNUSED,
-    [MB_SECRET_BASE_BREAKABLE_DOOR]         = TILE_FLAG_UNUSED,
-    [MB_IMPASSABLE_SOUTH_AND_NORTH]         = TILE_FLAG_UNUSED,
-    [MB_IMPASSABLE_WEST_AND_EAST]           = TILE_FLAG_UNUSED,
-    [MB_SECRET_BASE_HOLE]                   = TILE_FLAG_UNUSED,
-    [MB_HOLDS_LARGE_DECORATION]             = TILE_FLAG_UNUSED,
-    [MB_SECRET_BASE_TV_SHIELD]              = TILE_FLAG_UNUSED,
-    [MB_PLAYER_ROOM_PC_ON]                  = TILE_FLAG_UNUSED,
-    [MB_MUDDY_SLOPE]                        = TILE_FLAG_UNUSED,
-    [MB_BUMPY_SLOPE]                        = TILE_FLAG_UNUSED,
-    [MB_CRACKED_FLOOR]                      = TILE_FLAG_UNUSED,
-    [MB_ISOLATED_VERTICAL_RAIL]             = TILE_FLAG_UNUSED,
-    [MB_ISOLATED_HORIZONTAL_RAIL]           = TILE_FLAG_UNUSED,
-    [MB_VERTICAL_RAIL]                      = TILE_FLAG_UNUSED,
-    [MB_HORIZONTAL_RAIL]                    = TILE_FLAG_UNUSED,
-    [MB_SIGNPOST]                           = TILE_FLAG_UNUSED,
-    [MB_POKEMON_CENTER_SIGN]                = TILE_FLAG_UNUSED,
-    [MB_POKEMART_SIGN]                      = TILE_FLAG_UNUSED,
-    [MB_SIDEWAYS_STAIRS_RIGHT_SIDE]         = TILE_FLAG_UNUSED,
-    [MB_SIDEWAYS_STAIRS_LEFT_SIDE]          = TILE_FLAG_UNUSED,
-    [MB_SIDEWAYS_STAIRS_RIGHT_SIDE_TOP]     = TILE_FLAG_UNUSED,
-    [MB_SIDEWAYS_STAIRS_LEFT_SIDE_TOP]      = TILE_FLAG_UNUSED,
-    [MB_SIDEWAYS_STAIRS_RIGHT_SIDE_BOTTOM]  = TILE_FLAG_UNUSED,
-    [MB_SIDEWAYS_STAIRS_LEFT_SIDE_BOTTOM]   = TILE_FLAG_UNUSED,
-    [MB_ROCK_STAIRS]                        = TILE_FLAG_UNUSED,
+// Every property that a metatile behavior has, so that the checks made for each
+// step of each object cost one load instead of a chain of comparisons.
+// Behaviors that are not listed here have no properties. The table covers every
+// value a behavior's bits can hold, including MB_INVALID for tiles outside the map.
+const u32 gMetatileBehaviorProperties[METATILE_ATTR_BEHAVIOR_MASK + 1] =
+{
+    [MB_TALL_GRASS]                        = MB_PROP_HAS_ENCOUNTERS | MB_PROP_TALL_GRASS,
+    [MB_LONG_GRASS]                        = MB_PROP_HAS_ENCOUNTERS | MB_PROP_LONG_GRASS | MB_PROP_RUNNING_DISALLOWED,
+    [MB_UNUSED_05]                         = MB_PROP_HAS_ENCOUNTERS,
+    [MB_DEEP_SAND]                         = MB_PROP_HAS_ENCOUNTERS | MB_PROP_SAND | MB_PROP_DEEP_SAND,
+    [MB_SHORT_GRASS]                       = MB_PROP_SHORT_GRASS,
+    [MB_CAVE]                              = MB_PROP_HAS_ENCOUNTERS,
+    [MB_NO_RUNNING]                        = MB_PROP_RUNNING_DISALLOWED,
+    [MB_INDOOR_ENCOUNTER]                  = MB_PROP_HAS_ENCOUNTERS,
+    [MB_MOSSDEEP_GYM_WARP]                 = MB_PROP_WARP,
+    [MB_MT_PYRE_HOLE]                      = MB_PROP_WARP,
+    [MB_POND_WATER]                        = MB_PROP_HAS_ENCOUNTERS | MB_PROP_SURFABLE | MB_PROP_REFLECTIVE | MB_PROP_RIPPLES | MB_PROP_FISHABLE,
+    [MB_INTERIOR_DEEP_WATER]               = MB_PROP_HAS_ENCOUNTERS | MB_PROP_SURFABLE | MB_PROP_FISHABLE,
+    [MB_DEEP_WATER]                        = MB_PROP_HAS_ENCOUNTERS | MB_PROP_SURFABLE | MB_PROP_FISHABLE,
+    [MB_WATERFALL]                         = MB_PROP_SURFABLE | MB_PROP_FORCED_MOVEMENT,
+    [MB_SOOTOPOLIS_DEEP_WATER]             = MB_PROP_SURFABLE | MB_PROP_REFLECTIVE | MB_PROP_RIPPLES | MB_PROP_FISHABLE,
+    [MB_OCEAN_WATER]                       = MB_PROP_HAS_ENCOUNTERS | MB_PROP_SURFABLE | MB_PROP_FISHABLE,
+    [MB_PUDDLE]                            = MB_PROP_REFLECTIVE | MB_PROP_PUDDLE | MB_PROP_RIPPLES,
+    [MB_SHALLOW_WATER]                     = MB_PROP_SHALLOW_FLOWING_WATER,
+    [MB_NO_SURFACING]                      = MB_PROP_SURFABLE,
+    [MB_UNUSED_SOOTOPOLIS_DEEP_WATER_2]    = MB_PROP_REFLECTIVE,
+    [MB_STAIRS_OUTSIDE_ABANDONED_SHIP]     = MB_PROP_SHALLOW_FLOWING_WATER,
+    [MB_SHOAL_CAVE_ENTRANCE]               = MB_PROP_SHALLOW_FLOWING_WATER,
+    [MB_ICE]                               = MB_PROP_ICE | MB_PROP_REFLECTIVE | MB_PROP_FORCED_MOVEMENT,
+    [MB_SAND]                              = MB_PROP_SAND,
+    [MB_SEAWEED]                           = MB_PROP_HAS_ENCOUNTERS | MB_PROP_SURFABLE | MB_PROP_SEAWEED,
+    [MB_ASHGRASS]                          = MB_PROP_HAS_ENCOUNTERS,
+    [MB_FOOTPRINTS]                        = MB_PROP_HAS_ENCOUNTERS | MB_PROP_FOOTPRINTS,
+    [MB_HOT_SPRINGS]                       = MB_PROP_HOT_SPRINGS | MB_PROP_RUNNING_DISALLOWED,
+    [MB_LAVARIDGE_GYM_B1F_WARP]            = MB_PROP_WARP,
+    [MB_SEAWEED_NO_SURFACING]              = MB_PROP_HAS_ENCOUNTERS | MB_PROP_SURFABLE | MB_PROP_SEAWEED,
+    [MB_REFLECTION_UNDER_BRIDGE]           = MB_PROP_REFLECTIVE,
+    [MB_IMPASSABLE_EAST]                   = MB_PROP_EAST_BLOCKED,
+    [MB_IMPASSABLE_WEST]                   = MB_PROP_WEST_BLOCKED,
+    [MB_IMPASSABLE_NORTH]                  = MB_PROP_NORTH_BLOCKED,
+    [MB_IMPASSABLE_SOUTH]                  = MB_PROP_SOUTH_BLOCKED,
+    [MB_IMPASSABLE_NORTHEAST]              = MB_PROP_EAST_BLOCKED | MB_PROP_NORTH_BLOCKED,
+    [MB_IMPASSABLE_NORTHWEST]              = MB_PROP_WEST_BLOCKED | MB_PROP_NORTH_BLOCKED,
+    [MB_IMPASSABLE_SOUTHEAST]              = MB_PROP_EAST_BLOCKED | MB_PROP_SOUTH_BLOCKED,
+    [MB_IMPASSABLE_SOUTHWEST]              = MB_PROP_WEST_BLOCKED | MB_PROP_SOUTH_BLOCKED,
+    [MB_WALK_EAST]                         = MB_PROP_FORCED_MOVEMENT,
+    [MB_WALK_WEST]                         = MB_PROP_FORCED_MOVEMENT,
+    [MB_WALK_NORTH]                        = MB_PROP_FORCED_MOVEMENT,
+    [MB_WALK_SOUTH]                        = MB_PROP_FORCED_MOVEMENT,
+    [MB_SLIDE_EAST]                        = MB_PROP_FORCED_MOVEMENT,
+    [MB_SLIDE_WEST]                        = MB_PROP_FORCED_MOVEMENT,
+    [MB_SLIDE_NORTH]                       = MB_PROP_FORCED_MOVEMENT,
+    [MB_SLIDE_SOUTH]                       = MB_PROP_FORCED_MOVEMENT,
+    [MB_TRICK_HOUSE_PUZZLE_8_FLOOR]        = MB_PROP_FORCED_MOVEMENT,
+    [MB_SIDEWAYS_STAIRS_RIGHT_SIDE]        = MB_PROP_SIDEWAYS_STAIRS_RIGHT,
+    [MB_SIDEWAYS_STAIRS_LEFT_SIDE]         = MB_PROP_SIDEWAYS_STAIRS_LEFT,
+    [MB_SIDEWAYS_STAIRS_RIGHT_SIDE_TOP]    = MB_PROP_SIDEWAYS_STAIRS_RIGHT,
+    [MB_SIDEWAYS_STAIRS_LEFT_SIDE_TOP]     = MB_PROP_SIDEWAYS_STAIRS_LEFT,
+    [MB_SIDEWAYS_STAIRS_RIGHT_SIDE_BOTTOM] = MB_PROP_SIDEWAYS_STAIRS_RIGHT,
+    [MB_SIDEWAYS_STAIRS_LEFT_SIDE_BOTTOM]  = MB_PROP_SIDEWAYS_STAIRS_LEFT,
+    [MB_EASTWARD_CURRENT]                  = MB_PROP_SURFABLE | MB_PROP_FISHABLE | MB_PROP_FORCED_MOVEMENT,
+    [MB_WESTWARD_CURRENT]                  = MB_PROP_SURFABLE | MB_PROP_FISHABLE | MB_PROP_FORCED_MOVEMENT,
+    [MB_NORTHWARD_CURRENT]                 = MB_PROP_SURFABLE | MB_PROP_FISHABLE | MB_PROP_FORCED_MOVEMENT,
+    [MB_SOUTHWARD_CURRENT]                 = MB_PROP_SURFABLE | MB_PROP_FISHABLE | MB_PROP_FORCED_MOVEMENT,
+    [MB_NON_ANIMATED_DOOR]                 = MB_PROP_WARP,
+    [MB_LADDER]                            = MB_PROP_WARP,
+    [MB_AQUA_HIDEOUT_WARP]                 = MB_PROP_WARP,
+    [MB_LAVARIDGE_GYM_1F_WARP]             = MB_PROP_WARP,
+    [MB_ANIMATED_DOOR]                     = MB_PROP_WARP,
+    [MB_UP_ESCALATOR]                      = MB_PROP_WARP,
+    [MB_DOWN_ESCALATOR]                    = MB_PROP_WARP,
+    [MB_WATER_DOOR]                        = MB_PROP_SURFABLE | MB_PROP_WARP,
+    [MB_WATER_SOUTH_ARROW_WARP]            = MB_PROP_SURFABLE,
+    [MB_DEEP_SOUTH_WARP]                   = MB_PROP_WARP,
+    [MB_UNUSED_6F]                         = MB_PROP_SURFABLE,
+    [MB_BRIDGE_OVER_OCEAN]                 = MB_PROP_WARP | MB_PROP_BRIDGE_OVER_WATER,
+    [MB_BRIDGE_OVER_POND_LOW]              = MB_PROP_BRIDGE_OVER_WATER,
+    [MB_BRIDGE_OVER_POND_MED]              = MB_PROP_BRIDGE_OVER_WATER,
+    [MB_BRIDGE_OVER_POND_HIGH]             = MB_PROP_BRIDGE_OVER_WATER,
+    [MB_PACIFIDLOG_VERTICAL_LOG_TOP]       = MB_PROP_PACIFIDLOG_LOG | MB_PROP_RUNNING_DISALLOWED,
+    [MB_PACIFIDLOG_VERTICAL_LOG_BOTTOM]    = MB_PROP_PACIFIDLOG_LOG | MB_PROP_RUNNING_DISALLOWED,
+    [MB_PACIFIDLOG_HORIZONTAL_LOG_LEFT]    = MB_PROP_PACIFIDLOG_LOG | MB_PROP_RUNNING_DISALLOWED,
+    [MB_PACIFIDLOG_HORIZONTAL_LOG_RIGHT]   = MB_PROP_PACIFIDLOG_LOG | MB_PROP_RUNNING_DISALLOWED,
+    [MB_BRIDGE_OVER_POND_HIGH_EDGE_1]      = MB_PROP_BRIDGE_OVER_WATER,
+    [MB_BRIDGE_OVER_POND_HIGH_EDGE_2]      = MB_PROP_BRIDGE_OVER_WATER,
+    [MB_UNUSED_BRIDGE]                     = MB_PROP_BRIDGE_OVER_WATER,
+    [MB_BIKE_BRIDGE_OVER_BARRIER]          = MB_PROP_BRIDGE_OVER_WATER,
+    [MB_SECRET_BASE_JUMP_MAT]              = MB_PROP_FORCED_MOVEMENT,
+    [MB_SECRET_BASE_SPIN_MAT]              = MB_PROP_FORCED_MOVEMENT,
+    [MB_SECRET_BASE_BREAKABLE_DOOR]        = MB_PROP_EAST_BLOCKED | MB_PROP_WEST_BLOCKED,
+    [MB_IMPASSABLE_SOUTH_AND_NORTH]        = MB_PROP_NORTH_BLOCKED | MB_PROP_SOUTH_BLOCKED,
+    [MB_IMPASSABLE_WEST_AND_EAST]          = MB_PROP_EAST_BLOCKED | MB_PROP_WEST_BLOCKED,
+    [MB_MUDDY_SLOPE]                       = MB_PROP_FORCED_MOVEMENT,
+    [MB_CRACKED_FLOOR]                     = MB_PROP_FORCED_MOVEMENT,
 };
 
 bool8 MetatileBehavior_IsATile(u8 metatileBehavior)
@@ -142,10 +105,7 @@ bool8 MetatileBehavior_IsATile(u8 metatileBehavior)
 
 bool8 MetatileBehavior_IsEncounterTile(u8 metatileBehavior)
 {
-    if ((sTileBitAttributes[metatileBehavior] & TILE_FLAG_HAS_ENCOUNTERS))
-        return TRUE;
-    else
-        return FALSE;
+    return (gMetatileBehaviorProperties[metatileBehavior] & MB_PROP_HAS_ENCOUNTERS) != 0;
 }
 
 bool8 MetatileBehavior_IsJumpEast(u8 metatileBehavior)
@@ -182,18 +142,12 @@ bool8 MetatileBehavior_IsJumpSouth(u8 metatileBehavior)
 
 bool8 MetatileBehavior_IsPokeGrass(u8 metatileBehavior)
 {
-    if (metatileBehavior == MB_TALL_GRASS || metatileBehavior == MB_LONG_GRASS)
-        return TRUE;
-    else
-        return FALSE;
+    return (gMetatileBehaviorProperties[metatileBehavior] & (MB_PROP_TALL_GRASS | MB_PROP_LONG_GRASS)) != 0;
 }
 
 bool8 MetatileBehavior_IsSandOrDeepSand(u8 metatileBehavior)
 {
-    if (metatileBehavior == MB_SAND || metatileBehavior == MB_DEEP_SAND)
-        return TRUE;
-    else
-        return FALSE;
+    return (gMetatileBehaviorProperties[metatileBehavior] & MB_PROP_SAND) != 0;
 }
 
 bool8 MetatileBehavior_IsDeepSand(u8 metatileBehavior)
@@ -206,15 +160,7 @@ bool8 MetatileBehavior_IsDeepSand(u8 metatileBehavior)
 
 bool8 MetatileBehavior_IsReflective(u8 metatileBehavior)
 {
-    if (metatileBehavior == MB_POND_WATER
-     || metatileBehavior == MB_PUDDLE
-     || metatileBehavior == MB_UNUSED_SOOTOPOLIS_DEEP_WATER_2
-     || metatileBehavior == MB_ICE
-     || metatileBehavior == MB_SOOTOPOLIS_DEEP_WATER
-     || metatileBehavior == MB_REFLECTION_UNDER_BRIDGE)
-        return TRUE;
-    else
-        return FALSE;
+    return (gMetatileBehaviorProperties[metatileBehavior] & MB_PROP_REFLECTIVE) != 0;
 }
 
 bool8 MetatileBehavior_IsIce(u8 metatileBehavior)
@@ -287,10 +233,7 @@ bool8 MetatileBehavior_IsDeepSouthWarp(u8 metatileBehavior)
 
 bool8 MetatileBehavior_IsSurfableWaterOrUnderwater(u8 metatileBehavior)
 {
-    if ((sTileBitAttributes[metatileBehavior] & TILE_FLAG_SURFABLE))
-        return TRUE;
-    else
-        return FALSE;
+    return (gMetatileBehaviorProperties[metatileBehavior] & MB_PROP_SURFABLE) != 0;
 }
 
 bool8 MetatileBehavior_IsEastArrowWarp(u8 metatileBehavior)
@@ -345,17 +288,7 @@ bool8 Unref_MetatileBehavior_IsArrowWarp(u8 metatileBehavior)
 
 bool8 MetatileBehavior_IsForcedMovementTile(u8 metatileBehavior)
 {
-    if ((metatileBehavior >= MB_WALK_EAST && metatileBehavior <= MB_TRICK_HOUSE_PUZZLE_8_FLOOR)
-     || (metatileBehavior >= MB_EASTWARD_CURRENT && metatileBehavior <= MB_SOUTHWARD_CURRENT)
-     || metatileBehavior == MB_MUDDY_SLOPE
-     || metatileBehavior == MB_CRACKED_FLOOR
-     || metatileBehavior == MB_WATERFALL
-     || metatileBehavior == MB_ICE
-     || metatileBehavior == MB_SECRET_BASE_JUMP_MAT
-     || metatileBehavior == MB_SECRET_BASE_SPIN_MAT)
-        return TRUE;
-    else
-        return FALSE;
+    return (gMetatileBehaviorProperties[metatileBehavior] & MB_PROP_FORCED_MOVEMENT) != 0;
 }
 
 bool8 MetatileBehavior_IsIce_2(u8 metatileBehavior)
@@ -718,12 +651,7 @@ bool8 MetatileBehavior_IsPlayerRoomPCOn(u8 metatileBehavior)
 
 bool8 MetatileBehavior_HasRipples(u8 metatileBehavior)
 {
-    if (metatileBehavior == MB_POND_WATER
-     || metatileBehavior == MB_PUDDLE
-     || metatileBehavior == MB_SOOTOPOLIS_DEEP_WATER)
-        return TRUE;
-    else
-        return FALSE;
+    return (gMetatileBehaviorProperties[metatileBehavior] & MB_PROP_RIPPLES) != 0;
 }
 
 bool8 MetatileBehavior_IsPuddle(u8 metatileBehavior)
@@ -780,17 +708,7 @@ bool8 MetatileBehavior_IsFootprints(u8 metatileBehavior)
 // This is used to allow encounters on the water below the bridge.
 bool8 MetatileBehavior_IsBridgeOverWater(u8 metatileBehavior)
 {
-    if ((metatileBehavior == MB_BRIDGE_OVER_OCEAN
-      || metatileBehavior == MB_BRIDGE_OVER_POND_LOW
-      || metatileBehavior == MB_BRIDGE_OVER_POND_MED
-      || metatileBehavior == MB_BRIDGE_OVER_POND_HIGH)
-      || (metatileBehavior == MB_BRIDGE_OVER_POND_HIGH_EDGE_1
-       || metatileBehavior == MB_BRIDGE_OVER_POND_HIGH_EDGE_2
-       || metatileBehavior == MB_UNUSED_BRIDGE
-       || metatileBehavior == MB_BIKE_BRIDGE_OVER_BARRIER))
-        return TRUE;
-    else
-        return FALSE;
+    return (gMetatileBehaviorProperties[metatileBehavior] & MB_PROP_BRIDGE_OVER_WATER) != 0;
 }
 
 u8 MetatileBehavior_GetBridgeType(u8 metatileBehavior)
@@ -826,20 +744,12 @@ bool8 MetatileBehavior_IsBridgeOverWaterNoEdge(u8 metatileBehavior)
 
 bool8 MetatileBehavior_IsLandWildEncounter(u8 metatileBehavior)
 {
-    if (MetatileBehavior_IsSurfableWaterOrUnderwater(metatileBehavior) == FALSE
-     && MetatileBehavior_IsEncounterTile(metatileBehavior) == TRUE)
-        return TRUE;
-    else
-        return FALSE;
+    return (gMetatileBehaviorProperties[metatileBehavior] & (MB_PROP_HAS_ENCOUNTERS | MB_PROP_SURFABLE)) == MB_PROP_HAS_ENCOUNTERS;
 }
 
 bool8 MetatileBehavior_IsWaterWildEncounter(u8 metatileBehavior)
 {
-    if (MetatileBehavior_IsSurfableWaterOrUnderwater(metatileBehavior) == TRUE
-     && MetatileBehavior_IsEncounterTile(metatileBehavior) == TRUE)
-        return TRUE;
-    else
-        return FALSE;
+    return (gMetatileBehaviorProperties[metatileBehavior] & (MB_PROP_HAS_ENCOUNTERS | MB_PROP_SURFABLE)) == (MB_PROP_HAS_ENCOUNTERS | MB_PROP_SURFABLE);
 }
 
 bool8 MetatileBehavior_IsIndoorEncounter(u8 metatileBehavior)
@@ -886,12 +796,7 @@ bool8 MetatileBehavior_IsUnableToEmerge(u8 metatileBehavior)
 
 bool8 MetatileBehavior_IsShallowFlowingWater(u8 metatileBehavior)
 {
-    if (metatileBehavior == MB_SHALLOW_WATER
-     || metatileBehavior == MB_STAIRS_OUTSIDE_ABANDONED_SHIP
-     || metatileBehavior == MB_SHOAL_CAVE_ENTRANCE)
-        return TRUE;
-    else
-        return FALSE;
+    return (gMetatileBehaviorProperties[metatileBehavior] & MB_PROP_SHALLOW_FLOWING_WATER) != 0;
 }
 
 bool8 MetatileBehavior_IsThinIce(u8 metatileBehavior)
@@ -931,57 +836,27 @@ bool8 Unref_MetatileBehavior_IsUnusedSootopolisWater(u8 metatileBehavior)
 
 bool8 MetatileBehavior_IsSurfableAndNotWaterfall(u8 metatileBehavior)
 {
-    if (MetatileBehavior_IsSurfableWaterOrUnderwater(metatileBehavior)
-     && MetatileBehavior_IsWaterfall(metatileBehavior) == FALSE)
-        return TRUE;
-    else
-        return FALSE;
+    return (gMetatileBehaviorProperties[metatileBehavior] & MB_PROP_SURFABLE) && metatileBehavior != MB_WATERFALL;
 }
 
 bool8 MetatileBehavior_IsEastBlocked(u8 metatileBehavior)
 {
-    if (metatileBehavior == MB_IMPASSABLE_EAST
-     || metatileBehavior == MB_IMPASSABLE_NORTHEAST
-     || metatileBehavior == MB_IMPASSABLE_SOUTHEAST
-     || metatileBehavior == MB_IMPASSABLE_WEST_AND_EAST
-     || metatileBehavior == MB_SECRET_BASE_BREAKABLE_DOOR)
-        return TRUE;
-    else
-        return FALSE;
+    return (gMetatileBehaviorProperties[metatileBehavior] & MB_PROP_EAST_BLOCKED) != 0;
 }
 
 bool8 MetatileBehavior_IsWestBlocked(u8 metatileBehavior)
 {
-    if (metatileBehavior == MB_IMPASSABLE_WEST
-     || metatileBehavior == MB_IMPASSABLE_NORTHWEST
-     || metatileBehavior == MB_IMPASSABLE_SOUTHWEST
-     || metatileBehavior == MB_IMPASSABLE_WEST_AND_EAST
-     || metatileBehavior == MB_SECRET_BASE_BREAKABLE_DOOR)
-        return TRUE;
-    else
-        return FALSE;
+    return (gMetatileBehaviorProperties[metatileBehavior] & MB_PROP_WEST_BLOCKED) != 0;
 }
 
 bool8 MetatileBehavior_IsNorthBlocked(u8 metatileBehavior)
 {
-    if (metatileBehavior == MB_IMPASSABLE_NORTH
-     || metatileBehavior == MB_IMPASSABLE_NORTHEAST
-     || metatileBehavior == MB_IMPASSABLE_NORTHWEST
-     || metatileBehavior == MB_IMPASSABLE_SOUTH_AND_NORTH)
-        return TRUE;
-    else
-        return FALSE;
+    return (gMetatileBehaviorProperties[metatileBehavior] & MB_PROP_NORTH_BLOCKED) != 0;
 }
 
 bool8 MetatileBehavior_IsSouthBlocked(u8 metatileBehavior)
 {
-    if (metatileBehavior == MB_IMPASSABLE_SOUTH
-     || metatileBehavior == MB_IMPASSABLE_SOUTHEAST
-     || metatileBehavior == MB_IMPASSABLE_SOUTHWEST
-     || metatileBehavior == MB_IMPASSABLE_SOUTH_AND_NORTH)
-        return TRUE;
-    else
-        return FALSE;
+    return (gMetatileBehaviorProperties[metatileBehavior] & MB_PROP_SOUTH_BLOCKED) != 0;
 }
 
 bool8 MetatileBehavior_IsShortGrass(u8 metatileBehavior)
@@ -1050,13 +925,7 @@ bool8 MetatileBehavior_IsPacifidlogHorizontalLogRight(u8 metatileBehavior)
 
 bool8 MetatileBehavior_IsPacifidlogLog(u8 metatileBehavior)
 {
-    if (metatileBehavior == MB_PACIFIDLOG_VERTICAL_LOG_TOP
-     || metatileBehavior == MB_PACIFIDLOG_VERTICAL_LOG_BOTTOM
-     || metatileBehavior == MB_PACIFIDLOG_HORIZONTAL_LOG_LEFT
-     || metatileBehavior == MB_PACIFIDLOG_HORIZONTAL_LOG_RIGHT)
-        return TRUE;
-    else
-        return FALSE;
+    return (gMetatileBehaviorProperties[metatileBehavior] & MB_PROP_PACIFIDLOG_LOG) != 0;
 }
 
 bool8 MetatileBehavior_IsTrickHousePuzzleDoor(u8 metatileBehavior)
@@ -1169,18 +1038,7 @@ bool8 MetatileBehavior_IsMossdeepGymWarp(u8 metatileBehavior)
 
 bool8 MetatileBehavior_IsSurfableFishableWater(u8 metatileBehavior)
 {
-    if (metatileBehavior == MB_POND_WATER
-     || metatileBehavior == MB_OCEAN_WATER
-     || metatileBehavior == MB_INTERIOR_DEEP_WATER
-     || metatileBehavior == MB_DEEP_WATER
-     || metatileBehavior == MB_SOOTOPOLIS_DEEP_WATER
-     || (metatileBehavior == MB_EASTWARD_CURRENT
-      || metatileBehavior == MB_WESTWARD_CURRENT
-      || metatileBehavior == MB_NORTHWARD_CURRENT
-      || metatileBehavior == MB_SOUTHWARD_CURRENT))
-        return TRUE;
-    else
-        return FALSE;
+    return (gMetatileBehaviorProperties[metatileBehavior] & MB_PROP_FISHABLE) != 0;
 }
 
 bool8 MetatileBehavior_IsMtPyreHole(u8 metatileBehavior)
@@ -1257,21 +1115,12 @@ bool8 MetatileBehavior_IsHorizontalRail(u8 metatileBehavior)
 
 bool8 MetatileBehavior_IsSeaweed(u8 metatileBehavior)
 {
-    if (metatileBehavior == MB_SEAWEED || metatileBehavior == MB_SEAWEED_NO_SURFACING)
-        return TRUE;
-    else
-        return FALSE;
+    return (gMetatileBehaviorProperties[metatileBehavior] & MB_PROP_SEAWEED) != 0;
 }
 
 bool8 MetatileBehavior_IsRunningDisallowed(u8 metatileBehavior)
 {
-    if (metatileBehavior == MB_NO_RUNNING
-     || metatileBehavior == MB_LONG_GRASS
-     || metatileBehavior == MB_HOT_SPRINGS
-     || MetatileBehavior_IsPacifidlogLog(metatileBehavior) != FALSE)
-        return TRUE;
-    else
-        return FALSE;
+    return (gMetatileBehaviorProperties[metatileBehavior] & MB_PROP_RUNNING_DISALLOWED) != 0;
 }
 
 bool8 MetatileBehavior_IsCuttableGrass(u8 metatileBehavior)
@@ -1517,22 +1366,12 @@ bool8 MetatileBehavior_IsSidewaysStairsLeftSideBottom(u8 metatileBehavior)
 
 bool8 MetatileBehavior_IsSidewaysStairsRightSideAny(u8 metatileBehavior)
 {
-    if (metatileBehavior == MB_SIDEWAYS_STAIRS_RIGHT_SIDE
-     || metatileBehavior == MB_SIDEWAYS_STAIRS_RIGHT_SIDE_BOTTOM
-     || metatileBehavior == MB_SIDEWAYS_STAIRS_RIGHT_SIDE_TOP)
-        return TRUE;
-    else
-        return FALSE;
+    return (gMetatileBehaviorProperties[metatileBehavior] & MB_PROP_SIDEWAYS_STAIRS_RIGHT) != 0;
 }
 
 bool8 MetatileBehavior_IsSidewaysStairsLeftSideAny(u8 metatileBehavior)
 {
-    if (metatileBehavior == MB_SIDEWAYS_STAIRS_LEFT_SIDE
-     || metatileBehavior == MB_SIDEWAYS_STAIRS_LEFT_SIDE_BOTTOM
-     || metatileBehavior == MB_SIDEWAYS_STAIRS_LEFT_SIDE_TOP)
-        return TRUE;
-    else
-        return FALSE;
+    return (gMetatileBehaviorProperties[metatileBehavior] & MB_PROP_SIDEWAYS_STAIRS_LEFT) != 0;
 }
 
 bool8 MetatileBehavior_IsRockStairs(u8 metatileBehavior)
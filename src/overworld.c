@@ -858,7 +858,10 @@ if (I_VS_SEEKER_CHARGING != 0)
     Overworld_ClearSavedMusic();
     RunOnTransitionMapScript();
     InitMap();
-    CopySecondaryTilesetToVramUsingHeap(gMapHeader.mapLayout);
+    if (OW_STREAM_CONNECTION_TILESETS)
+        CopySecondaryTilesetToVramStreamed(gMapHeader.mapLayout);
+    else
+        CopySecondaryTilesetToVramUsingHeap(gMapHeader.mapLayout);
     LoadSecondaryTilesetPalette(gMapHeader.mapLayout);
 
     for (paletteIndex = NUM_PALS_IN_PRIMARY; paletteIndex < NUM_PALS_TOTAL; paletteIndex++)
@@ -889,6 +892,7 @@ static void LoadMapFromWarp(bool32 a1)
     bool8 isOutdoors;
     bool8 isIndoors;
 
+    CancelConnectionTilesetStream();
     LoadCurrentMapData();
     if (!(sObjectEventLoadFlag & SKIP_OBJECT_EVENT_LOAD))
     {
@@ -1488,6 +1492,7 @@ static void InitOverworldBgs(void)
 void CleanupOverworldWindowsAndTilemaps(void)
 {
     ClearMirageTowerPulseBlendEffect();
+    CancelConnectionTilesetStream();
     FreeAllOverworldWindowBuffers();
     TRY_FREE_AND_SET_NULL(gOverworldTilemapBuffer_Bg3);
     TRY_FREE_AND_SET_NULL(gOverworldTilemapBuffer_Bg2);
@@ -1545,6 +1550,8 @@ static void OverworldBasic(void)
     BuildOamBuffer();
     UpdatePaletteFade();
     UpdateTilesetAnimations();
+    if (OW_STREAM_CONNECTION_TILESETS)
+        UpdateConnectionTilesetStream();
     DoScheduledBgTilemapCopiesToVram();
 }
 
@@ -3036,6 +3043,7 @@ static void SpawnLinkPlayerObjectEvent(u8 linkPlayerId, s16 x, s16 y, u8 gender)
     objEvent->spriteId = MAX_SPRITES;
 
     InitLinkPlayerObjectEventPos(objEvent, x, y);
+    UpdateObjectEventSpatialIndex(objEvent);
 }
 
 static void InitLinkPlayerObjectEventPos(struct ObjectEvent *objEvent, s16 x, s16 y)
@@ -3068,6 +3076,7 @@ static void UNUSED DestroyLinkPlayerObject(u8 linkPlayerId)
         DestroySprite(&gSprites[objEvent->spriteId]);
     linkPlayerObjEvent->active = 0;
     objEvent->active = 0;
+    UpdateObjectEventSpatialIndex(objEvent);
 }
 
 // Returns the spriteId corresponding to this player.
@@ -22,6 +22,7 @@ static u32 UpdateHardwarePaletteFade(void);
 static void UpdateBlendRegisters(void);
 static bool32 IsSoftwarePaletteFadeFinishing(void);
 static void Task_BlendPalettesGradually(u8 taskId);
+static void BlendSelectedPalettes(u32 selectedPalettes, u32 paletteOffset, u32 coeff, u32 color);
 
 // palette buffers require alignment with agbcc because
 // unaligned word reads are issued in BlendPalette otherwise
@@ -197,17 +198,7 @@ static u32 UpdateNormalPaletteFade(void)
             paletteOffset = OBJ_PLTT_OFFSET;
         }
 
-        while (selectedPalettes)
-        {
-            if (selectedPalettes & 1)
-                BlendPalette(
-                    paletteOffset,
-                    16,
-                    gPaletteFade.y,
-                    gPaletteFade.blendColor);
-            selectedPalettes >>= 1;
-            paletteOffset += 16;
-        }
+        BlendSelectedPalettes(selectedPalettes, paletteOffset, gPaletteFade.y, gPaletteFade.blendColor);
 
         gPaletteFade.objPaletteToggle ^= 1;
 
@@ -585,18 +576,34 @@ static bool32 IsSoftwarePaletteFadeFinishing(void)
     }
 }
 
-void BlendPalettes(u32 selectedPalettes, u8 coeff, u32 color)
+// Blends each run of consecutive selected palettes with a single call.
+static void BlendSelectedPalettes(u32 selectedPalettes, u32 paletteOffset, u32 coeff, u32 color)
 {
-    u16 paletteOffset;
-
-    for (paletteOffset = 0; selectedPalettes; paletteOffset += 16)
+    while (selectedPalettes)
     {
-        if (selectedPalettes & 1)
-            BlendPalette(paletteOffset, 16, coeff, color);
-        selectedPalettes >>= 1;
+        u32 count = 0;
+
+        while (!(selectedPalettes & 1))
+        {
+            selectedPalettes >>= 1;
+            paletteOffset += 16;
+        }
+        while (selectedPalettes & 1)
+        {
+            selectedPalettes >>= 1;
+            count += 16;
+        }
+
+        BlendColors(&gPlttBufferUnfaded[paletteOffset], &gPlttBufferFaded[paletteOffset], count, coeff, color);
+        paletteOffset += count;
     }
 }
 
+void BlendPalettes(u32 selectedPalettes, u8 coeff, u32 color)
+{
+    BlendSelectedPalettes(selectedPalettes, 0, coeff, color);
+}
+
 void BlendPalettesUnfaded(u32 selectedPalettes, u8 coeff, u32 color)
 {
     void *src = gPlttBufferUnfaded;
@@ -605,23 +612,6 @@ void BlendPalettesUnfaded(u32 selectedPalettes, u8 coeff, u32 color)
     BlendPalettes(selectedPalettes, coeff, color);
 }
 
-void TintPalette_GrayScale(u16 *palette, u32 count)
-{
-    s32 r, g, b;
-    u32 i, gray;
-
-    for (i = 0; i < count; i++)
-    {
-        r = GET_R(*palette);
-        g = GET_G(*palette);
-        b = GET_B(*palette);
-
-        gray = (r * Q_8_8(0.3) + g * Q_8_8(0.59) + b * Q_8_8(0.1133)) >> 8;
-
-        *palette++ = RGB2(gray, gray, gray);
-    }
-}
-
 void TintPalette_GrayScale2(u16 *palette, u32 count)
 {
     s32 r, g, b;
@@ -644,7 +634,7 @@ void TintPalette_GrayScale2(u16 *palette, u32 count)
     }
 }
 
-void TintPalette_SepiaTone(u16 *palette, u32 count)
+void TintPalette_CustomTone(u16 *palette, u32 count, u16 rTone, u16 gTone, u16 bTone)
 {
     s32 r, g, b;
     u32 i, gray;
@@ -657,43 +647,123 @@ void TintPalette_SepiaTone(u16 *palette, u32 count)
 
         gray = (r * Q_8_8(0.3) + g * Q_8_8(0.59) + b * Q_8_8(0.1133)) >> 8;
 
-        r = (u16)((Q_8_8(1.2) * gray)) >> 8;
-        g = (u16)((Q_8_8(1.0) * gray)) >> 8;
-        b = (u16)((Q_8_8(0.94) * gray)) >> 8;
+        r = (u16)((rTone * gray)) >> 8;
+        g = (u16)((gTone * gray)) >> 8;
+        b = (u16)((bTone * gray)) >> 8;
 
         if (r > 31)
             r = 31;
+        if (g > 31)
+            g = 31;
+        if (b > 31)
+            b = 31;
 
         *palette++ = RGB2(r, g, b);
     }
 }
 
-void TintPalette_CustomTone(u16 *palette, u32 count, u16 rTone, u16 gTone, u16 bTone)
+/* The kernels below blend and tint two BGR555 colors per word. Each
+ * channel of both colors is masked into a pair of 16-bit lanes, which
+ * have enough headroom that multiplying them never carries from one
+ * color into the other. Lone colors at either end of an odd-aligned or
+ * odd-sized range use the same lane code with the upper color empty. */
+#define LANES_5BIT 0x001F001F
+#define LANES_6BIT 0x003F003F
+
+// c + (((b - c) * coeff) >> 4) == (c * (16 - coeff) + b * coeff) >> 4,
+// and the latter never goes negative so it needs no sign handling.
+ARM_FUNC static inline u32 BlendLanes(u32 colors, u32 invCoeff, u32 rBlend, u32 gBlend, u32 bBlend)
 {
-    s32 r, g, b;
-    u32 i, gray;
+    u32 r = ((colors & LANES_5BIT) * invCoeff + rBlend) >> 4;
+    u32 g = (((colors >> 5) & LANES_5BIT) * invCoeff + gBlend) >> 4;
+    u32 b = (((colors >> 10) & LANES_5BIT) * invCoeff + bBlend) >> 4;
+    return (r & LANES_5BIT) | ((g & LANES_5BIT) << 5) | ((b & LANES_5BIT) << 10);
+}
 
-    for (i = 0; i < count; i++)
+ARM_FUNC static inline u32 GrayLanes(u32 colors)
+{
+    u32 gray = ((colors & LANES_5BIT) * Q_8_8(0.3)
+              + ((colors >> 5) & LANES_5BIT) * Q_8_8(0.59)
+              + ((colors >> 10) & LANES_5BIT) * Q_8_8(0.1133)) >> 8;
+    return gray & LANES_5BIT;
+}
+
+ARM_FUNC static inline u32 SepiaLanes(u32 colors)
+{
+    u32 gray = GrayLanes(colors);
+    u32 r = ((gray * Q_8_8(1.2)) >> 8) & LANES_6BIT;
+    u32 b = ((gray * Q_8_8(0.94)) >> 8) & LANES_5BIT;
+    // Saturate red at 31 (it is at most 37, so only bit 5 can be set).
+    u32 overflow = r & (LANES_6BIT ^ LANES_5BIT);
+    r = (r | (overflow - (overflow >> 5))) & LANES_5BIT;
+    return r | (gray << 5) | (b << 10);
+}
+
+// Blends count colors from src towards blendColor by coeff/16 into dst,
+// which may be src. Matches BlendPalette's per-channel rounding.
+IWRAM_CODE void BlendColors(const u16 *src, u16 *dst, u32 count, u32 coeff, u32 blendColor)
+{
+    u32 invCoeff = 16 - coeff;
+    u32 rBlend = GET_R(blendColor) * coeff * 0x10001;
+    u32 gBlend = GET_G(blendColor) * coeff * 0x10001;
+    u32 bBlend = GET_B(blendColor) * coeff * 0x10001;
+
+    // Pairs of colors can only be loaded and stored as words if src and
+    // dst have the same alignment.
+    if (((uintptr_t)src ^ (uintptr_t)dst) & 2)
     {
-        r = GET_R(*palette);
-        g = GET_G(*palette);
-        b = GET_B(*palette);
+        while (count--)
+            *dst++ = BlendLanes(*src++, invCoeff, rBlend, gBlend, bBlend);
+        return;
+    }
 
-        gray = (r * Q_8_8(0.3) + g * Q_8_8(0.59) + b * Q_8_8(0.1133)) >> 8;
+    if (count != 0 && ((uintptr_t)dst & 2))
+    {
+        *dst++ = BlendLanes(*src++, invCoeff, rBlend, gBlend, bBlend);
+        count--;
+    }
+    for (; count >= 2; count -= 2, src += 2, dst += 2)
+        *(u32 *)dst = BlendLanes(*(const u32 *)src, invCoeff, rBlend, gBlend, bBlend);
+    if (count != 0)
+        *dst = BlendLanes(*src, invCoeff, rBlend, gBlend, bBlend);
+}
 
-        r = (u16)((rTone * gray)) >> 8;
-        g = (u16)((gTone * gray)) >> 8;
-        b = (u16)((bTone * gray)) >> 8;
+// Maps each channel of count colors from src through colorMap into dst.
+IWRAM_CODE void ColorMapColors(const u16 *src, u16 *dst, u32 count, const u8 *colorMap)
+{
+    while (count--)
+    {
+        u32 color = *src++;
+        *dst++ = RGB2(colorMap[GET_R(color)], colorMap[GET_G(color)], colorMap[GET_B(color)]);
+    }
+}
 
-        if (r > 31)
-            r = 31;
-        if (g > 31)
-            g = 31;
-        if (b > 31)
-            b = 31;
+IWRAM_CODE void TintPalette_GrayScale(u16 *palette, u32 count)
+{
+    if (count != 0 && ((uintptr_t)palette & 2))
+    {
+        *palette = GrayLanes(*palette) * RGB(1, 1, 1);
+        palette++;
+        count--;
+    }
+    for (; count >= 2; count -= 2, palette += 2)
+        *(u32 *)palette = GrayLanes(*(u32 *)palette) * RGB(1, 1, 1);
+    if (count != 0)
+        *palette = GrayLanes(*palette) * RGB(1, 1, 1);
+}
 
-        *palette++ = RGB2(r, g, b);
+IWRAM_CODE void TintPalette_SepiaTone(u16 *palette, u32 count)
+{
+    if (count != 0 && ((uintptr_t)palette & 2))
+    {
+        *palette = SepiaLanes(*palette);
+        palette++;
+        count--;
     }
+    for (; count >= 2; count -= 2, palette += 2)
+        *(u32 *)palette = SepiaLanes(*(u32 *)palette);
+    if (count != 0)
+        *palette = SepiaLanes(*palette);
 }
 
 #define tCoeff       data[0]
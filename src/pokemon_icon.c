@@ -231,15 +231,13 @@ void SafeLoadMonIconPalette(u16 species)
 {
     u8 palIndex;
     palIndex = gSpeciesInfo[SanitizeSpeciesId(species)].iconPalIndex;
-    if (IndexOfSpritePaletteTag(gMonIconPaletteTable[palIndex].tag) == 0xFF)
-        LoadSpritePalette(&gMonIconPaletteTable[palIndex]);
+    AcquireSpritePalette(&gMonIconPaletteTable[palIndex], FALSE);
 }
 
 void LoadMonIconPalette(u16 species)
 {
     u8 palIndex = gSpeciesInfo[SanitizeSpeciesId(species)].iconPalIndex;
-    if (IndexOfSpritePaletteTag(gMonIconPaletteTable[palIndex].tag) == 0xFF)
-        LoadSpritePalette(&gMonIconPaletteTable[palIndex]);
+    AcquireSpritePalette(&gMonIconPaletteTable[palIndex], FALSE);
 }
 
 void LoadMonIconPalettePersonality(u16 species, u32 personality)
@@ -252,8 +250,7 @@ void LoadMonIconPalettePersonality(u16 species, u32 personality)
     else
 #endif
         palIndex = gSpeciesInfo[species].iconPalIndex;
-    if (IndexOfSpritePaletteTag(gMonIconPaletteTable[palIndex].tag) == 0xFF)
-        LoadSpritePalette(&gMonIconPaletteTable[palIndex]);
+    AcquireSpritePalette(&gMonIconPaletteTable[palIndex], FALSE);
 }
 
 void FreeMonIconPalettes(void)
@@ -263,19 +260,20 @@ void FreeMonIconPalettes(void)
         FreeSpritePaletteByTag(gMonIconPaletteTable[i].tag);
 }
 
-// unused
+// The icon palettes are shared between species, so a palette is only
+// freed once every icon that loaded it has freed it too.
 void SafeFreeMonIconPalette(u16 species)
 {
     u8 palIndex;
     palIndex = gSpeciesInfo[SanitizeSpeciesId(species)].iconPalIndex;
-    FreeSpritePaletteByTag(gMonIconPaletteTable[palIndex].tag);
+    ReleaseSpritePalette(gMonIconPaletteTable[palIndex].tag);
 }
 
 void FreeMonIconPalette(u16 species)
 {
     u8 palIndex;
     palIndex = gSpeciesInfo[SanitizeSpeciesId(species)].iconPalIndex;
-    FreeSpritePaletteByTag(gMonIconPaletteTable[palIndex].tag);
+    ReleaseSpritePalette(gMonIconPaletteTable[palIndex].tag);
 }
 
 void SpriteCB_MonIcon(struct Sprite *sprite)
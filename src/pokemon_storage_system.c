@@ -105,6 +105,7 @@ enum {
     MSG_ITEM_IS_HELD,
     MSG_CHANGED_TO_ITEM,
     MSG_CANT_STORE_MAIL,
+    MSG_NO_OTHERS_FOUND,
 };
 
 // IDs for how to resolve variables in the above messages
@@ -160,6 +161,7 @@ enum {
     MENU_POKECENTER,
     MENU_MACHINE,
     MENU_SIMPLE,
+    MENU_FIND,
 };
 #define MENU_WALLPAPER_SETS_START MENU_SCENERY_1
 #define MENU_WALLPAPERS_START MENU_FOREST
@@ -408,6 +410,7 @@ struct PokemonStorageSystemData
     u8 closeBoxFlashTimer;
     bool8 closeBoxFlashState;
     s16 newCurrBoxId;
+    u8 foundBoxPosition;
     u16 bg2_X;
     s16 scrollSpeed;
     u16 scrollTimer;
@@ -580,6 +583,8 @@ static void Task_ReleaseMon(u8);
 static void Task_ReshowPokeStorage(u8);
 static void Task_PokeStorageMain(u8);
 static void Task_JumpBox(u8);
+static void Task_FindStorageMon(u8);
+static bool32 FindNextMatchingMon(void);
 static void Task_HandleWallpapers(u8);
 static void Task_NameBox(u8);
 static void Task_PrintCantStoreMail(u8);
@@ -735,6 +740,7 @@ static void InitCursor(void);
 static void InitCursorOnReopen(void);
 static void GetCursorCoordsByPos(u8, u8, u16 *, u16 *);
 static bool8 UpdateCursorPos(void);
+static void SetCursorPosition(u8, u8);
 static void DoCursorNewPosUpdate(void);
 static void SetCursorInParty(void);
 static void SetCursorBoxPosition(u8);
@@ -1073,6 +1079,7 @@ static const struct StorageMessage sMessages[] =
     [MSG_ITEM_IS_HELD]         = {COMPOUND_STRING("{DYNAMIC 0} is now held."),   MSG_VAR_ITEM_NAME},
     [MSG_CHANGED_TO_ITEM]      = {COMPOUND_STRING("Changed to {DYNAMIC 0}."),    MSG_VAR_ITEM_NAME},
     [MSG_CANT_STORE_MAIL]      = {COMPOUND_STRING("MAIL can't be stored!"),      MSG_VAR_NONE},
+    [MSG_NO_OTHERS_FOUND]      = {COMPOUND_STRING("No others were found."),      MSG_VAR_NONE},
 };
 
 static const struct WindowTemplate sYesNoWindowTemplate =
@@ -1379,7 +1386,7 @@ u8 CountMonsInBox(u8 boxId)
 
     for (i = 0, count = 0; i < IN_BOX_COUNT; i++)
     {
-        if (GetBoxMonDataAt(boxId, i, MON_DATA_SPECIES) != SPECIES_NONE)
+        if (GetBoxMonSummaryAt(boxId, i).species != SPECIES_NONE)
             count++;
     }
 
@@ -1714,6 +1721,7 @@ void ResetPokemonStorageSystem(void)
         for (boxPosition = 0; boxPosition < IN_BOX_COUNT; boxPosition++)
             ZeroBoxMonAt(boxId, boxPosition);
     }
+    ResetBoxMonSummaries();
     for (boxId = 0; boxId < TOTAL_BOXES_COUNT; boxId++)
     {
         u8 *dest = StringCopy(GetBoxNamePtr(boxId), gText_Box);
@@ -2686,6 +2694,18 @@ static void Task_OnSelectedMon(u8 taskId)
         case MENU_INFO:
             SetPokeStorageTask(Task_ShowItemInfo);
             break;
+        case MENU_FIND:
+            if (!FindNextMatchingMon())
+            {
+                sStorage->state = 7;
+            }
+            else
+            {
+                PlaySE(SE_SELECT);
+                ClearBottomWindow();
+                SetPokeStorageTask(Task_FindStorageMon);
+            }
+            break;
         }
         break;
     case 3:
@@ -2710,9 +2730,36 @@ static void Task_OnSelectedMon(u8 taskId)
             SetPokeStorageTask(Task_PokeStorageMain);
         }
         break;
+    case 7:
+        PlaySE(SE_FAILURE);
+        PrintMessage(MSG_NO_OTHERS_FOUND);
+        sStorage->state = 6;
+        break;
     }
 }
 
+// Looks for the next box slot after the cursor with the same species as the
+// selected Pokémon, or holding the same item when moving items.
+static bool32 FindNextMatchingMon(void)
+{
+    u8 boxId = StorageGetCurrentBox();
+    u8 boxPosition = sCursorPosition;
+    bool32 found;
+
+    if (sStorage->boxOption == OPTION_MOVE_ITEMS)
+        found = FindStorageMonWithHeldItem(sStorage->displayMonItemId, &boxId, &boxPosition);
+    else
+        found = FindStorageMonWithSpecies(sStorage->displayMonSpecies, &boxId, &boxPosition);
+
+    // The search wraps around, so the selected Pokémon is found last.
+    if (!found || (boxId == StorageGetCurrentBox() && boxPosition == sCursorPosition))
+        return FALSE;
+
+    sStorage->newCurrBoxId = boxId;
+    sStorage->foundBoxPosition = boxPosition;
+    return TRUE;
+}
+
 static void Task_MoveMon(u8 taskId)
 {
     switch (sStorage->state)
@@ -3527,6 +3574,51 @@ static void Task_JumpBox(u8 taskId)
     }
 }
 
+static void Task_FindStorageMon(u8 taskId)
+{
+    switch (sStorage->state)
+    {
+    case 0:
+        if (sStorage->newCurrBoxId == StorageGetCurrentBox())
+        {
+            sStorage->state = 3;
+        }
+        else
+        {
+            if (sStorage->boxOption == OPTION_MOVE_ITEMS)
+                TryHideItemAtCursor();
+            sStorage->state++;
+        }
+        break;
+    case 1:
+        if (!IsItemIconAnimActive())
+        {
+            SetUpScrollToBox(sStorage->newCurrBoxId);
+            sStorage->state++;
+        }
+        break;
+    case 2:
+        if (!ScrollToBox())
+        {
+            SetCurrentBox(sStorage->newCurrBoxId);
+            sStorage->state++;
+        }
+        break;
+    case 3:
+        SetCursorPosition(CURSOR_AREA_IN_BOX, sStorage->foundBoxPosition);
+        sStorage->state++;
+        break;
+    case 4:
+        if (!UpdateCursorPos())
+        {
+            if (sStorage->setMosaic)
+                StartDisplayMonMosaicEffect();
+            SetPokeStorageTask(Task_PokeStorageMain);
+        }
+        break;
+    }
+}
+
 static void Task_NameBox(u8 taskId)
 {
     switch (sStorage->state)
@@ -3810,7 +3902,7 @@ static void SetScrollingBackground(void)
 {
     SetGpuReg(REG_OFFSET_BG3CNT, BGCNT_PRIORITY(3) | BGCNT_CHARBASE(3) | BGCNT_16COLOR | BGCNT_SCREENBASE(31));
     DecompressAndLoadBgGfxUsingHeap(3, sScrollingBg_Gfx, 0, 0, 0);
-    LZ77UnCompVram(sScrollingBg_Tilemap, (void *)BG_SCREEN_ADDR(31));
+    LZDecompressVram(sScrollingBg_Tilemap, (void *)BG_SCREEN_ADDR(31));
 }
 
 static void ScrollBackground(void)
@@ -3823,7 +3915,7 @@ static void LoadPokeStorageMenuGfx(void)
 {
     InitBgsFromTemplates(0, sBgTemplates, ARRAY_COUNT(sBgTemplates));
     DecompressAndLoadBgGfxUsingHeap(1, gStorageSystemMenu_Gfx, 0, 0, 0);
-    LZ77UnCompWram(sDisplayMenu_Tilemap, sStorage->displayMenuTilemapBuffer);
+    LZDecompressWram(sDisplayMenu_Tilemap, sStorage->displayMenuTilemapBuffer);
     SetBgTilemapBuffer(1, sStorage->displayMenuTilemapBuffer);
     ShowBg(1);
     ScheduleBgCopyTilemapToVram(1);
@@ -3977,7 +4069,7 @@ static void LoadDisplayMonGfx(u16 species, u32 pid)
     if (species != SPECIES_NONE)
     {
         LoadSpecialPokePic(sStorage->tileBuffer, species, pid, TRUE);
-        LZ77UnCompWram(sStorage->displayMonPalette, sStorage->displayMonPalBuffer);
+        LZDecompressWram(sStorage->displayMonPalette, sStorage->displayMonPalBuffer);
         CpuCopy32(sStorage->tileBuffer, sStorage->displayMonTilePtr, MON_PIC_SIZE);
         LoadPalette(sStorage->displayMonPalBuffer, sStorage->displayMonPalOffset, PLTT_SIZE_4BPP);
         sStorage->displayMonSprite->invisible = FALSE;
@@ -4044,7 +4136,7 @@ static void UpdateWaveformAnimation(void)
 
 static void InitSupplementalTilemaps(void)
 {
-    LZ77UnCompWram(gStorageSystemPartyMenu_Tilemap, sStorage->partyMenuTilemapBuffer);
+    LZDecompressWram(gStorageSystemPartyMenu_Tilemap, sStorage->partyMenuTilemapBuffer);
     LoadPalette(gStorageSystemPartyMenu_Pal, BG_PLTT_ID(1), PLTT_SIZE_4BPP);
     TilemapUtil_SetMap(TILEMAPID_PARTY_MENU, 1, sStorage->partyMenuTilemapBuffer, 12, 22);
     TilemapUtil_SetMap(TILEMAPID_CLOSE_BUTTON, 1, sCloseBoxButton_Tilemap, 9, 4);
@@ -4438,8 +4530,7 @@ static void InitBoxMonSprites(u8 boxId)
 {
     u8 boxPosition;
     u16 i, j, count;
-    u16 species;
-    u32 personality;
+    struct BoxMonSummary summary;
 
     count = 0;
     boxPosition = 0;
@@ -4449,11 +4540,10 @@ static void InitBoxMonSprites(u8 boxId)
     {
         for (j = 0; j < IN_BOX_COLUMNS; j++)
         {
-            species = GetBoxMonDataAt(boxId, boxPosition, MON_DATA_SPECIES_OR_EGG);
-            if (species != SPECIES_NONE)
+            summary = GetBoxMonSummaryAt(boxId, boxPosition);
+            if (summary.species != SPECIES_NONE)
             {
-                personality = GetBoxMonDataAt(boxId, boxPosition, MON_DATA_PERSONALITY);
-                sStorage->boxMonsSprites[count] = CreateMonIconSprite(species, personality, 8 * (3 * j) + 100, 8 * (3 * i) + 44, 2, 19 - j);
+                sStorage->boxMonsSprites[count] = CreateMonIconSprite(summary.species, summary.personality, 8 * (3 * j) + 100, 8 * (3 * i) + 44, 2, 19 - j);
             }
             else
             {
@@ -4469,7 +4559,7 @@ static void InitBoxMonSprites(u8 boxId)
     {
         for (boxPosition = 0; boxPosition < IN_BOX_COUNT; boxPosition++)
         {
-            if (GetBoxMonDataAt(boxId, boxPosition, MON_DATA_HELD_ITEM) == ITEM_NONE)
+            if (GetBoxMonSummaryAt(boxId, boxPosition).heldItem == ITEM_NONE)
                 sStorage->boxMonsSprites[boxPosition]->oam.objMode = ST_OAM_OBJ_BLEND;
         }
     }
@@ -4477,15 +4567,14 @@ static void InitBoxMonSprites(u8 boxId)
 
 static void CreateBoxMonIconAtPos(u8 boxPosition)
 {
-    u16 species = GetCurrentBoxMonData(boxPosition, MON_DATA_SPECIES_OR_EGG);
+    struct BoxMonSummary summary = GetBoxMonSummaryAt(StorageGetCurrentBox(), boxPosition);
 
-    if (species != SPECIES_NONE)
+    if (summary.species != SPECIES_NONE)
     {
         s16 x = 8 * (3 * (boxPosition % IN_BOX_COLUMNS)) + 100;
         s16 y = 8 * (3 * (boxPosition / IN_BOX_COLUMNS)) + 44;
-        u32 personality = GetCurrentBoxMonData(boxPosition, MON_DATA_PERSONALITY);
 
-        sStorage->boxMonsSprites[boxPosition] = CreateMonIconSprite(species, personality, x, y, 2, 19 - (boxPosition % IN_BOX_COLUMNS));
+        sStorage->boxMonsSprites[boxPosition] = CreateMonIconSprite(summary.species, summary.personality, x, y, 2, 19 - (boxPosition % IN_BOX_COLUMNS));
         if (sStorage->boxOption == OPTION_MOVE_ITEMS)
             sStorage->boxMonsSprites[boxPosition]->oam.objMode = ST_OAM_OBJ_BLEND;
     }
@@ -4615,7 +4704,7 @@ static u8 CreateBoxMonIconsInColumn(u8 column, u16 distance, s16 speed)
                     sStorage->boxMonsSprites[boxPosition]->sSpeed = speed;
                     sStorage->boxMonsSprites[boxPosition]->sScrollInDestX = xDest;
                     sStorage->boxMonsSprites[boxPosition]->callback = SpriteCB_BoxMonIconScrollIn;
-                    if (GetBoxMonDataAt(sStorage->incomingBoxId, boxPosition, MON_DATA_HELD_ITEM) == ITEM_NONE)
+                    if (GetBoxMonSummaryAt(sStorage->incomingBoxId, boxPosition).heldItem == ITEM_NONE)
                         sStorage->boxMonsSprites[boxPosition]->oam.objMode = ST_OAM_OBJ_BLEND;
                     iconsCreated++;
                 }
@@ -4710,9 +4799,10 @@ static void GetIncomingBoxMonData(u8 boxId)
     {
         for (j = 0; j < IN_BOX_COLUMNS; j++)
         {
-            sStorage->boxSpecies[boxPosition] = GetBoxMonDataAt(boxId, boxPosition, MON_DATA_SPECIES_OR_EGG);
+            struct BoxMonSummary summary = GetBoxMonSummaryAt(boxId, boxPosition);
+            sStorage->boxSpecies[boxPosition] = summary.species;
             if (sStorage->boxSpecies[boxPosition] != SPECIES_NONE)
-                sStorage->boxPersonalities[boxPosition] = GetBoxMonDataAt(boxId, boxPosition, MON_DATA_PERSONALITY);
+                sStorage->boxPersonalities[boxPosition] = summary.personality;
             boxPosition++;
         }
     }
@@ -5391,7 +5481,7 @@ static void LoadWallpaperGfx(u8 boxId, s8 direction)
     if (wallpaperId != WALLPAPER_FRIENDS)
     {
         wallpaper = &sWallpapers[wallpaperId];
-        LZ77UnCompWram(wallpaper->tilemap, sStorage->wallpaperTilemap);
+        LZDecompressWram(wallpaper->tilemap, sStorage->wallpaperTilemap);
         DrawWallpaper(sStorage->wallpaperTilemap, sStorage->wallpaperLoadDir, sStorage->wallpaperOffset);
 
         if (sStorage->wallpaperLoadDir != 0)
@@ -5405,7 +5495,7 @@ static void LoadWallpaperGfx(u8 boxId, s8 direction)
     else
     {
         wallpaper = &sWaldaWallpapers[GetWaldaWallpaperPatternId()];
-        LZ77UnCompWram(wallpaper->tilemap, sStorage->wallpaperTilemap);
+        LZDecompressWram(wallpaper->tilemap, sStorage->wallpaperTilemap);
         DrawWallpaper(sStorage->wallpaperTilemap, sStorage->wallpaperLoadDir, sStorage->wallpaperOffset);
 
         CpuCopy16(wallpaper->palettes, sStorage->wallpaperTilemap, 0x40);
@@ -6830,7 +6920,7 @@ static bool8 CanPlaceMon(void)
     {
         if (sCursorArea == CURSOR_AREA_IN_PARTY && GetMonData(&gPlayerParty[sCursorPosition], MON_DATA_SPECIES) == SPECIES_NONE)
             return TRUE;
-        else if (sCursorArea == CURSOR_AREA_IN_BOX && GetBoxMonDataAt(StorageGetCurrentBox(), sCursorPosition, MON_DATA_SPECIES_OR_EGG) == SPECIES_NONE)
+        else if (sCursorArea == CURSOR_AREA_IN_BOX && GetBoxMonSummaryAt(StorageGetCurrentBox(), sCursorPosition).species == SPECIES_NONE)
             return TRUE;
         else
             return FALSE;
@@ -7736,6 +7826,8 @@ static bool8 SetMenuTexts_Mon(void)
 
     SetMenuText(MENU_MARK);
     SetMenuText(MENU_RELEASE);
+    if (sCursorArea == CURSOR_AREA_IN_BOX && !sIsMonBeingMoved && species != SPECIES_EGG)
+        SetMenuText(MENU_FIND);
     SetMenuText(MENU_CANCEL);
     return TRUE;
 }
@@ -7762,6 +7854,8 @@ static bool8 SetMenuTexts_Item(void)
                 SetMenuText(MENU_BAG);
             }
             SetMenuText(MENU_INFO);
+            if (sCursorArea == CURSOR_AREA_IN_BOX)
+                SetMenuText(MENU_FIND);
         }
     }
     else
@@ -8041,6 +8135,7 @@ static const u8 *const sMenuTexts[] =
     [MENU_POKECENTER] = COMPOUND_STRING("POKéCENTER"),
     [MENU_MACHINE]    = COMPOUND_STRING("MACHINE"),
     [MENU_SIMPLE]     = COMPOUND_STRING("SIMPLE"),
+    [MENU_FIND]       = COMPOUND_STRING("FIND"),
 };
 
 static void SetMenuText(u8 textId)
@@ -9184,12 +9279,12 @@ static void LoadItemIconGfx(u8 id, const u32 *itemTiles, const u32 *itemPal)
         return;
 
     CpuFastFill(0, sStorage->itemIconBuffer, 0x200);
-    LZ77UnCompWram(itemTiles, sStorage->tileBuffer);
+    LZDecompressWram(itemTiles, sStorage->tileBuffer);
     for (i = 0; i < 3; i++)
         CpuFastCopy(&sStorage->tileBuffer[i * 0x60], &sStorage->itemIconBuffer[i * 0x80], 0x60);
 
     CpuFastCopy(sStorage->itemIconBuffer, sStorage->itemIcons[id].tiles, 0x200);
-    LZ77UnCompWram(itemPal, sStorage->itemIconBuffer);
+    LZDecompressWram(itemPal, sStorage->itemIconBuffer);
     LoadPalette(sStorage->itemIconBuffer, sStorage->itemIcons[id].palIndex, PLTT_SIZE_4BPP);
 }
 
@@ -9493,6 +9588,125 @@ static void SetCurrentBox(u8 boxId)
         gPokemonStoragePtr->currentBox = boxId;
 }
 
+// Decrypting a BoxPokemon is slow, so the fields which the PC shows for
+// every slot and which are encrypted are kept here. An entry is only used
+// while its slot's checksum, the low half of its personality and its bad
+// egg flag are unchanged, so it also stays correct after writes which
+// bypass the functions below (e.g. through GetBoxedMonPtr) or loading a
+// save.
+struct BoxMonSummaryCache
+{
+    u16 checksum;
+    u16 personality;
+    u32 species:11; // SPECIES_EGG for eggs.
+    u32 heldItem:10;
+    u32 level:7;
+    u32 isBadEgg:1;
+    u32 isValid:1;
+    u32 padding:2;
+};
+
+STATIC_ASSERT(NUM_SPECIES < (1 << 11), BoxMonSummaryCache_species_TooSmall);
+STATIC_ASSERT(ITEMS_COUNT < (1 << 10), BoxMonSummaryCache_heldItem_TooSmall);
+STATIC_ASSERT(MAX_LEVEL < (1 << 7), BoxMonSummaryCache_level_TooSmall);
+
+EWRAM_DATA static struct BoxMonSummaryCache sBoxMonSummaries[TOTAL_BOXES_COUNT][IN_BOX_COUNT] = {0};
+
+static void InvalidateBoxMonSummary(u8 boxId, u8 boxPosition)
+{
+    sBoxMonSummaries[boxId][boxPosition].isValid = FALSE;
+}
+
+void ResetBoxMonSummaries(void)
+{
+    memset(sBoxMonSummaries, 0, sizeof(sBoxMonSummaries));
+}
+
+struct BoxMonSummary GetBoxMonSummaryAt(u8 boxId, u8 boxPosition)
+{
+    struct BoxMonSummary summary = {0};
+    struct BoxPokemon *boxMon;
+    struct BoxMonSummaryCache *cache;
+
+    if (boxId >= TOTAL_BOXES_COUNT || boxPosition >= IN_BOX_COUNT)
+        return summary;
+
+    boxMon = &gPokemonStoragePtr->boxes[boxId][boxPosition];
+    cache = &sBoxMonSummaries[boxId][boxPosition];
+    if (!cache->isValid
+     || cache->checksum != boxMon->checksum
+     || cache->personality != (u16)boxMon->personality
+     || cache->isBadEgg != boxMon->isBadEgg)
+    {
+        cache->species = GetBoxMonData(boxMon, MON_DATA_SPECIES_OR_EGG);
+        if (cache->species != SPECIES_NONE)
+        {
+            cache->heldItem = GetBoxMonData(boxMon, MON_DATA_HELD_ITEM);
+            cache->level = GetLevelFromBoxMonExp(boxMon);
+        }
+        else
+        {
+            cache->heldItem = ITEM_NONE;
+            cache->level = 0;
+        }
+        // Read after decrypting, which may have found a bad egg.
+        cache->checksum = boxMon->checksum;
+        cache->personality = boxMon->personality;
+        cache->isBadEgg = boxMon->isBadEgg;
+        cache->isValid = TRUE;
+    }
+
+    summary.species = cache->species;
+    if (summary.species != SPECIES_NONE)
+    {
+        summary.heldItem = cache->heldItem;
+        summary.level = cache->level;
+        // The rest isn't encrypted, or only depends on the species.
+        summary.personality = boxMon->personality;
+        summary.form = GetFormIdFromFormSpeciesId(summary.species);
+        summary.markings = boxMon->markings;
+        summary.isShiny = GetBoxMonData(boxMon, MON_DATA_IS_SHINY);
+    }
+    return summary;
+}
+
+// Searches every box slot after the one at *boxId and *boxPosition,
+// wrapping around from the last box to the first, so that calling it
+// again with the result finds the next match.
+static bool32 FindStorageMon(bool32 byHeldItem, u16 value, u8 *boxId, u8 *boxPosition)
+{
+    u32 i, slot = *boxId * IN_BOX_COUNT + *boxPosition;
+
+    for (i = 0; i < TOTAL_BOXES_COUNT * IN_BOX_COUNT; i++)
+    {
+        struct BoxMonSummary summary;
+
+        if (++slot >= TOTAL_BOXES_COUNT * IN_BOX_COUNT)
+            slot = 0;
+        summary = GetBoxMonSummaryAt(slot / IN_BOX_COUNT, slot % IN_BOX_COUNT);
+        if (summary.species == SPECIES_NONE || summary.species == SPECIES_EGG)
+            continue;
+        if ((byHeldItem ? summary.heldItem : summary.species) == value)
+        {
+            *boxId = slot / IN_BOX_COUNT;
+            *boxPosition = slot % IN_BOX_COUNT;
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+}
+
+bool32 FindStorageMonWithSpecies(u16 species, u8 *boxId, u8 *boxPosition)
+{
+    return FindStorageMon(FALSE, species, boxId, boxPosition);
+}
+
+bool32 FindStorageMonWithHeldItem(u16 itemId, u8 *boxId, u8 *boxPosition)
+{
+    return FindStorageMon(TRUE, itemId, boxId, boxPosition);
+}
+
 u32 GetBoxMonDataAt(u8 boxId, u8 boxPosition, s32 request)
 {
     if (boxId < TOTAL_BOXES_COUNT && boxPosition < IN_BOX_COUNT)
@@ -9504,7 +9718,10 @@ u32 GetBoxMonDataAt(u8 boxId, u8 boxPosition, s32 request)
 void SetBoxMonDataAt(u8 boxId, u8 boxPosition, s32 request, const void *value)
 {
     if (boxId < TOTAL_BOXES_COUNT && boxPosition < IN_BOX_COUNT)
+    {
         SetBoxMonData(&gPokemonStoragePtr->boxes[boxId][boxPosition], request, value);
+        InvalidateBoxMonSummary(boxId, boxPosition);
+    }
 }
 
 u32 GetCurrentBoxMonData(u8 boxPosition, s32 request)
@@ -9556,7 +9773,10 @@ u32 GetAndCopyBoxMonDataAt(u8 boxId, u8 boxPosition, s32 request, void *dst)
 void SetBoxMonAt(u8 boxId, u8 boxPosition, struct BoxPokemon *src)
 {
     if (boxId < TOTAL_BOXES_COUNT && boxPosition < IN_BOX_COUNT)
+    {
         gPokemonStoragePtr->boxes[boxId][boxPosition] = *src;
+        InvalidateBoxMonSummary(boxId, boxPosition);
+    }
 }
 
 void CopyBoxMonAt(u8 boxId, u8 boxPosition, struct BoxPokemon *dst)
@@ -9575,13 +9795,17 @@ void CreateBoxMonAt(u8 boxId, u8 boxPosition, u16 species, u8 level, u8 fixedIV,
                      fixedIV,
                      hasFixedPersonality, personality,
                      otIDType, otID);
+        InvalidateBoxMonSummary(boxId, boxPosition);
     }
 }
 
 void ZeroBoxMonAt(u8 boxId, u8 boxPosition)
 {
     if (boxId < TOTAL_BOXES_COUNT && boxPosition < IN_BOX_COUNT)
+    {
         ZeroBoxMonData(&gPokemonStoragePtr->boxes[boxId][boxPosition]);
+        InvalidateBoxMonSummary(boxId, boxPosition);
+    }
 }
 
 void BoxMonAtToMon(u8 boxId, u8 boxPosition, struct Pokemon *dst)
@@ -3,6 +3,7 @@
 #include "event_data.h"
 #include "mystery_gift.h"
 #include "random.h"
+#include "test_runner.h"
 #include "trainer_see.h"
 #include "util.h"
 #include "constants/event_objects.h"
@@ -124,6 +125,8 @@ bool8 RunScriptCommand(struct ScriptContext *ctx)
                 return FALSE;
             }
 
+            TestRunner_RecordScriptCommand(ctx->cmdTable, ctx->scriptPtr - 1);
+
             if ((*func)(ctx) == TRUE)
                 return TRUE;
         }
@@ -14,17 +14,26 @@
     (sSpriteTileRanges + 1)[index * 2] = count;    \
 }
 
-#define ALLOC_SPRITE_TILE(n)                             \
-{                                                        \
-    sSpriteTileAllocBitmap[(n) / 8] |= (1 << ((n) % 8)); \
-}
+// Tile n is the (n % 32)th most significant bit of word n / 32, so that
+// counting leading zeros finds the lowest free or allocated tile.
+#define SPRITE_TILE_BIT(n) (0x80000000 >> ((n) % 32))
 
-#define FREE_SPRITE_TILE(n)                               \
-{                                                         \
-    sSpriteTileAllocBitmap[(n) / 8] &= ~(1 << ((n) % 8)); \
-}
+#define SPRITE_TILE_IS_ALLOCATED(n) ((sSpriteTileAllocBitmap[(n) / 32] & SPRITE_TILE_BIT(n)) != 0)
+
+// The reference count of palettes and sheets loaded by LoadSpritePalette,
+// AllocSpritePalette or LoadSpriteSheet, which Release* never frees.
+#define SPRITE_REF_PINNED 0xFF
 
-#define SPRITE_TILE_IS_ALLOCATED(n) ((sSpriteTileAllocBitmap[(n) / 8] >> ((n) % 8)) & 1)
+// The number of tags which can share a palette slot with another tag.
+#define MAX_SPRITE_PALETTE_ALIASES 16
+
+// An alias is in use while its refCount is nonzero.
+struct SpritePaletteAlias
+{
+    u16 tag;
+    u8 paletteNum;
+    u8 refCount;
+};
 
 
 struct SpriteCopyRequest
@@ -84,6 +93,9 @@ static void GetAffineAnimFrame(u8 matrixNum, struct Sprite *sprite, struct Affin
 static void ApplyAffineAnimFrame(u8 matrixNum, struct AffineAnimFrameCmd *frameCmd);
 static u8 IndexOfSpriteTileTag(u16 tag);
 static void AllocSpriteTileRange(u16 tag, u16 start, u16 count);
+static void SetSpriteTilesAllocated(u32 start, u32 count, bool32 allocated);
+static u32 FindSpriteTile(u32 tile, bool32 allocated);
+static s32 FindFreeSpriteTiles(u32 tileCount, bool32 bestFit);
 static void DoLoadSpritePalette(const u16 *src, u16 paletteOffset);
 static void UpdateSpriteMatrixAnchorPos(struct Sprite *, s32, s32);
 
@@ -267,7 +279,12 @@ EWRAM_DATA static struct SpriteCopyRequest sSpriteCopyRequests[MAX_SPRITES] = {0
 EWRAM_DATA u8 gOamLimit = 0;
 static EWRAM_DATA u8 sOamDummyIndex = 0;
 EWRAM_DATA u16 gReservedSpriteTileCount = 0;
-EWRAM_DATA static u8 sSpriteTileAllocBitmap[128] = {0};
+EWRAM_DATA static u32 sSpriteTileAllocBitmap[TOTAL_OBJ_TILE_COUNT / 32] = {0};
+EWRAM_DATA static u8 sSpriteTileRangeRefCounts[MAX_SPRITES] = {0};
+EWRAM_DATA static u8 sSpritePaletteRefCounts[16] = {0};
+EWRAM_DATA static u16 sSharedSpritePalettes = 0;
+EWRAM_DATA static u32 sSpritePaletteHashes[16] = {0};
+EWRAM_DATA static struct SpritePaletteAlias sSpritePaletteAliases[MAX_SPRITE_PALETTE_ALIASES] = {0};
 EWRAM_DATA s16 gSpriteCoordOffsetX = 0;
 EWRAM_DATA s16 gSpriteCoordOffsetY = 0;
 EWRAM_DATA struct OamMatrix gOamMatrices[OAM_MATRIX_COUNT] = {0};
@@ -552,12 +569,7 @@ void DestroySprite(struct Sprite *sprite)
     if (sprite->inUse)
     {
         if (!sprite->usingSheet)
-        {
-            u16 i;
-            u16 tileEnd = (sprite->images->size / TILE_SIZE_4BPP) + sprite->oam.tileNum;
-            for (i = sprite->oam.tileNum; i < tileEnd; i++)
-                FREE_SPRITE_TILE(i);
-        }
+            SetSpriteTilesAllocated(sprite->oam.tileNum, sprite->images->size / TILE_SIZE_4BPP, FALSE);
         ResetSprite(sprite);
     }
 }
@@ -631,81 +643,157 @@ void CalcCenterToCornerVec(struct Sprite *sprite, u8 shape, u8 size, u8 affineMo
     sprite->centerToCornerVecY = y;
 }
 
-s16 AllocSpriteTiles(u16 tileCount)
+static void SetSpriteTilesAllocated(u32 start, u32 count, bool32 allocated)
 {
-    u16 i;
-    s16 start;
-    u16 numTilesFound;
+    u32 end = start + count;
 
-    if (tileCount == 0)
+    while (start < end)
     {
-        // Free all unreserved tiles if the tile count is 0.
-        for (i = gReservedSpriteTileCount; i < TOTAL_OBJ_TILE_COUNT; i++)
-            FREE_SPRITE_TILE(i);
+        u32 word = start / 32;
+        u32 bits = min(end - start, 32 - start % 32);
+        u32 mask = (0xFFFFFFFF << (32 - bits)) >> (start % 32);
 
-        return 0;
+        if (allocated)
+            sSpriteTileAllocBitmap[word] |= mask;
+        else
+            sSpriteTileAllocBitmap[word] &= ~mask;
+        start += bits;
     }
+}
+
+// Returns the first tile from `tile` onwards which is (or isn't)
+// allocated, or TOTAL_OBJ_TILE_COUNT if there is none.
+static u32 FindSpriteTile(u32 tile, bool32 allocated)
+{
+    u32 word = tile / 32;
+    u32 bits;
 
-    i = gReservedSpriteTileCount;
+    if (tile >= TOTAL_OBJ_TILE_COUNT)
+        return TOTAL_OBJ_TILE_COUNT;
 
-    for (;;)
+    bits = allocated ? sSpriteTileAllocBitmap[word] : ~sSpriteTileAllocBitmap[word];
+    bits &= 0xFFFFFFFF >> (tile % 32);
+    while (bits == 0)
     {
-        while (SPRITE_TILE_IS_ALLOCATED(i))
-        {
-            i++;
+        if (++word == ARRAY_COUNT(sSpriteTileAllocBitmap))
+            return TOTAL_OBJ_TILE_COUNT;
+        bits = allocated ? sSpriteTileAllocBitmap[word] : ~sSpriteTileAllocBitmap[word];
+    }
+    return word * 32 + __builtin_clz(bits);
+}
 
-            if (i == TOTAL_OBJ_TILE_COUNT)
-                return -1;
-        }
+// Walks the free spans above the reserved tiles and returns the start of
+// the first one (or the smallest one, if `bestFit`) which fits `tileCount`
+// tiles, or -1 if there is none.
+static s32 FindFreeSpriteTiles(u32 tileCount, bool32 bestFit)
+{
+    s32 bestStart = -1;
+    u32 bestSize = TOTAL_OBJ_TILE_COUNT + 1;
+    u32 start = FindSpriteTile(gReservedSpriteTileCount, FALSE);
 
-        start = i;
-        numTilesFound = 1;
+    while (start < TOTAL_OBJ_TILE_COUNT)
+    {
+        u32 end = FindSpriteTile(start, TRUE);
+        u32 size = end - start;
 
-        while (numTilesFound != tileCount)
+        if (size >= tileCount && size < bestSize)
         {
-            i++;
-
-            if (i == TOTAL_OBJ_TILE_COUNT)
-                return -1;
-
-            if (!SPRITE_TILE_IS_ALLOCATED(i))
-                numTilesFound++;
-            else
+            bestStart = start;
+            bestSize = size;
+            if (!bestFit || size == tileCount)
                 break;
         }
-
-        if (numTilesFound == tileCount)
-            break;
+        start = FindSpriteTile(end, FALSE);
     }
 
-    for (i = start; i < tileCount + start; i++)
-        ALLOC_SPRITE_TILE(i);
+    return bestStart;
+}
+
+// Places the tiles in the smallest free span that fits them, so that
+// large spans stay available for large sheets.
+s16 AllocSpriteTiles(u16 tileCount)
+{
+    s32 start;
+
+    if (tileCount == 0)
+    {
+        // Free all unreserved tiles if the tile count is 0.
+        SetSpriteTilesAllocated(gReservedSpriteTileCount, TOTAL_OBJ_TILE_COUNT - gReservedSpriteTileCount, FALSE);
+        return 0;
+    }
 
+    start = FindFreeSpriteTiles(tileCount, TRUE);
+    if (start >= 0)
+        SetSpriteTilesAllocated(start, tileCount, TRUE);
     return start;
 }
 
-u8 SpriteTileAllocBitmapOp(u16 bit, u8 op)
+// Moves every tagged sprite sheet to the lowest free tiles below it, so
+// that the free tiles form one span at the end of OBJ VRAM. Sprites using
+// a moved sheet have their tile numbers updated, but sprites with tiles
+// from AllocSpriteTiles, and any tile numbers cached elsewhere, are not;
+// their tiles stay where they are. The sheets are copied immediately, so
+// this should be called while the moved sprites are hidden or during VBlank.
+void CompactSpriteTiles(void)
 {
-    u8 index = bit / 8;
-    u8 shift = bit % 8;
-    u8 val = bit % 8;
-    u8 retVal = 0;
+    u32 i, j;
+    u32 count = 0;
+    u8 order[MAX_SPRITES];
 
-    if (op == 0)
+    // Sort the tagged sheets by tile start.
+    for (i = 0; i < MAX_SPRITES; i++)
     {
-        val = ~(1 << val);
-        sSpriteTileAllocBitmap[index] &= val;
+        if (sSpriteTileRangeTags[i] == TAG_NONE || sSpriteTileRanges[i * 2 + 1] == 0)
+            continue;
+        for (j = count; j > 0 && sSpriteTileRanges[order[j - 1] * 2] > sSpriteTileRanges[i * 2]; j--)
+            order[j] = order[j - 1];
+        order[j] = i;
+        count++;
     }
-    else if (op == 1)
+
+    for (i = 0; i < count; i++)
     {
-        val = (1 << val);
-        sSpriteTileAllocBitmap[index] |= val;
+        u32 index = order[i];
+        u32 tag = sSpriteTileRangeTags[index];
+        u32 start = sSpriteTileRanges[index * 2];
+        u32 tileCount = sSpriteTileRanges[index * 2 + 1];
+        s32 newStart;
+
+        SetSpriteTilesAllocated(start, tileCount, FALSE);
+        newStart = FindFreeSpriteTiles(tileCount, FALSE);
+        if (newStart < 0 || newStart >= start)
+        {
+            SetSpriteTilesAllocated(start, tileCount, TRUE);
+            continue;
+        }
+
+        // The copy goes forwards, so overlapping ranges are safe.
+        CpuCopy32((u8 *)OBJ_VRAM0 + start * TILE_SIZE_4BPP, (u8 *)OBJ_VRAM0 + newStart * TILE_SIZE_4BPP, tileCount * TILE_SIZE_4BPP);
+        SetSpriteTilesAllocated(newStart, tileCount, TRUE);
+        sSpriteTileRanges[index * 2] = newStart;
+
+        for (j = 0; j < MAX_SPRITES; j++)
+        {
+            struct Sprite *sprite = &gSprites[j];
+            if (sprite->inUse && sprite->usingSheet && sprite->sheetTileStart == start && sprite->template->tileTag == tag)
+            {
+                sprite->sheetTileStart = newStart;
+                sprite->oam.tileNum = sprite->oam.tileNum - start + newStart;
+            }
+        }
     }
+}
+
+u8 SpriteTileAllocBitmapOp(u16 bit, u8 op)
+{
+    u32 retVal = 0;
+
+    if (op == 0)
+        SetSpriteTilesAllocated(bit, 1, FALSE);
+    else if (op == 1)
+        SetSpriteTilesAllocated(bit, 1, TRUE);
     else
-    {
-        retVal = 1 << shift;
-        retVal &= sSpriteTileAllocBitmap[index];
-    }
+        retVal = SPRITE_TILE_IS_ALLOCATED(bit);
 
     return retVal;
 }
@@ -1447,6 +1535,12 @@ static u16 LoadSpriteSheetWithOffset(const struct SpriteSheet *sheet, u32 offset
 {
     s16 tileStart = AllocSpriteTiles(sheet->size / TILE_SIZE_4BPP);
 
+    if (tileStart < 0 && SPRITE_TILE_COMPACTION)
+    {
+        CompactSpriteTiles();
+        tileStart = AllocSpriteTiles(sheet->size / TILE_SIZE_4BPP);
+    }
+
     if (tileStart < 0)
     {
         return 0;
@@ -1492,20 +1586,9 @@ void FreeSpriteTilesByTag(u16 tag)
     u8 index = IndexOfSpriteTileTag(tag);
     if (index != 0xFF)
     {
-        u16 i;
-        u16 *rangeStarts;
-        u16 *rangeCounts;
-        u16 start;
-        u16 count;
-        rangeStarts = sSpriteTileRanges;
-        start = rangeStarts[index * 2];
-        rangeCounts = sSpriteTileRanges + 1;
-        count = rangeCounts[index * 2];
-
-        for (i = start; i < start + count; i++)
-            FREE_SPRITE_TILE(i);
-
+        SetSpriteTilesAllocated(sSpriteTileRanges[index * 2], sSpriteTileRanges[index * 2 + 1], FALSE);
         sSpriteTileRangeTags[index] = TAG_NONE;
+        sSpriteTileRangeRefCounts[index] = 0;
     }
 }
 
@@ -1516,6 +1599,7 @@ void FreeSpriteTileRanges(void)
     for (i = 0; i < MAX_SPRITES; i++)
     {
         sSpriteTileRangeTags[i] = TAG_NONE;
+        sSpriteTileRangeRefCounts[i] = 0;
         SET_SPRITE_TILE_RANGE(i, 0, 0);
     }
 }
@@ -1556,15 +1640,56 @@ void AllocSpriteTileRange(u16 tag, u16 start, u16 count)
 {
     u8 freeIndex = IndexOfSpriteTileTag(TAG_NONE);
     sSpriteTileRangeTags[freeIndex] = tag;
+    sSpriteTileRangeRefCounts[freeIndex] = SPRITE_REF_PINNED;
     SET_SPRITE_TILE_RANGE(freeIndex, start, count);
 }
 
+// Like LoadSpriteSheet, but if a sheet with the same tag is already
+// loaded its tiles are shared, and they are only freed once every
+// AcquireSpriteSheet has been matched by a ReleaseSpriteSheet.
+// Returns the tile start, or TAG_NONE if there wasn't enough space.
+u16 AcquireSpriteSheet(const struct SpriteSheet *sheet)
+{
+    u32 index = IndexOfSpriteTileTag(sheet->tag);
+
+    if (index == 0xFF)
+    {
+        LoadSpriteSheet(sheet);
+        index = IndexOfSpriteTileTag(sheet->tag);
+        if (index == 0xFF)
+            return TAG_NONE;
+        sSpriteTileRangeRefCounts[index] = 0;
+    }
+
+    if (sSpriteTileRangeRefCounts[index] == SPRITE_REF_PINNED - 1)
+        return TAG_NONE;
+    if (sSpriteTileRangeRefCounts[index] != SPRITE_REF_PINNED)
+        sSpriteTileRangeRefCounts[index]++;
+    return sSpriteTileRanges[index * 2];
+}
+
+void ReleaseSpriteSheet(u16 tag)
+{
+    u32 index = IndexOfSpriteTileTag(tag);
+
+    if (index != 0xFF
+     && sSpriteTileRangeRefCounts[index] != SPRITE_REF_PINNED
+     && --sSpriteTileRangeRefCounts[index] == 0)
+        FreeSpriteTilesByTag(tag);
+}
+
 void FreeAllSpritePalettes(void)
 {
     u32 i;
     gReservedSpritePaletteCount = 0;
     for (i = 0; i < 16; i++)
+    {
         sSpritePaletteTags[i] = TAG_NONE;
+        sSpritePaletteRefCounts[i] = 0;
+    }
+    sSharedSpritePalettes = 0;
+    for (i = 0; i < MAX_SPRITE_PALETTE_ALIASES; i++)
+        sSpritePaletteAliases[i].refCount = 0;
 }
 
 u32 LoadSpritePalette(const struct SpritePalette *palette)
@@ -1572,7 +1697,10 @@ u32 LoadSpritePalette(const struct SpritePalette *palette)
     u32 index = IndexOfSpritePaletteTag(palette->tag);
 
     if (index != 0xFF)
+    {
+        sSpritePaletteRefCounts[index] = SPRITE_REF_PINNED;
         return index;
+    }
 
     index = IndexOfSpritePaletteTag(TAG_NONE);
 
@@ -1583,6 +1711,8 @@ u32 LoadSpritePalette(const struct SpritePalette *palette)
     else
     {
         sSpritePaletteTags[index] = palette->tag;
+        sSpritePaletteRefCounts[index] = SPRITE_REF_PINNED;
+        sSharedSpritePalettes &= ~(1 << index);
         DoLoadSpritePalette(palette->data, PLTT_ID(index));
         return index;
     }
@@ -1611,6 +1741,8 @@ u32 AllocSpritePalette(u16 tag)
     else
     {
         sSpritePaletteTags[index] = tag;
+        sSpritePaletteRefCounts[index] = SPRITE_REF_PINNED;
+        sSharedSpritePalettes &= ~(1 << index);
         return index;
     }
 }
@@ -1622,6 +1754,13 @@ u32 IndexOfSpritePaletteTag(u16 tag)
         if (sSpritePaletteTags[i] == tag)
             return i;
 
+    if (tag != TAG_NONE && sSharedSpritePalettes != 0)
+    {
+        for (i = 0; i < MAX_SPRITE_PALETTE_ALIASES; i++)
+            if (sSpritePaletteAliases[i].refCount != 0 && sSpritePaletteAliases[i].tag == tag)
+                return sSpritePaletteAliases[i].paletteNum;
+    }
+
     return 0xFF;
 }
 
@@ -1630,11 +1769,172 @@ u16 GetSpritePaletteTagByPaletteNum(u8 paletteNum)
     return sSpritePaletteTags[paletteNum];
 }
 
+static void FreeSpritePaletteNum(u32 paletteNum)
+{
+    u32 i;
+
+    sSpritePaletteTags[paletteNum] = TAG_NONE;
+    sSpritePaletteRefCounts[paletteNum] = 0;
+    if (sSharedSpritePalettes & (1 << paletteNum))
+    {
+        sSharedSpritePalettes &= ~(1 << paletteNum);
+        for (i = 0; i < MAX_SPRITE_PALETTE_ALIASES; i++)
+            if (sSpritePaletteAliases[i].paletteNum == paletteNum)
+                sSpritePaletteAliases[i].refCount = 0;
+    }
+}
+
+static struct SpritePaletteAlias *GetSpritePaletteAlias(u16 tag)
+{
+    u32 i;
+
+    if (sSharedSpritePalettes != 0)
+    {
+        for (i = 0; i < MAX_SPRITE_PALETTE_ALIASES; i++)
+            if (sSpritePaletteAliases[i].refCount != 0 && sSpritePaletteAliases[i].tag == tag)
+                return &sSpritePaletteAliases[i];
+    }
+    return NULL;
+}
+
+static struct SpritePaletteAlias *GetFreeSpritePaletteAlias(void)
+{
+    u32 i;
+
+    for (i = 0; i < MAX_SPRITE_PALETTE_ALIASES; i++)
+        if (sSpritePaletteAliases[i].refCount == 0)
+            return &sSpritePaletteAliases[i];
+    return NULL;
+}
+
+// Returns FALSE if the palette slot can't count any more references.
+static bool32 AddSpritePaletteRef(u32 paletteNum)
+{
+    if (sSpritePaletteRefCounts[paletteNum] == SPRITE_REF_PINNED)
+        return TRUE;
+    if (sSpritePaletteRefCounts[paletteNum] == SPRITE_REF_PINNED - 1)
+        return FALSE;
+    sSpritePaletteRefCounts[paletteNum]++;
+    return TRUE;
+}
+
+// Drops `count` references from palette slot `paletteNum`, and frees it
+// if that was the last of them.
+static void ReleaseSpritePaletteNum(u32 paletteNum, u32 count)
+{
+    if (sSpritePaletteRefCounts[paletteNum] == SPRITE_REF_PINNED)
+        return;
+
+    if (sSpritePaletteRefCounts[paletteNum] <= count)
+        FreeSpritePaletteNum(paletteNum);
+    else
+        sSpritePaletteRefCounts[paletteNum] -= count;
+}
+
+// Frees the palette regardless of how many references it has. For a tag
+// which shares another tag's palette, only that tag's references are dropped.
 void FreeSpritePaletteByTag(u16 tag)
 {
-    u8 index = IndexOfSpritePaletteTag(tag);
+    struct SpritePaletteAlias *alias = GetSpritePaletteAlias(tag);
+
+    if (alias != NULL)
+    {
+        u32 refCount = alias->refCount;
+        alias->refCount = 0;
+        ReleaseSpritePaletteNum(alias->paletteNum, refCount);
+    }
+    else
+    {
+        u8 index = IndexOfSpritePaletteTag(tag);
+        if (index != 0xFF)
+            FreeSpritePaletteNum(index);
+    }
+}
+
+static u32 HashSpritePalette(const u16 *data)
+{
+    u32 i;
+    u32 hash = 2166136261; // FNV-1a
+
+    for (i = 0; i < PLTT_SIZE_4BPP / sizeof(u16); i++)
+        hash = (hash ^ data[i]) * 16777619;
+    return hash;
+}
+
+// Finds a palette slot holding the same colors which was also loaded as shared.
+static u32 FindSharedSpritePalette(const u16 *data, u32 hash)
+{
+    u32 i;
+
+    for (i = gReservedSpritePaletteCount; i < 16; i++)
+    {
+        if ((sSharedSpritePalettes & (1 << i))
+         && sSpritePaletteHashes[i] == hash
+         && memcmp(&gPlttBufferUnfaded[OBJ_PLTT_ID(i)], data, PLTT_SIZE_4BPP) == 0)
+            return i;
+    }
+    return 0xFF;
+}
+
+// Like LoadSpritePalette, but the palette is only freed once every
+// AcquireSpritePalette of its tag has been matched by a ReleaseSpritePalette.
+// If `shared`, a tag whose colors match another shared palette uses that
+// palette's slot instead of its own, so shared palettes must not be
+// modified in place.
+u32 AcquireSpritePalette(const struct SpritePalette *palette, bool32 shared)
+{
+    u32 index, hash;
+    struct SpritePaletteAlias *alias = GetSpritePaletteAlias(palette->tag);
+
+    if (alias != NULL)
+    {
+        if (alias->refCount == SPRITE_REF_PINNED - 1 || !AddSpritePaletteRef(alias->paletteNum))
+            return 0xFF;
+        alias->refCount++;
+        return alias->paletteNum;
+    }
+
+    index = IndexOfSpritePaletteTag(palette->tag);
+    if (index != 0xFF)
+        return AddSpritePaletteRef(index) ? index : 0xFF;
+
+    hash = HashSpritePalette(palette->data);
+    if (shared && (index = FindSharedSpritePalette(palette->data, hash)) != 0xFF
+     && (alias = GetFreeSpritePaletteAlias()) != NULL
+     && AddSpritePaletteRef(index))
+    {
+        alias->tag = palette->tag;
+        alias->paletteNum = index;
+        alias->refCount = 1;
+        return index;
+    }
+
+    index = LoadSpritePalette(palette);
     if (index != 0xFF)
-        sSpritePaletteTags[index] = TAG_NONE;
+    {
+        sSpritePaletteRefCounts[index] = 1;
+        sSpritePaletteHashes[index] = hash;
+        if (shared)
+            sSharedSpritePalettes |= 1 << index;
+    }
+    return index;
+}
+
+void ReleaseSpritePalette(u16 tag)
+{
+    struct SpritePaletteAlias *alias = GetSpritePaletteAlias(tag);
+
+    if (alias != NULL)
+    {
+        alias->refCount--;
+        ReleaseSpritePaletteNum(alias->paletteNum, 1);
+    }
+    else
+    {
+        u32 index = IndexOfSpritePaletteTag(tag);
+        if (index != 0xFF)
+            ReleaseSpritePaletteNum(index, 1);
+    }
 }
 
 void SetSubspriteTables(struct Sprite *sprite, const struct SubspriteTable *subspriteTables)
@@ -2,7 +2,6 @@
 #include "string_util.h"
 #include "text.h"
 #include "strings.h"
-#include "union_room_chat.h"
 
 EWRAM_DATA u8 gStringVar1[0x100] = {0};
 EWRAM_DATA u8 gStringVar2[0x100] = {0};
@@ -12,6 +11,153 @@ EWRAM_DATA static u8 sUnknownStringVar[16] = {0};
 
 static const u8 sDigits[] = __("0123456789ABCDEF");
 
+const u8 gCaseToggleTable[256] = {
+    [CHAR_A] = CHAR_a,
+    [CHAR_B] = CHAR_b,
+    [CHAR_C] = CHAR_c,
+    [CHAR_D] = CHAR_d,
+    [CHAR_E] = CHAR_e,
+    [CHAR_F] = CHAR_f,
+    [CHAR_G] = CHAR_g,
+    [CHAR_H] = CHAR_h,
+    [CHAR_I] = CHAR_i,
+    [CHAR_J] = CHAR_j,
+    [CHAR_K] = CHAR_k,
+    [CHAR_L] = CHAR_l,
+    [CHAR_M] = CHAR_m,
+    [CHAR_N] = CHAR_n,
+    [CHAR_O] = CHAR_o,
+    [CHAR_P] = CHAR_p,
+    [CHAR_Q] = CHAR_q,
+    [CHAR_R] = CHAR_r,
+    [CHAR_S] = CHAR_s,
+    [CHAR_T] = CHAR_t,
+    [CHAR_U] = CHAR_u,
+    [CHAR_V] = CHAR_v,
+    [CHAR_W] = CHAR_w,
+    [CHAR_X] = CHAR_x,
+    [CHAR_Y] = CHAR_y,
+    [CHAR_Z] = CHAR_z,
+    [CHAR_a] = CHAR_A,
+    [CHAR_b] = CHAR_B,
+    [CHAR_c] = CHAR_C,
+    [CHAR_d] = CHAR_D,
+    [CHAR_e] = CHAR_E,
+    [CHAR_f] = CHAR_F,
+    [CHAR_g] = CHAR_G,
+    [CHAR_h] = CHAR_H,
+    [CHAR_i] = CHAR_I,
+    [CHAR_j] = CHAR_J,
+    [CHAR_k] = CHAR_K,
+    [CHAR_l] = CHAR_L,
+    [CHAR_m] = CHAR_M,
+    [CHAR_n] = CHAR_N,
+    [CHAR_o] = CHAR_O,
+    [CHAR_p] = CHAR_P,
+    [CHAR_q] = CHAR_Q,
+    [CHAR_r] = CHAR_R,
+    [CHAR_s] = CHAR_S,
+    [CHAR_t] = CHAR_T,
+    [CHAR_u] = CHAR_U,
+    [CHAR_v] = CHAR_V,
+    [CHAR_w] = CHAR_W,
+    [CHAR_x] = CHAR_X,
+    [CHAR_y] = CHAR_Y,
+    [CHAR_z] = CHAR_Z,
+    [CHAR_A_GRAVE] = CHAR_a_GRAVE,
+    [CHAR_A_ACUTE] = CHAR_a_ACUTE,
+    [CHAR_A_CIRCUMFLEX] = CHAR_a_CIRCUMFLEX,
+    [CHAR_A_DIAERESIS] = CHAR_a_DIAERESIS,
+    [CHAR_C_CEDILLA] = CHAR_c_CEDILLA,
+    [CHAR_E_GRAVE] = CHAR_e_GRAVE,
+    [CHAR_E_ACUTE] = CHAR_e_ACUTE,
+    [CHAR_E_CIRCUMFLEX] = CHAR_e_CIRCUMFLEX,
+    [CHAR_E_DIAERESIS] = CHAR_e_DIAERESIS,
+    [CHAR_I_GRAVE] = CHAR_i_GRAVE,
+    [CHAR_I_ACUTE] = CHAR_i_ACUTE,
+    [CHAR_I_CIRCUMFLEX] = CHAR_i_CIRCUMFLEX,
+    [CHAR_I_DIAERESIS] = CHAR_i_DIAERESIS,
+    [CHAR_O_GRAVE] = CHAR_o_GRAVE,
+    [CHAR_O_ACUTE] = CHAR_o_ACUTE,
+    [CHAR_O_CIRCUMFLEX] = CHAR_o_CIRCUMFLEX,
+    [CHAR_O_DIAERESIS] = CHAR_o_DIAERESIS,
+    [CHAR_OE] = CHAR_oe,
+    [CHAR_U_GRAVE] = CHAR_u_GRAVE,
+    [CHAR_U_ACUTE] = CHAR_u_ACUTE,
+    [CHAR_U_CIRCUMFLEX] = CHAR_u_CIRCUMFLEX,
+    [CHAR_U_DIAERESIS] = CHAR_u_DIAERESIS,
+    [CHAR_N_TILDE] = CHAR_n_TILDE,
+    [CHAR_ESZETT] = CHAR_ESZETT,
+    [CHAR_a_GRAVE] = CHAR_A_GRAVE,
+    [CHAR_a_ACUTE] = CHAR_A_ACUTE,
+    [CHAR_a_CIRCUMFLEX] = CHAR_A_CIRCUMFLEX,
+    [CHAR_a_DIAERESIS] = CHAR_A_DIAERESIS,
+    [CHAR_c_CEDILLA] = CHAR_C_CEDILLA,
+    [CHAR_e_GRAVE] = CHAR_E_GRAVE,
+    [CHAR_e_ACUTE] = CHAR_E_ACUTE,
+    [CHAR_e_CIRCUMFLEX] = CHAR_E_CIRCUMFLEX,
+    [CHAR_e_DIAERESIS] = CHAR_E_DIAERESIS,
+    [CHAR_i_GRAVE] = CHAR_I_GRAVE,
+    [CHAR_i_ACUTE] = CHAR_I_ACUTE,
+    [CHAR_i_CIRCUMFLEX] = CHAR_I_CIRCUMFLEX,
+    [CHAR_i_DIAERESIS] = CHAR_I_DIAERESIS,
+    [CHAR_o_GRAVE] = CHAR_O_GRAVE,
+    [CHAR_o_ACUTE] = CHAR_O_ACUTE,
+    [CHAR_o_CIRCUMFLEX] = CHAR_O_CIRCUMFLEX,
+    [CHAR_o_DIAERESIS] = CHAR_O_DIAERESIS,
+    [CHAR_oe] = CHAR_OE,
+    [CHAR_u_GRAVE] = CHAR_U_GRAVE,
+    [CHAR_u_ACUTE] = CHAR_U_ACUTE,
+    [CHAR_u_CIRCUMFLEX] = CHAR_U_CIRCUMFLEX,
+    [CHAR_u_DIAERESIS] = CHAR_U_DIAERESIS,
+    [CHAR_n_TILDE] = CHAR_N_TILDE,
+    [CHAR_0] = CHAR_0,
+    [CHAR_1] = CHAR_1,
+    [CHAR_2] = CHAR_2,
+    [CHAR_3] = CHAR_3,
+    [CHAR_4] = CHAR_4,
+    [CHAR_5] = CHAR_5,
+    [CHAR_6] = CHAR_6,
+    [CHAR_7] = CHAR_7,
+    [CHAR_8] = CHAR_8,
+    [CHAR_9] = CHAR_9,
+    [CHAR_PK] = CHAR_PK,
+    [CHAR_MN] = CHAR_MN,
+    [CHAR_PO] = CHAR_PO,
+    [CHAR_KE] = CHAR_KE,
+    [CHAR_SUPER_E]  = CHAR_SUPER_E,
+    [CHAR_SUPER_ER] = CHAR_SUPER_ER,
+    [CHAR_SUPER_RE] = CHAR_SUPER_RE,
+    [CHAR_PERIOD] = CHAR_PERIOD,
+    [CHAR_COMMA] = CHAR_COMMA,
+    [CHAR_COLON] = CHAR_COLON,
+    [CHAR_SEMICOLON] = CHAR_SEMICOLON,
+    [CHAR_EXCL_MARK] = CHAR_EXCL_MARK,
+    [CHAR_QUESTION_MARK] = CHAR_QUESTION_MARK,
+    [CHAR_HYPHEN] = CHAR_HYPHEN,
+    [CHAR_SLASH] = CHAR_SLASH,
+    [CHAR_ELLIPSIS] = CHAR_ELLIPSIS,
+    [CHAR_LEFT_PAREN] = CHAR_LEFT_PAREN,
+    [CHAR_RIGHT_PAREN] = CHAR_RIGHT_PAREN,
+    [CHAR_AMPERSAND] = CHAR_AMPERSAND,
+    [CHAR_DBL_QUOTE_LEFT] = CHAR_DBL_QUOTE_LEFT,
+    [CHAR_DBL_QUOTE_RIGHT] = CHAR_DBL_QUOTE_RIGHT,
+    [CHAR_SGL_QUOTE_LEFT] = CHAR_SGL_QUOTE_LEFT,
+    [CHAR_SGL_QUOTE_RIGHT] = CHAR_SGL_QUOTE_RIGHT,
+    [CHAR_MASCULINE_ORDINAL] = CHAR_MASCULINE_ORDINAL,
+    [CHAR_FEMININE_ORDINAL] = CHAR_FEMININE_ORDINAL,
+    [CHAR_BULLET] = CHAR_BULLET,
+    [CHAR_EQUALS] = CHAR_EQUALS,
+    [CHAR_MULT_SIGN] = CHAR_MULT_SIGN,
+    [CHAR_PERCENT] = CHAR_PERCENT,
+    [CHAR_LESS_THAN] = CHAR_LESS_THAN,
+    [CHAR_GREATER_THAN] = CHAR_GREATER_THAN,
+    [CHAR_MALE] = CHAR_MALE,
+    [CHAR_FEMALE] = CHAR_FEMALE,
+    [CHAR_CURRENCY] = CHAR_CURRENCY,
+    [CHAR_BLACK_TRIANGLE] = CHAR_BLACK_TRIANGLE,
+};
+
 static const s32 sPowersOfTen[] =
 {
              1,
@@ -9,3 +9,6 @@ const bool8 gTestRunnerEnabled = FALSE;
 // animations and messages play, which helps when debugging a test.
 const bool8 gTestRunnerHeadless = FALSE;
 const bool8 gTestRunnerSkipIsFail = FALSE;
+// Patched by 'make check SCRIPT_PROFILE=...' to count the script
+// commands which each test executes.
+const bool8 gTestRunnerProfileScripts = FALSE;
@@ -21,8 +21,8 @@
 #include "constants/trainer_types.h"
 
 // this file's functions
-static u8 CheckTrainer(u8 objectEventId);
-static u8 GetTrainerApproachDistance(struct ObjectEvent *trainerObj);
+static u8 CheckTrainer(u8 objectEventId, s16 x, s16 y);
+static u8 GetTrainerApproachDistance(struct ObjectEvent *trainerObj, s16 x, s16 y);
 static u8 CheckPathBetweenTrainerAndPlayer(struct ObjectEvent *trainerObj, u8 approachDistance, u8 direction);
 static void InitTrainerApproachTask(struct ObjectEvent *trainerObj, u8 range);
 static void Task_RunTrainerSeeFuncList(u8 taskId);
@@ -359,12 +359,14 @@ static const struct SpriteTemplate sSpriteTemplate_Emote =
 bool8 CheckForTrainersWantingBattle(void)
 {
     u8 i;
+    s16 x, y;
 
     if (FlagGet(OW_FLAG_NO_TRAINER_SEE))
         return FALSE;
 
     gNoOfApproachingTrainers = 0;
     gApproachingTrainerId = 0;
+    PlayerGetDestCoords(&x, &y);
 
     for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
     {
@@ -374,8 +376,11 @@ bool8 CheckForTrainersWantingBattle(void)
             continue;
         if (gObjectEvents[i].trainerType != TRAINER_TYPE_NORMAL && gObjectEvents[i].trainerType != TRAINER_TYPE_BURIED)
             continue;
+        // This runs every frame, so skip the trainers that can't see the player's row or column early
+        if (gObjectEvents[i].currentCoords.x != x && gObjectEvents[i].currentCoords.y != y)
+            continue;
 
-        numTrainers = CheckTrainer(i);
+        numTrainers = CheckTrainer(i, x, y);
         if (numTrainers == 0xFF) // non-trainerbatle script
         {
             u32 objectEventId = gApproachingTrainers[gNoOfApproachingTrainers - 1].objectEventId;
@@ -426,12 +431,12 @@ bool8 CheckForTrainersWantingBattle(void)
     }
 }
 
-static u8 CheckTrainer(u8 objectEventId)
+static u8 CheckTrainer(u8 objectEventId, s16 x, s16 y)
 {
     const u8 *scriptPtr, *trainerBattlePtr;
     u8 numTrainers = 1;
 
-    u8 approachDistance = GetTrainerApproachDistance(&gObjectEvents[objectEventId]);
+    u8 approachDistance = GetTrainerApproachDistance(&gObjectEvents[objectEventId], x, y);
     if (approachDistance == 0)
         return 0;
 
@@ -499,29 +504,26 @@ static u8 CheckTrainer(u8 objectEventId)
     return numTrainers;
 }
 
-static u8 GetTrainerApproachDistance(struct ObjectEvent *trainerObj)
+static u8 GetTrainerApproachDistance(struct ObjectEvent *trainerObj, s16 x, s16 y)
 {
-    s16 x, y;
-    u8 i;
+    u8 direction;
     u8 approachDistance;
 
-    PlayerGetDestCoords(&x, &y);
     if (trainerObj->trainerType == TRAINER_TYPE_NORMAL)  // can only see in one direction
     {
-        approachDistance = sDirectionalApproachDistanceFuncs[trainerObj->facingDirection - 1](trainerObj, trainerObj->trainerRange_berryTreeId, x, y);
-        return CheckPathBetweenTrainerAndPlayer(trainerObj, approachDistance, trainerObj->facingDirection);
+        direction = trainerObj->facingDirection;
     }
     else // TRAINER_TYPE_SEE_ALL_DIRECTIONS, TRAINER_TYPE_BURIED
     {
-        for (i = 0; i < ARRAY_COUNT(sDirectionalApproachDistanceFuncs); i++)
-        {
-            approachDistance = sDirectionalApproachDistanceFuncs[i](trainerObj, trainerObj->trainerRange_berryTreeId, x, y);
-            if (CheckPathBetweenTrainerAndPlayer(trainerObj, approachDistance, i + 1)) // directions are 1-4 instead of 0-3. south north west east
-                return approachDistance;
-        }
+        // The player can only be in one of the trainer's lines of sight, so only that one is checked
+        if (trainerObj->currentCoords.x == x)
+            direction = (y > trainerObj->currentCoords.y) ? DIR_SOUTH : DIR_NORTH;
+        else
+            direction = (x > trainerObj->currentCoords.x) ? DIR_EAST : DIR_WEST;
     }
 
-    return 0;
+    approachDistance = sDirectionalApproachDistanceFuncs[direction - 1](trainerObj, trainerObj->trainerRange_berryTreeId, x, y);
+    return CheckPathBetweenTrainerAndPlayer(trainerObj, approachDistance, direction);
 }
 
 // Returns how far south the player is from trainer. 0 if out of trainer's sight.
@@ -0,0 +1,28 @@
+#include "global.h"
+#include "battle.h"
+#include "battle_transition.h"
+#include "data.h"
+#include "trainer_pools.h"
+#include "constants/abilities.h"
+#include "constants/battle_ai.h"
+#include "constants/battle_partner.h"
+#include "constants/items.h"
+#include "constants/moves.h"
+#include "constants/trainers.h"
+
+// The trainer tables are kept apart from other data so that editing a
+// party only recompiles this file.
+
+#include "data/trainer_parties.h"
+
+const struct Trainer gTrainers[DIFFICULTY_COUNT][TRAINERS_COUNT] =
+{
+#include "data/trainers.h"
+};
+
+#include "data/partner_parties.h"
+
+const struct Trainer gBattlePartners[DIFFICULTY_COUNT][PARTNER_COUNT] =
+{
+#include "data/battle_partners.h"
+};
@@ -227,17 +227,5 @@ u32 CalcByteArraySum(const u8 *data, u32 length)
 
 void BlendPalette(u16 palOffset, u16 numEntries, u8 coeff, u32 blendColor)
 {
-    u16 i;
-    for (i = 0; i < numEntries; i++)
-    {
-        u16 index = i + palOffset;
-        struct PlttData *data1 = (struct PlttData *)&gPlttBufferUnfaded[index];
-        s8 r = data1->r;
-        s8 g = data1->g;
-        s8 b = data1->b;
-        struct PlttData *data2 = (struct PlttData *)&blendColor;
-        gPlttBufferFaded[index] = RGB(r + (((data2->r - r) * coeff) >> 4),
-                                      g + (((data2->g - g) * coeff) >> 4),
-                                      b + (((data2->b - b) * coeff) >> 4));
-    }
+    BlendColors(&gPlttBufferUnfaded[palOffset], &gPlttBufferFaded[palOffset], numEntries, coeff, blendColor);
 }
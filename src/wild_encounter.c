@@ -37,13 +37,6 @@ extern const u8 EventScript_SprayWoreOff[];
 #define NUM_FISHING_SPOTS_3 149
 #define NUM_FISHING_SPOTS (NUM_FISHING_SPOTS_1 + NUM_FISHING_SPOTS_2 + NUM_FISHING_SPOTS_3)
 
-enum {
-    WILD_AREA_LAND,
-    WILD_AREA_WATER,
-    WILD_AREA_ROCKS,
-    WILD_AREA_FISHING,
-};
-
 #define WILD_CHECK_REPEL    (1 << 0)
 #define WILD_CHECK_KEEN_EYE (1 << 1)
 
@@ -354,6 +347,35 @@ static u8 ChooseWildMonLevel(const struct WildPokemon *wildPokemon, u8 wildMonIn
     }
 }
 
+bool32 WildMonHeaderHasSpecies(u32 headerId, u32 species)
+{
+    u32 id;
+
+    if (headerId == HEADER_NONE || species >= NUM_SPECIES || sWildSpeciesIds[species] == 0)
+        return FALSE;
+
+    id = sWildSpeciesIds[species] - 1;
+    return (sWildMonHeaderSpecies[headerId][id / 32] >> (id % 32)) & 1;
+}
+
+// Returns NULL if the species can't be encountered in that area of the header.
+const struct WildSpeciesEncounter *GetWildSpeciesEncounter(u32 headerId, u32 area, u32 species)
+{
+    const struct WildSpeciesEncounterList *list;
+    u32 i;
+
+    if (!WildMonHeaderHasSpecies(headerId, species))
+        return NULL;
+
+    list = &sWildSpeciesEncounterLists[sWildSpeciesIds[species] - 1];
+    for (i = list->first; i < list->first + list->count; i++)
+    {
+        if (sWildSpeciesEncounters[i].headerId == headerId && sWildSpeciesEncounters[i].area == area)
+            return &sWildSpeciesEncounters[i];
+    }
+    return NULL;
+}
+
 u16 GetCurrentMapWildMonHeaderId(void)
 {
     u16 i;
@@ -1,6 +1,7 @@
 #include "global.h"
 #include "test/battle.h"
 #include "battle_ai_util.h"
+#include "event_data.h"
 
 AI_SINGLE_BATTLE_TEST("AI prefers Bubble over Water Gun if it's slower")
 {
@@ -860,3 +861,23 @@ AI_SINGLE_BATTLE_TEST("AI_FLAG_SMART_SWITCHING: AI considers Focus Sash when det
         TURN { MOVE(player, MOVE_AIR_SLASH); EXPECT_MOVE(opponent, MOVE_FLAMETHROWER); }
     }
 }
+
+AI_DOUBLE_BATTLE_TEST("AI makes the same choices when they are spread over many frames")
+{
+    u32 cyclesPerFrame;
+
+    PARAMETRIZE { cyclesPerFrame = 0; }
+    PARAMETRIZE { cyclesPerFrame = 1; }
+
+    VarSet(TESTING_VAR_AI_CYCLES_PER_FRAME, cyclesPerFrame);
+
+    GIVEN {
+        AI_FLAGS(AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_CHECK_VIABILITY | AI_FLAG_TRY_TO_FAINT);
+        PLAYER(SPECIES_WOBBUFFET);
+        PLAYER(SPECIES_WOBBUFFET);
+        OPPONENT(SPECIES_WOBBUFFET) { Moves(MOVE_SUNNY_DAY); }
+        OPPONENT(SPECIES_WOBBUFFET) { Moves(MOVE_TACKLE, MOVE_RAIN_DANCE); }
+    } WHEN {
+        TURN { EXPECT_MOVE(opponentLeft, MOVE_SUNNY_DAY); EXPECT_MOVE(opponentRight, MOVE_TACKLE); }
+    }
+}
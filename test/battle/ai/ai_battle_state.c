@@ -0,0 +1,109 @@
+#include "global.h"
+#include "test/battle.h"
+#include "battle_ai_util.h"
+
+AI_SINGLE_BATTLE_TEST("AI_PopBattleState restores what AI_PushBattleState saved")
+{
+    struct BattlePokemon battleMon;
+    struct SimulatedDamage simulatedDmg;
+    u32 ability, sideStatuses, statuses3, fieldStatuses, battleWeather;
+
+    GIVEN {
+        PLAYER(SPECIES_WOBBUFFET);
+        OPPONENT(SPECIES_WOBBUFFET);
+    } WHEN {
+        TURN { MOVE(player, MOVE_CELEBRATE); }
+    } THEN {
+        battleMon = gBattleMons[B_POSITION_PLAYER_LEFT];
+        simulatedDmg = AI_DATA->simulatedDmg[B_POSITION_OPPONENT_LEFT][B_POSITION_PLAYER_LEFT][0];
+        ability = AI_DATA->abilities[B_POSITION_PLAYER_LEFT];
+        sideStatuses = gSideStatuses[B_SIDE_PLAYER];
+        statuses3 = gStatuses3[B_POSITION_PLAYER_LEFT];
+        fieldStatuses = gFieldStatuses;
+        battleWeather = gBattleWeather;
+
+        EXPECT_EQ(AI_PushBattleState(B_POSITION_PLAYER_LEFT, B_POSITION_OPPONENT_LEFT), 0);
+        gBattleMons[B_POSITION_PLAYER_LEFT].hp = 1;
+        gBattleMons[B_POSITION_PLAYER_LEFT].species = SPECIES_WYNAUT;
+        AI_DATA->simulatedDmg[B_POSITION_OPPONENT_LEFT][B_POSITION_PLAYER_LEFT][0].expected++;
+        AI_DATA->abilities[B_POSITION_PLAYER_LEFT] = ABILITY_LEVITATE;
+        gSideStatuses[B_SIDE_PLAYER] |= SIDE_STATUS_REFLECT;
+        gStatuses3[B_POSITION_PLAYER_LEFT] |= STATUS3_MAGNET_RISE;
+        gFieldStatuses |= STATUS_FIELD_TRICK_ROOM;
+        gBattleWeather = B_WEATHER_RAIN_NORMAL;
+        EXPECT(AI_PopBattleState());
+
+        EXPECT_EQ(memcmp(&gBattleMons[B_POSITION_PLAYER_LEFT], &battleMon, sizeof(battleMon)), 0);
+        EXPECT_EQ(AI_DATA->simulatedDmg[B_POSITION_OPPONENT_LEFT][B_POSITION_PLAYER_LEFT][0].expected, simulatedDmg.expected);
+        EXPECT_EQ(AI_DATA->abilities[B_POSITION_PLAYER_LEFT], ability);
+        EXPECT_EQ(gSideStatuses[B_SIDE_PLAYER], sideStatuses);
+        EXPECT_EQ(gStatuses3[B_POSITION_PLAYER_LEFT], statuses3);
+        EXPECT_EQ(gFieldStatuses, fieldStatuses);
+        EXPECT_EQ(gBattleWeather, battleWeather);
+    }
+}
+
+AI_SINGLE_BATTLE_TEST("AI_PopBattleState restores nested AI_PushBattleStates in reverse order")
+{
+    u32 hp, battleWeather;
+
+    GIVEN {
+        PLAYER(SPECIES_WOBBUFFET);
+        OPPONENT(SPECIES_WOBBUFFET);
+    } WHEN {
+        TURN { MOVE(player, MOVE_CELEBRATE); }
+    } THEN {
+        hp = gBattleMons[B_POSITION_PLAYER_LEFT].hp;
+        battleWeather = gBattleWeather;
+
+        EXPECT_EQ(AI_PushBattleState(B_POSITION_PLAYER_LEFT, MAX_BATTLERS_COUNT), 0);
+        gBattleMons[B_POSITION_PLAYER_LEFT].hp = 2;
+        gBattleWeather = B_WEATHER_RAIN_NORMAL;
+        EXPECT_EQ(AI_PushBattleState(B_POSITION_PLAYER_LEFT, MAX_BATTLERS_COUNT), 1);
+        gBattleMons[B_POSITION_PLAYER_LEFT].hp = 1;
+        gBattleWeather = B_WEATHER_SANDSTORM;
+
+        // Going back to a state doesn't pop it.
+        AI_RestoreBattleState(0);
+        EXPECT_EQ(gBattleMons[B_POSITION_PLAYER_LEFT].hp, hp);
+        EXPECT(AI_PopBattleState());
+        EXPECT_EQ(gBattleMons[B_POSITION_PLAYER_LEFT].hp, 2);
+        EXPECT_EQ(gBattleWeather, B_WEATHER_RAIN_NORMAL);
+        EXPECT(AI_PopBattleState());
+        EXPECT_EQ(gBattleMons[B_POSITION_PLAYER_LEFT].hp, hp);
+        EXPECT_EQ(gBattleWeather, battleWeather);
+    }
+}
+
+AI_SINGLE_BATTLE_TEST("AI_PushBattleState refuses to save past the stack and AI_PopBattleState past its bottom")
+{
+    u32 j, hp;
+
+    GIVEN {
+        PLAYER(SPECIES_WOBBUFFET);
+        OPPONENT(SPECIES_WOBBUFFET);
+    } WHEN {
+        TURN { MOVE(player, MOVE_CELEBRATE); }
+    } THEN {
+        hp = gBattleMons[B_POSITION_PLAYER_LEFT].hp;
+
+        for (j = 0; j < AI_BATTLE_STATE_STACK_SIZE; j++)
+        {
+            EXPECT_EQ(AI_PushBattleState(B_POSITION_PLAYER_LEFT, MAX_BATTLERS_COUNT), j);
+            gBattleMons[B_POSITION_PLAYER_LEFT].hp = j + 1;
+        }
+        EXPECT_EQ(AI_PushBattleState(B_POSITION_PLAYER_LEFT, MAX_BATTLERS_COUNT), AI_BATTLE_STATE_NONE);
+        EXPECT_EQ(gBattleResources->aiStateStack->size, AI_BATTLE_STATE_STACK_SIZE);
+
+        // The refused push didn't overwrite the last saved state.
+        EXPECT(AI_PopBattleState());
+        EXPECT_EQ(gBattleMons[B_POSITION_PLAYER_LEFT].hp, AI_BATTLE_STATE_STACK_SIZE - 1);
+        for (j = 1; j < AI_BATTLE_STATE_STACK_SIZE; j++)
+            EXPECT(AI_PopBattleState());
+        EXPECT_EQ(gBattleMons[B_POSITION_PLAYER_LEFT].hp, hp);
+
+        EXPECT(!AI_PopBattleState());
+        EXPECT_EQ(gBattleResources->aiStateStack->size, 0);
+        EXPECT_EQ(gBattleMons[B_POSITION_PLAYER_LEFT].hp, hp);
+    }
+}
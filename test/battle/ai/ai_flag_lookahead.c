@@ -0,0 +1,17 @@
+#include "global.h"
+#include "test/battle.h"
+
+AI_SINGLE_BATTLE_TEST("AI_FLAG_LOOKAHEAD: AI prefers a draining move that lets it survive to KO next turn")
+{
+    GIVEN {
+        ASSUME(GetMoveEffect(MOVE_GIGA_DRAIN) == EFFECT_ABSORB);
+        ASSUME(GetMoveEffect(MOVE_DRAGON_RAGE) == EFFECT_FIXED_DAMAGE_ARG);
+        ASSUME(GetMoveType(MOVE_GIGA_DRAIN) == GetMoveType(MOVE_ENERGY_BALL));
+        ASSUME(GetMovePower(MOVE_GIGA_DRAIN) < GetMovePower(MOVE_ENERGY_BALL));
+        AI_FLAGS(AI_FLAG_CHECK_BAD_MOVE | AI_FLAG_OMNISCIENT | AI_FLAG_LOOKAHEAD);
+        PLAYER(SPECIES_WOBBUFFET) { Level(100); HP(120); Speed(1); SpDefense(100); Moves(MOVE_DRAGON_RAGE); }
+        OPPONENT(SPECIES_WOBBUFFET) { Level(100); HP(40); Speed(100); SpAttack(100); Moves(MOVE_ENERGY_BALL, MOVE_GIGA_DRAIN); }
+    } WHEN {
+        TURN { MOVE(player, MOVE_DRAGON_RAGE); EXPECT_MOVE(opponent, MOVE_GIGA_DRAIN); }
+    }
+}
@@ -0,0 +1,54 @@
+#include "global.h"
+#include "battle_anim.h"
+#include "decompress.h"
+#include "malloc.h"
+#include "test/test.h"
+
+TEST("Battle animation graphics are decompressed once and then reused")
+{
+    struct BattleAnimGfxCacheEntry *entry;
+    u32 index = GET_TRUE_SPRITE_INDEX(ANIM_TAG_BONE);
+    u8 *tiles = Alloc(GetDecompressedDataSize(gBattleAnimPicTable[index].data));
+
+    ASSUME(B_ANIM_GFX_CACHE_SIZE != 0);
+    AllocBattleAnimGfxCache();
+
+    entry = GetBattleAnimGfxCacheEntry(index);
+    EXPECT(entry != NULL);
+    LZDecompressWram(gBattleAnimPicTable[index].data, tiles);
+    EXPECT(memcmp(entry->gfx, tiles, entry->tilesSize) == 0);
+    EXPECT(GetBattleAnimGfxCacheEntry(index) == entry);
+
+    FreeBattleAnimGfxCache();
+    Free(tiles);
+}
+
+TEST("Battle animation graphics cache evicts the least recently used graphics")
+{
+    u32 i, first = 0xFFFF, second = 0xFFFF;
+
+    ASSUME(B_ANIM_GFX_CACHE_SIZE != 0);
+    AllocBattleAnimGfxCache();
+
+    // Keep the first graphics in use while loading more until something is evicted.
+    for (i = 0; i < ANIM_GFX_CACHE_ENTRIES * 4; i++)
+    {
+        if (GetBattleAnimGfxCacheEntry(i) == NULL)
+            continue;
+
+        if (first == 0xFFFF)
+            first = i;
+        else if (second == 0xFFFF)
+            second = i;
+        GetBattleAnimGfxCacheEntry(first);
+        if (second != 0xFFFF && !IsBattleAnimGfxCached(second))
+            break;
+    }
+
+    EXPECT_NE(second, 0xFFFF);
+    EXPECT(IsBattleAnimGfxCached(first));
+    EXPECT(!IsBattleAnimGfxCached(second));
+    EXPECT(IsBattleAnimGfxCached(i));
+
+    FreeBattleAnimGfxCache();
+}
@@ -0,0 +1,55 @@
+#include "global.h"
+#include "battle.h"
+#include "battle_ai_main.h"
+#include "battle_util.h"
+#include "test/battle.h"
+
+SINGLE_BATTLE_TEST("CalculateMoveDamage")
+{
+    GIVEN {
+        PLAYER(SPECIES_GARCHOMP) { Ability(ABILITY_ROUGH_SKIN); Item(ITEM_CHOICE_BAND); Moves(MOVE_EARTHQUAKE, MOVE_CELEBRATE); }
+        OPPONENT(SPECIES_METAGROSS) { Ability(ABILITY_CLEAR_BODY); Item(ITEM_LEFTOVERS); Moves(MOVE_CELEBRATE); }
+    } WHEN {
+        TURN { MOVE(player, MOVE_CELEBRATE); }
+    } THEN {
+        u32 i;
+        struct Benchmark benchmark;
+        struct DamageCalculationData damageCalcData = {0};
+        s32 damage = 0;
+
+        damageCalcData.battlerAtk = B_POSITION_PLAYER_LEFT;
+        damageCalcData.battlerDef = B_POSITION_OPPONENT_LEFT;
+        damageCalcData.move = MOVE_EARTHQUAKE;
+        damageCalcData.moveType = GetMoveType(MOVE_EARTHQUAKE);
+
+        BENCHMARK(&benchmark)
+        {
+            for (i = 0; i < 16; i++)
+                damage += CalculateMoveDamage(&damageCalcData, 0);
+        }
+
+        EXPECT_GT(damage, 0);
+        REPORT_BENCHMARK(benchmark);
+    }
+}
+
+AI_SINGLE_BATTLE_TEST("BattleAI_ChooseMoveOrAction")
+{
+    GIVEN {
+        AI_FLAGS(AI_FLAG_SMART_TRAINER);
+        PLAYER(SPECIES_BLISSEY) { Moves(MOVE_SEISMIC_TOSS, MOVE_SOFT_BOILED, MOVE_TOXIC, MOVE_CALM_MIND); }
+        OPPONENT(SPECIES_GENGAR) { Moves(MOVE_SHADOW_BALL, MOVE_SLUDGE_BOMB, MOVE_WILL_O_WISP, MOVE_SUBSTITUTE); }
+        OPPONENT(SPECIES_TYRANITAR) { Moves(MOVE_STONE_EDGE, MOVE_CRUNCH, MOVE_EARTHQUAKE, MOVE_DRAGON_DANCE); }
+    } WHEN {
+        TURN { MOVE(player, MOVE_CALM_MIND); }
+    } THEN {
+        struct Benchmark benchmark;
+
+        BENCHMARK(&benchmark)
+        {
+            BattleAI_ChooseMoveOrAction(B_POSITION_OPPONENT_LEFT);
+        }
+
+        REPORT_BENCHMARK(benchmark);
+    }
+}
@@ -0,0 +1,113 @@
+#include "global.h"
+#include "bg.h"
+#include "decompress.h"
+#include "main.h"
+#include "malloc.h"
+#include "palette.h"
+#include "random.h"
+#include "sprite.h"
+#include "text.h"
+#include "window.h"
+#include "test/test.h"
+#include "constants/rgb.h"
+
+extern const u32 gTilesetTiles_Petalburg[];
+
+static const struct BgTemplate sMessageBoxBgTemplate =
+{
+    .bg = 0,
+    .charBaseIndex = 2,
+    .mapBaseIndex = 31,
+    .priority = 0,
+};
+
+static const struct WindowTemplate sMessageBoxWindowTemplates[] =
+{
+    {
+        .bg = 0,
+        .tilemapLeft = 2,
+        .tilemapTop = 15,
+        .width = 27,
+        .height = 4,
+        .paletteNum = 15,
+        .baseBlock = 1,
+    },
+    DUMMY_WIN_TEMPLATE,
+};
+
+TEST("BuildOamBuffer with 64 sprites")
+{
+    u32 i;
+    struct Benchmark benchmark;
+
+    ResetSpriteData();
+    for (i = 0; i < 64; i++)
+        EXPECT_NE(CreateSprite(&gDummySpriteTemplate, Random() % 256, Random() % 256, Random() % 256), MAX_SPRITES);
+    // Sort once so that the benchmark measures a typical frame.
+    BuildOamBuffer();
+
+    BENCHMARK(&benchmark)
+    {
+        BuildOamBuffer();
+    }
+
+    REPORT_BENCHMARK(benchmark);
+    ResetSpriteData();
+}
+
+TEST("RenderText for a full message box")
+{
+    struct Benchmark benchmark;
+
+    ResetBgsAndClearDma3BusyFlags(0);
+    InitBgsFromTemplates(0, &sMessageBoxBgTemplate, 1);
+    EXPECT(InitWindows(sMessageBoxWindowTemplates));
+
+    BENCHMARK(&benchmark)
+    {
+        AddTextPrinterParameterized(0, FONT_NORMAL, COMPOUND_STRING("I've been studying POKéMON habitats\nall around the HOENN region, you see!"), 0, 1, TEXT_SKIP_DRAW, NULL);
+    }
+
+    REPORT_BENCHMARK(benchmark);
+    FreeAllWindowBuffers();
+}
+
+TEST("LZ77UnCompWram for a tileset")
+{
+    struct Benchmark benchmark;
+    u8 *tiles = Alloc(GetDecompressedDataSize(gTilesetTiles_Petalburg));
+
+    BENCHMARK(&benchmark)
+    {
+        LZ77UnCompWram(gTilesetTiles_Petalburg, tiles);
+    }
+
+    REPORT_BENCHMARK(benchmark);
+    Free(tiles);
+}
+
+TEST("LZDecompressWram for a tileset")
+{
+    struct Benchmark benchmark;
+    u8 *tiles = Alloc(GetDecompressedDataSize(gTilesetTiles_Petalburg));
+
+    BENCHMARK(&benchmark)
+    {
+        LZDecompressWram(gTilesetTiles_Petalburg, tiles);
+    }
+
+    REPORT_BENCHMARK(benchmark);
+    Free(tiles);
+}
+
+TEST("BlendPalettes for all palettes")
+{
+    struct Benchmark benchmark;
+
+    BENCHMARK(&benchmark)
+    {
+        BlendPalettes(PALETTES_ALL, 8, RGB_BLACK);
+    }
+
+    REPORT_BENCHMARK(benchmark);
+}
@@ -0,0 +1,27 @@
+#include "global.h"
+#include "event_data.h"
+#include "fieldmap.h"
+#include "overworld.h"
+#include "task.h"
+#include "test/test.h"
+#include "constants/maps.h"
+
+TEST("LoadMapFromCameraTransition")
+{
+    struct Benchmark benchmark;
+
+    // Load the map that the player walks out of first, so that the
+    // benchmark starts from an initialized overworld.
+    LoadMapFromCameraTransition(MAP_GROUP(OLDALE_TOWN), MAP_NUM(OLDALE_TOWN));
+
+    BENCHMARK(&benchmark)
+    {
+        LoadMapFromCameraTransition(MAP_GROUP(ROUTE101), MAP_NUM(ROUTE101));
+    }
+
+    EXPECT_EQ(gSaveBlock1Ptr->location.mapGroup, MAP_GROUP(ROUTE101));
+    EXPECT_EQ(gSaveBlock1Ptr->location.mapNum, MAP_NUM(ROUTE101));
+    REPORT_BENCHMARK(benchmark);
+    // The map name pop-ups are never run.
+    ResetTasks();
+}
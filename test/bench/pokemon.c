@@ -0,0 +1,44 @@
+#include "global.h"
+#include "pokemon.h"
+#include "test/test.h"
+
+// The fields that the party menu and summary screen read for each mon.
+static const u8 sPartyMonDataFields[] =
+{
+    MON_DATA_SPECIES, MON_DATA_PERSONALITY, MON_DATA_IS_EGG,
+    MON_DATA_LEVEL, MON_DATA_HP, MON_DATA_MAX_HP, MON_DATA_STATUS,
+    MON_DATA_HELD_ITEM, MON_DATA_EXP, MON_DATA_FRIENDSHIP,
+    MON_DATA_MOVE1, MON_DATA_MOVE2, MON_DATA_MOVE3, MON_DATA_MOVE4,
+    MON_DATA_PP1, MON_DATA_PP2, MON_DATA_PP3, MON_DATA_PP4,
+    MON_DATA_ATK, MON_DATA_DEF, MON_DATA_SPEED, MON_DATA_SPATK, MON_DATA_SPDEF,
+};
+
+static const u16 sPartySpecies[PARTY_SIZE] =
+{
+    SPECIES_SCEPTILE, SPECIES_SWELLOW, SPECIES_GARDEVOIR,
+    SPECIES_AGGRON, SPECIES_MILOTIC, SPECIES_SALAMENCE,
+};
+
+TEST("GetMonData on a full party")
+{
+    u32 i, j;
+    struct Benchmark benchmark;
+    u32 sum = 0;
+
+    for (i = 0; i < PARTY_SIZE; i++)
+        CreateMon(&gPlayerParty[i], sPartySpecies[i], 50, 0, FALSE, 0, OT_ID_PRESET, 0);
+    CalculatePlayerPartyCount();
+
+    BENCHMARK(&benchmark)
+    {
+        for (i = 0; i < PARTY_SIZE; i++)
+        {
+            for (j = 0; j < ARRAY_COUNT(sPartyMonDataFields); j++)
+                sum += GetMonData(&gPlayerParty[i], sPartyMonDataFields[j]);
+        }
+    }
+
+    // Reference sum to prevent optimization.
+    EXPECT_NE(sum, 0);
+    REPORT_BENCHMARK(benchmark);
+}
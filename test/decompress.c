@@ -0,0 +1,94 @@
+#include "global.h"
+#include "decompress.h"
+#include "malloc.h"
+#include "test/test.h"
+
+extern const u32 gTilesetTiles_Petalburg[];
+
+TEST("LZ77Stream_Decompress matches LZ77UnCompWram")
+{
+    u32 budget = 0;
+    u32 size = GetDecompressedDataSize(gTilesetTiles_Petalburg);
+    u8 *expected = Alloc(size);
+    u8 *actual = Alloc(size);
+    struct LZ77Stream stream;
+
+    PARAMETRIZE { budget = 1; }
+    PARAMETRIZE { budget = 0x100; }
+    PARAMETRIZE { budget = 0x800; }
+    PARAMETRIZE { budget = size; }
+
+    LZ77UnCompWram(gTilesetTiles_Petalburg, expected);
+    LZ77Stream_Init(&stream, gTilesetTiles_Petalburg, actual);
+    while (!LZ77Stream_Decompress(&stream, budget))
+        EXPECT_EQ(stream.dest - actual, size - stream.remaining);
+
+    EXPECT(memcmp(expected, actual, size) == 0);
+    Free(expected);
+    Free(actual);
+}
+
+TEST("LZDecompressWram and LZDecompressVram match the BIOS")
+{
+    u32 size = GetDecompressedDataSize(gTilesetTiles_Petalburg);
+    u8 *expected = Alloc(size);
+    u8 *actual = Alloc(size);
+
+    LZ77UnCompWram(gTilesetTiles_Petalburg, expected);
+    LZDecompressWram(gTilesetTiles_Petalburg, actual);
+    EXPECT(memcmp(expected, actual, size) == 0);
+
+    memset(actual, 0, size);
+    LZDecompressVram(gTilesetTiles_Petalburg, actual);
+    EXPECT(memcmp(expected, actual, size) == 0);
+
+    Free(expected);
+    Free(actual);
+}
+
+// Runs of 3, 130 and 6 bytes, and 1 and 128 literal bytes.
+static const u8 sRLData[] __attribute__((aligned(4))) =
+{
+    0x30, 0x0C, 0x01, 0x00,
+    0x80, 0xAA,
+    0xFF, 0xBB,
+    0x00, 0x01,
+    0x7F, [11 ... 138] = 0x5C,
+    0x83, 0xCC,
+};
+
+TEST("RLDecompressWram and RLDecompressVram match the BIOS")
+{
+    u32 size = sRLData[1] | (sRLData[2] << 8);
+    u8 *expected = Alloc(size);
+    u8 *actual = Alloc(size);
+
+    RLUnCompWram(sRLData, expected);
+    RLDecompressWram(sRLData, actual);
+    EXPECT(memcmp(expected, actual, size) == 0);
+
+    memset(actual, 0, size);
+    RLDecompressVram(sRLData, actual);
+    EXPECT(memcmp(expected, actual, size) == 0);
+
+    Free(expected);
+    Free(actual);
+}
+
+TEST("LZDecompressWram faster than LZ77UnCompWram")
+{
+    struct Benchmark bios, iwram;
+    u8 *dest = Alloc(GetDecompressedDataSize(gTilesetTiles_Petalburg));
+
+    BENCHMARK(&bios)
+    {
+        LZ77UnCompWram(gTilesetTiles_Petalburg, dest);
+    }
+    BENCHMARK(&iwram)
+    {
+        LZDecompressWram(gTilesetTiles_Petalburg, dest);
+    }
+
+    EXPECT_FASTER(iwram, bios);
+    Free(dest);
+}
@@ -0,0 +1,156 @@
+#include "global.h"
+#include "event_object_movement.h"
+#include "fieldmap.h"
+#include "test/test.h"
+
+#define NUM_TEST_OBJECT_EVENTS 12
+
+static u32 FindObjectEventByXY(s16 x, s16 y)
+{
+    u32 i;
+    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    {
+        if (gObjectEvents[i].active && gObjectEvents[i].currentCoords.x == x && gObjectEvents[i].currentCoords.y == y)
+            return i;
+    }
+    return OBJECT_EVENTS_COUNT;
+}
+
+static u32 FindObjectEventByLocalId(u32 localId)
+{
+    u32 i;
+    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    {
+        if (gObjectEvents[i].active && gObjectEvents[i].localId == localId)
+            return i;
+    }
+    return OBJECT_EVENTS_COUNT;
+}
+
+static u32 FindObjectEventByLocalIdAndMap(u32 localId, u32 mapNum, u32 mapGroup)
+{
+    u32 i;
+    for (i = 0; i < OBJECT_EVENTS_COUNT; i++)
+    {
+        if (gObjectEvents[i].active && gObjectEvents[i].localId == localId
+         && gObjectEvents[i].mapNum == mapNum && gObjectEvents[i].mapGroup == mapGroup)
+            return i;
+    }
+    return OBJECT_EVENTS_COUNT;
+}
+
+// Every lookup through the spatial index has to find the same object event
+// as a scan over gObjectEvents would.
+static void ExpectLookupsMatchScan(void)
+{
+    s32 x, y;
+    u32 localId;
+
+    for (y = 0; y < 48; y++)
+    {
+        for (x = 0; x < 48; x++)
+        {
+            EXPECT_EQ(GetObjectEventIdByXY(x, y), FindObjectEventByXY(x, y));
+            EXPECT_EQ(GetObjectEventIdByPosition(x, y, 0), FindObjectEventByXY(x, y));
+        }
+    }
+
+    for (localId = 0; localId < 32; localId++)
+    {
+        EXPECT_EQ(GetObjectEventIdByLocalId(localId), FindObjectEventByLocalId(localId));
+        EXPECT_EQ(GetObjectEventIdByLocalIdAndMap(localId, 1, 0), FindObjectEventByLocalIdAndMap(localId, 1, 0));
+        EXPECT_EQ(GetObjectEventIdByLocalIdAndMap(localId, 2, 0), FindObjectEventByLocalIdAndMap(localId, 2, 0));
+    }
+}
+
+static void SetUpObjectEvents(void)
+{
+    u32 i;
+
+    memset(gObjectEvents, 0, sizeof(gObjectEvents));
+    RebuildObjectEventSpatialIndex();
+
+    // Coords and localIds which share buckets, and a few which share tiles.
+    for (i = 0; i < NUM_TEST_OBJECT_EVENTS; i++)
+    {
+        gObjectEvents[i].active = TRUE;
+        gObjectEvents[i].localId = 1 + (i * 7) % 20;
+        gObjectEvents[i].mapNum = 1 + i % 2;
+        gObjectEvents[i].currentCoords.x = gObjectEvents[i].previousCoords.x = MAP_OFFSET + (i * 5) % 24;
+        gObjectEvents[i].currentCoords.y = gObjectEvents[i].previousCoords.y = MAP_OFFSET + (i * 3) % 16;
+        UpdateObjectEventSpatialIndex(&gObjectEvents[i]);
+    }
+}
+
+static void TearDownObjectEvents(void)
+{
+    memset(gObjectEvents, 0, sizeof(gObjectEvents));
+    RebuildObjectEventSpatialIndex();
+}
+
+TEST("Object event lookups match a scan after object events move")
+{
+    u32 i;
+
+    SetUpObjectEvents();
+    ExpectLookupsMatchScan();
+
+    for (i = 0; i < NUM_TEST_OBJECT_EVENTS; i++)
+    {
+        // Into another bucket, within the same bucket, and onto the same tile as another object.
+        ShiftObjectEventCoords(&gObjectEvents[i], gObjectEvents[i].currentCoords.x + 1, gObjectEvents[i].currentCoords.y);
+        ExpectLookupsMatchScan();
+        ShiftObjectEventCoords(&gObjectEvents[i], gObjectEvents[i].currentCoords.x + 8, gObjectEvents[i].currentCoords.y + 8);
+        ExpectLookupsMatchScan();
+        ShiftObjectEventCoords(&gObjectEvents[i], gObjectEvents[0].currentCoords.x, gObjectEvents[0].currentCoords.y);
+        ExpectLookupsMatchScan();
+    }
+
+    TearDownObjectEvents();
+}
+
+TEST("Object event lookups match a scan after object events are removed")
+{
+    u32 i;
+
+    SetUpObjectEvents();
+    for (i = 0; i < NUM_TEST_OBJECT_EVENTS; i += 2)
+    {
+        gObjectEvents[i].active = FALSE;
+        UpdateObjectEventSpatialIndex(&gObjectEvents[i]);
+        ExpectLookupsMatchScan();
+    }
+
+    // Slots which are reused by new object events.
+    for (i = 0; i < NUM_TEST_OBJECT_EVENTS; i += 4)
+    {
+        gObjectEvents[i].active = TRUE;
+        gObjectEvents[i].localId = 30 - i;
+        gObjectEvents[i].currentCoords.x = gObjectEvents[i].previousCoords.x = 31 - i;
+        UpdateObjectEventSpatialIndex(&gObjectEvents[i]);
+        ExpectLookupsMatchScan();
+    }
+
+    TearDownObjectEvents();
+}
+
+TEST("Object event lookups match a scan after the camera shifts")
+{
+    s32 dx = 0, dy = 0;
+    struct Camera camera = gCamera;
+
+    PARAMETRIZE { dx = 1; dy = 0; }
+    PARAMETRIZE { dx = 0; dy = -1; }
+    PARAMETRIZE { dx = -3; dy = 5; }
+    PARAMETRIZE { dx = 7; dy = -7; }
+
+    SetUpObjectEvents();
+    gCamera.active = TRUE;
+    gCamera.x = dx;
+    gCamera.y = dy;
+    UpdateObjectEventCoordsForCameraUpdate();
+    ExpectLookupsMatchScan();
+
+    gCamera = camera;
+    TearDownObjectEvents();
+}
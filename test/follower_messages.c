@@ -0,0 +1,68 @@
+#include "global.h"
+#include "data.h"
+#include "event_object_movement.h"
+#include "follower_helper.h"
+#include "overworld.h"
+#include "test/test.h"
+#include "constants/map_groups.h"
+#include "data/map_group_count.h"
+
+static bool32 IsCandidate(const u32 *candidates, u32 msgId)
+{
+    return (candidates[msgId / 32] & (1u << (msgId % 32))) != 0;
+}
+
+TEST("GetFollowerMsgCandidates indexes messages by species and type")
+{
+    u32 candidates[COND_MSG_WORDS];
+
+    ASSUME(P_FAMILY_CELEBI == TRUE);
+    ASSUME(P_FAMILY_CHARMANDER == TRUE);
+
+    GetFollowerMsgCandidates(SPECIES_CELEBI, candidates);
+    EXPECT(IsCandidate(candidates, COND_MSG_CELEBI));
+    GetFollowerMsgCandidates(SPECIES_CHARMANDER, candidates);
+    EXPECT(!IsCandidate(candidates, COND_MSG_CELEBI));
+    EXPECT(IsCandidate(candidates, COND_MSG_FIRE));
+    GetFollowerMsgCandidates(SPECIES_WOBBUFFET, candidates);
+    EXPECT(!IsCandidate(candidates, COND_MSG_FIRE));
+}
+
+TEST("GetFollowerMsgCandidates includes every message which can match")
+{
+    u32 species, mapGroup, mapNum, i;
+    u32 candidates[COND_MSG_WORDS];
+    struct Pokemon mon = {0};
+    struct ObjectEvent objEvent = {0};
+    struct WarpData location = gSaveBlock1Ptr->location;
+    u32 regionMapSectionId = gMapHeader.regionMapSectionId;
+
+    for (species = SPECIES_NONE + 1; species < NUM_SPECIES; species++)
+    {
+        GetFollowerMsgCandidates(species, candidates);
+        for (i = 0; i < COND_MSG_COUNT; i++)
+        {
+            if (!IsCandidate(candidates, i))
+                EXPECT(!CheckMsgInfo(&gFollowerConditionalMessages[i], &mon, species, &objEvent));
+        }
+    }
+
+    for (mapGroup = 0; mapGroup < MAP_GROUPS_COUNT; mapGroup++)
+    {
+        for (mapNum = 0; mapNum < MAP_GROUP_COUNT[mapGroup]; mapNum++)
+        {
+            gSaveBlock1Ptr->location.mapGroup = mapGroup;
+            gSaveBlock1Ptr->location.mapNum = mapNum;
+            gMapHeader.regionMapSectionId = Overworld_GetMapHeaderByGroupAndId(mapGroup, mapNum)->regionMapSectionId;
+            GetFollowerMsgCandidates(SPECIES_WOBBUFFET, candidates);
+            for (i = 0; i < COND_MSG_COUNT; i++)
+            {
+                if (!IsCandidate(candidates, i))
+                    EXPECT(!CheckMsgInfo(&gFollowerConditionalMessages[i], &mon, SPECIES_WOBBUFFET, &objEvent));
+            }
+        }
+    }
+
+    gSaveBlock1Ptr->location = location;
+    gMapHeader.regionMapSectionId = regionMapSectionId;
+}
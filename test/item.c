@@ -0,0 +1,63 @@
+#include "global.h"
+#include "item.h"
+#include "test/test.h"
+#include "constants/items.h"
+
+TEST("AddBagItem and RemoveBagItem keep item lookups consistent")
+{
+    ClearBag();
+    EXPECT(AddBagItem(ITEM_POTION, 5));
+    EXPECT(AddBagItem(ITEM_ANTIDOTE, 1));
+    EXPECT(AddBagItem(ITEM_POTION, 3));
+    EXPECT(CheckBagHasItem(ITEM_POTION, 8));
+    EXPECT(!CheckBagHasItem(ITEM_POTION, 9));
+    EXPECT_EQ(CountTotalItemQuantityInBag(ITEM_POTION), 8);
+    EXPECT_EQ(GetFreeSpaceForItemInBag(ITEM_POTION), (BAG_ITEMS_COUNT - 1) * MAX_BAG_ITEM_CAPACITY - 8);
+
+    EXPECT(RemoveBagItem(ITEM_POTION, 8));
+    EXPECT(!CheckBagHasItem(ITEM_POTION, 1));
+    EXPECT(!RemoveBagItem(ITEM_POTION, 1));
+    EXPECT_EQ(GetFreeSpaceForItemInBag(ITEM_POTION), (BAG_ITEMS_COUNT - 1) * MAX_BAG_ITEM_CAPACITY);
+    EXPECT(CheckBagHasItem(ITEM_ANTIDOTE, 1));
+}
+
+TEST("Item lookups follow items moved between slots")
+{
+    ClearBag();
+    EXPECT(AddBagItem(ITEM_POTION, 1));
+    EXPECT(AddBagItem(ITEM_ANTIDOTE, 2));
+    EXPECT(RemoveBagItem(ITEM_POTION, 1));
+    CompactItemsInBagPocket(&gBagPockets[ITEMS_POCKET]);
+    EXPECT_EQ(gBagPockets[ITEMS_POCKET].itemSlots[0].itemId, ITEM_ANTIDOTE);
+    EXPECT(CheckBagHasItem(ITEM_ANTIDOTE, 2));
+
+    EXPECT(AddBagItem(ITEM_POTION, 1));
+    MoveItemSlotInList(gBagPockets[ITEMS_POCKET].itemSlots, 1, 0);
+    EXPECT_EQ(gBagPockets[ITEMS_POCKET].itemSlots[0].itemId, ITEM_POTION);
+    EXPECT(RemoveBagItem(ITEM_ANTIDOTE, 2));
+    EXPECT(CheckBagHasItem(ITEM_POTION, 1));
+    EXPECT(!CheckBagHasItem(ITEM_ANTIDOTE, 1));
+}
+
+TEST("Items which overflow into several slots are counted across them")
+{
+    ClearBag();
+    EXPECT(AddBagItem(ITEM_POTION, MAX_BAG_ITEM_CAPACITY));
+    EXPECT(AddBagItem(ITEM_POTION, 10));
+    EXPECT_EQ(CountTotalItemQuantityInBag(ITEM_POTION), MAX_BAG_ITEM_CAPACITY + 10);
+    EXPECT(CheckBagHasItem(ITEM_POTION, MAX_BAG_ITEM_CAPACITY + 10));
+    EXPECT(RemoveBagItem(ITEM_POTION, MAX_BAG_ITEM_CAPACITY + 5));
+    EXPECT_EQ(CountTotalItemQuantityInBag(ITEM_POTION), 5);
+}
+
+TEST("CheckBagHasItem finds items which were written without invalidating the lookups")
+{
+    ClearBag();
+    EXPECT(!CheckBagHasItem(ITEM_POTION, 1));
+
+    // As a save being loaded or a link trade would.
+    gBagPockets[ITEMS_POCKET].itemSlots[0].itemId = ITEM_POTION;
+    gBagPockets[ITEMS_POCKET].itemSlots[0].quantity = 2 ^ gSaveBlock2Ptr->encryptionKey;
+    EXPECT(CheckBagHasItem(ITEM_POTION, 2));
+    EXPECT(!CheckBagHasItem(ITEM_POTION, 3));
+}
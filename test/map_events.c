@@ -0,0 +1,54 @@
+#include "global.h"
+#include "overworld.h"
+#include "test/test.h"
+#include "constants/map_groups.h"
+#include "data/map_group_count.h"
+
+static u32 GetPositionKey(const void *event)
+{
+    const u16 *position = event;
+    return (position[1] << 16) | position[0];
+}
+
+// Checks that 'index' lists each event once, sorted by position, with the
+// events on the same tile in the order that they are in the map.
+static void ExpectEventIndexSorted(const u8 *index, u32 count, const void *events, u32 eventSize)
+{
+    u32 i;
+    bool8 seen[256] = {0};
+
+    if (count == 0)
+        return;
+
+    EXPECT(index != NULL);
+    for (i = 0; i < count; i++)
+    {
+        EXPECT_LT(index[i], count);
+        EXPECT(!seen[index[i]]);
+        seen[index[i]] = TRUE;
+        if (i != 0)
+        {
+            u32 previous = GetPositionKey((const u8 *)events + index[i - 1] * eventSize);
+            u32 current = GetPositionKey((const u8 *)events + index[i] * eventSize);
+            EXPECT_LE(previous, current);
+            if (previous == current)
+                EXPECT_LT(index[i - 1], index[i]);
+        }
+    }
+}
+
+TEST("Map event indexes list every warp, coord and bg event sorted by position")
+{
+    u32 mapGroup, mapNum;
+
+    for (mapGroup = 0; mapGroup < MAP_GROUPS_COUNT; mapGroup++)
+    {
+        for (mapNum = 0; mapNum < MAP_GROUP_COUNT[mapGroup]; mapNum++)
+        {
+            const struct MapEvents *events = Overworld_GetMapHeaderByGroupAndId(mapGroup, mapNum)->events;
+            ExpectEventIndexSorted(events->warpIndex, events->warpCount, events->warps, sizeof(*events->warps));
+            ExpectEventIndexSorted(events->coordEventIndex, events->coordEventCount, events->coordEvents, sizeof(*events->coordEvents));
+            ExpectEventIndexSorted(events->bgEventIndex, events->bgEventCount, events->bgEvents, sizeof(*events->bgEvents));
+        }
+    }
+}
@@ -0,0 +1,118 @@
+#include "global.h"
+#include "metatile_behavior.h"
+#include "test/test.h"
+#include "constants/metatile_behaviors.h"
+
+static bool32 Old_IsReflective(u32 b)
+{
+    return b == MB_POND_WATER || b == MB_PUDDLE || b == MB_UNUSED_SOOTOPOLIS_DEEP_WATER_2
+        || b == MB_ICE || b == MB_SOOTOPOLIS_DEEP_WATER || b == MB_REFLECTION_UNDER_BRIDGE;
+}
+
+static bool32 Old_IsForcedMovementTile(u32 b)
+{
+    return (b >= MB_WALK_EAST && b <= MB_TRICK_HOUSE_PUZZLE_8_FLOOR)
+        || (b >= MB_EASTWARD_CURRENT && b <= MB_SOUTHWARD_CURRENT)
+        || b == MB_MUDDY_SLOPE || b == MB_CRACKED_FLOOR || b == MB_WATERFALL || b == MB_ICE
+        || b == MB_SECRET_BASE_JUMP_MAT || b == MB_SECRET_BASE_SPIN_MAT;
+}
+
+static bool32 Old_IsBridgeOverWater(u32 b)
+{
+    return b == MB_BRIDGE_OVER_OCEAN || b == MB_BRIDGE_OVER_POND_LOW || b == MB_BRIDGE_OVER_POND_MED
+        || b == MB_BRIDGE_OVER_POND_HIGH || b == MB_BRIDGE_OVER_POND_HIGH_EDGE_1
+        || b == MB_BRIDGE_OVER_POND_HIGH_EDGE_2 || b == MB_UNUSED_BRIDGE || b == MB_BIKE_BRIDGE_OVER_BARRIER;
+}
+
+static bool32 Old_IsEastBlocked(u32 b)
+{
+    return b == MB_IMPASSABLE_EAST || b == MB_IMPASSABLE_NORTHEAST || b == MB_IMPASSABLE_SOUTHEAST
+        || b == MB_IMPASSABLE_WEST_AND_EAST || b == MB_SECRET_BASE_BREAKABLE_DOOR;
+}
+
+static bool32 Old_IsWestBlocked(u32 b)
+{
+    return b == MB_IMPASSABLE_WEST || b == MB_IMPASSABLE_NORTHWEST || b == MB_IMPASSABLE_SOUTHWEST
+        || b == MB_IMPASSABLE_WEST_AND_EAST || b == MB_SECRET_BASE_BREAKABLE_DOOR;
+}
+
+static bool32 Old_IsNorthBlocked(u32 b)
+{
+    return b == MB_IMPASSABLE_NORTH || b == MB_IMPASSABLE_NORTHEAST || b == MB_IMPASSABLE_NORTHWEST
+        || b == MB_IMPASSABLE_SOUTH_AND_NORTH;
+}
+
+static bool32 Old_IsSouthBlocked(u32 b)
+{
+    return b == MB_IMPASSABLE_SOUTH || b == MB_IMPASSABLE_SOUTHEAST || b == MB_IMPASSABLE_SOUTHWEST
+        || b == MB_IMPASSABLE_SOUTH_AND_NORTH;
+}
+
+static bool32 Old_IsPacifidlogLog(u32 b)
+{
+    return b == MB_PACIFIDLOG_VERTICAL_LOG_TOP || b == MB_PACIFIDLOG_VERTICAL_LOG_BOTTOM
+        || b == MB_PACIFIDLOG_HORIZONTAL_LOG_LEFT || b == MB_PACIFIDLOG_HORIZONTAL_LOG_RIGHT;
+}
+
+static bool32 Old_IsSurfableFishableWater(u32 b)
+{
+    return b == MB_POND_WATER || b == MB_OCEAN_WATER || b == MB_INTERIOR_DEEP_WATER || b == MB_DEEP_WATER
+        || b == MB_SOOTOPOLIS_DEEP_WATER || b == MB_EASTWARD_CURRENT || b == MB_WESTWARD_CURRENT
+        || b == MB_NORTHWARD_CURRENT || b == MB_SOUTHWARD_CURRENT;
+}
+
+static bool32 Old_IsWarp(u32 b)
+{
+    return MetatileBehavior_IsWarpDoor(b) || MetatileBehavior_IsLadder(b) || MetatileBehavior_IsEscalator(b)
+        || MetatileBehavior_IsNonAnimDoor(b) || MetatileBehavior_IsLavaridgeB1FWarp(b)
+        || MetatileBehavior_IsLavaridge1FWarp(b) || MetatileBehavior_IsAquaHideoutWarp(b)
+        || MetatileBehavior_IsMtPyreHole(b) || MetatileBehavior_IsMossdeepGymWarp(b)
+        || MetatileBehavior_IsUnionRoomWarp(b);
+}
+
+TEST("Metatile behavior predicates match the comparisons they replaced")
+{
+    u32 b;
+
+    for (b = 0; b <= METATILE_ATTR_BEHAVIOR_MASK; b++)
+    {
+        EXPECT_EQ(MetatileBehavior_IsPokeGrass(b), b == MB_TALL_GRASS || b == MB_LONG_GRASS);
+        EXPECT_EQ(MetatileBehavior_IsSandOrDeepSand(b), b == MB_SAND || b == MB_DEEP_SAND);
+        EXPECT_EQ(MetatileBehavior_IsReflective(b), Old_IsReflective(b));
+        EXPECT_EQ(MetatileBehavior_IsForcedMovementTile(b), Old_IsForcedMovementTile(b));
+        EXPECT_EQ(MetatileBehavior_HasRipples(b), b == MB_POND_WATER || b == MB_PUDDLE || b == MB_SOOTOPOLIS_DEEP_WATER);
+        EXPECT_EQ(MetatileBehavior_IsBridgeOverWater(b), Old_IsBridgeOverWater(b));
+        EXPECT_EQ(MetatileBehavior_IsShallowFlowingWater(b), b == MB_SHALLOW_WATER || b == MB_STAIRS_OUTSIDE_ABANDONED_SHIP || b == MB_SHOAL_CAVE_ENTRANCE);
+        EXPECT_EQ(MetatileBehavior_IsEastBlocked(b), Old_IsEastBlocked(b));
+        EXPECT_EQ(MetatileBehavior_IsWestBlocked(b), Old_IsWestBlocked(b));
+        EXPECT_EQ(MetatileBehavior_IsNorthBlocked(b), Old_IsNorthBlocked(b));
+        EXPECT_EQ(MetatileBehavior_IsSouthBlocked(b), Old_IsSouthBlocked(b));
+        EXPECT_EQ(MetatileBehavior_IsPacifidlogLog(b), Old_IsPacifidlogLog(b));
+        EXPECT_EQ(MetatileBehavior_IsSurfableFishableWater(b), Old_IsSurfableFishableWater(b));
+        EXPECT_EQ(MetatileBehavior_IsSeaweed(b), b == MB_SEAWEED || b == MB_SEAWEED_NO_SURFACING);
+        EXPECT_EQ(MetatileBehavior_IsRunningDisallowed(b), b == MB_NO_RUNNING || b == MB_LONG_GRASS || b == MB_HOT_SPRINGS || Old_IsPacifidlogLog(b));
+        EXPECT_EQ(MetatileBehavior_IsSidewaysStairsLeftSideAny(b), b == MB_SIDEWAYS_STAIRS_LEFT_SIDE || b == MB_SIDEWAYS_STAIRS_LEFT_SIDE_TOP || b == MB_SIDEWAYS_STAIRS_LEFT_SIDE_BOTTOM);
+        EXPECT_EQ(MetatileBehavior_IsSidewaysStairsRightSideAny(b), b == MB_SIDEWAYS_STAIRS_RIGHT_SIDE || b == MB_SIDEWAYS_STAIRS_RIGHT_SIDE_TOP || b == MB_SIDEWAYS_STAIRS_RIGHT_SIDE_BOTTOM);
+        EXPECT_EQ(MetatileBehavior_IsLandWildEncounter(b), MetatileBehavior_IsEncounterTile(b) && !MetatileBehavior_IsSurfableWaterOrUnderwater(b));
+        EXPECT_EQ(MetatileBehavior_IsWaterWildEncounter(b), MetatileBehavior_IsEncounterTile(b) && MetatileBehavior_IsSurfableWaterOrUnderwater(b));
+    }
+}
+
+TEST("MetatileBehavior_GetProperties matches the single behavior predicates")
+{
+    u32 b;
+
+    for (b = 0; b <= METATILE_ATTR_BEHAVIOR_MASK; b++)
+    {
+        u32 properties = MetatileBehavior_GetProperties(b);
+        EXPECT_EQ((properties & MB_PROP_TALL_GRASS) != 0, MetatileBehavior_IsTallGrass(b));
+        EXPECT_EQ((properties & MB_PROP_LONG_GRASS) != 0, MetatileBehavior_IsLongGrass(b));
+        EXPECT_EQ((properties & MB_PROP_SHORT_GRASS) != 0, MetatileBehavior_IsShortGrass(b));
+        EXPECT_EQ((properties & MB_PROP_DEEP_SAND) != 0, MetatileBehavior_IsDeepSand(b));
+        EXPECT_EQ((properties & MB_PROP_FOOTPRINTS) != 0, MetatileBehavior_IsFootprints(b));
+        EXPECT_EQ((properties & MB_PROP_ICE) != 0, MetatileBehavior_IsIce(b));
+        EXPECT_EQ((properties & MB_PROP_PUDDLE) != 0, MetatileBehavior_IsPuddle(b));
+        EXPECT_EQ((properties & MB_PROP_HOT_SPRINGS) != 0, MetatileBehavior_IsHotSprings(b));
+        EXPECT_EQ((properties & MB_PROP_WARP) != 0, Old_IsWarp(b));
+    }
+}
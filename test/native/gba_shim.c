@@ -0,0 +1,30 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include "global.h"
+
+/* Stands in for the parts of the GBA and of the game which the sources in
+ * NATIVE_SRCS expect to be there.
+ *
+ * The I/O registers are mapped at the address they have on the GBA, so
+ * code which reads or writes them doesn't crash. Nothing responds to the
+ * writes: the timers don't count, and DMAs don't copy anything.
+ *
+ * The save blocks are normally set up by main.c and load_save.c, which
+ * can't be compiled for the host. */
+
+#define IO_REGS_SIZE 0x1000
+
+static struct SaveBlock2 sSaveBlock2;
+
+struct SaveBlock2 *gSaveBlock2Ptr = &sSaveBlock2;
+
+static void __attribute__((constructor)) MapIORegs(void)
+{
+    void *regs = mmap((void *)REG_BASE, IO_REGS_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    if (regs != (void *)REG_BASE)
+    {
+        perror("mapping the I/O registers failed");
+        exit(EXIT_FAILURE);
+    }
+}
@@ -0,0 +1,222 @@
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "global.h"
+#include "random.h"
+#include "test/test.h"
+
+/* Runs the tests that 'make check-native' compiles for the host.
+ *
+ * There is no emulator to restart, so Test_ExitWithResult longjmps back
+ * to RunTest, and the results are printed to stdout instead of being
+ * sent to Hydra. Messages keep the same ":L<file>:<line>" prefixes as
+ * on the GBA, which are stripped before they're printed. */
+
+struct TestRunnerState gTestRunnerState;
+struct FunctionTestRunnerState *gFunctionTestRunnerState;
+
+extern const struct Test __start_tests[];
+extern const struct Test __stop_tests[];
+
+static jmp_buf sExitTest;
+
+static bool32 PrefixMatch(const char *pattern, const char *string)
+{
+    while (TRUE)
+    {
+        if (!*pattern)
+            return TRUE;
+        if (*pattern != *string)
+            return FALSE;
+        pattern++;
+        string++;
+    }
+}
+
+static void VPrintMessage(const char *fmt, va_list va)
+{
+    // Hydra's message types are a ':' followed by one letter.
+    if (fmt[0] == ':' && fmt[1] != '\0')
+        fmt += 2;
+    vprintf(fmt, va);
+    putchar('\n');
+}
+
+s32 Test_MgbaPrintf(const char *fmt, ...)
+{
+    va_list va;
+    va_start(va, fmt);
+    VPrintMessage(fmt, va);
+    va_end(va);
+    return 0;
+}
+
+void Test_ExpectedResult(enum TestResult result)
+{
+    gTestRunnerState.expectedResult = result;
+}
+
+void Test_ExpectLeaks(bool32 expectLeaks)
+{
+    gTestRunnerState.expectLeaks = expectLeaks;
+}
+
+void Test_ExitWithResult(enum TestResult result, u32 stopLine, const char *fmt, ...)
+{
+    gTestRunnerState.result = result;
+    gTestRunnerState.failedAssumptionsBlockLine = stopLine;
+    if (result != gTestRunnerState.expectedResult)
+    {
+        va_list va;
+        va_start(va, fmt);
+        VPrintMessage(fmt, va);
+        va_end(va);
+    }
+    longjmp(sExitTest, 1);
+}
+
+u32 SourceLine(u32 sourceLineOffset)
+{
+    return gTestRunnerState.test->sourceLine + sourceLineOffset;
+}
+
+u32 SourceLineOffset(u32 sourceLine)
+{
+    if (sourceLine - gTestRunnerState.test->sourceLine > 0xFF)
+        return 0;
+    else
+        return sourceLine - gTestRunnerState.test->sourceLine;
+}
+
+static void FunctionTest_SetUp(void *data)
+{
+    (void)data;
+    gFunctionTestRunnerState = calloc(1, sizeof(*gFunctionTestRunnerState));
+    SeedRng(0);
+}
+
+static void FunctionTest_Run(void *data)
+{
+    void (*function)(void) = data;
+    do
+    {
+        gFunctionTestRunnerState->parameters = 0;
+        function();
+    } while (++gFunctionTestRunnerState->runParameter < gFunctionTestRunnerState->parameters);
+}
+
+static void FunctionTest_TearDown(void *data)
+{
+    (void)data;
+    gTestRunnerState.parameters = gFunctionTestRunnerState->parameters;
+    free(gFunctionTestRunnerState);
+    gFunctionTestRunnerState = NULL;
+}
+
+const struct TestRunner gFunctionTestRunner =
+{
+    .setUp = FunctionTest_SetUp,
+    .run = FunctionTest_Run,
+    .tearDown = FunctionTest_TearDown,
+};
+
+static void Assumptions_Run(void *data)
+{
+    void (*function)(void) = data;
+    function();
+}
+
+const struct TestRunner gAssumptionsRunner =
+{
+    .run = Assumptions_Run,
+};
+
+static void RunTest(const struct Test *test)
+{
+    gTestRunnerState.test = test;
+    gTestRunnerState.result = TEST_RESULT_PASS;
+    gTestRunnerState.expectedResult = TEST_RESULT_PASS;
+    gTestRunnerState.expectLeaks = FALSE;
+    gTestRunnerState.parameters = 0;
+
+    if (test->runner->setUp)
+        test->runner->setUp(test->data);
+    if (setjmp(sExitTest) == 0)
+        test->runner->run(test->data);
+    if (test->runner->tearDown)
+        test->runner->tearDown(test->data);
+}
+
+int main(int argc, char **argv)
+{
+    const char *filter = argc > 1 ? argv[1] : "";
+    const char *skipFilename = NULL;
+    const struct Test *test;
+    u32 passes = 0, skips = 0, knownFails = 0, todos = 0, fails = 0;
+
+    for (test = __start_tests; test < __stop_tests; test++)
+    {
+        if (test->runner != &gAssumptionsRunner && !PrefixMatch(filter, test->name))
+            continue;
+
+        if (test->runner == &gAssumptionsRunner)
+        {
+            RunTest(test);
+            skipFilename = gTestRunnerState.result == TEST_RESULT_PASS ? NULL : test->filename;
+            continue;
+        }
+
+        if (test->filename == skipFilename)
+        {
+            skips++;
+            printf("%s: ASSUMPTIONS_FAIL\n", test->name);
+            continue;
+        }
+
+        RunTest(test);
+
+        switch (gTestRunnerState.result)
+        {
+        case TEST_RESULT_PASS:
+            if (gTestRunnerState.expectedResult != TEST_RESULT_PASS)
+            {
+                fails++;
+                printf("%s:%d: %s: UNEXPECTED PASS\n", test->filename, test->sourceLine, test->name);
+            }
+            else
+            {
+                passes++;
+                printf("%s: PASS\n", test->name);
+            }
+            break;
+        case TEST_RESULT_ASSUMPTION_FAIL:
+            skips++;
+            printf("%s: ASSUMPTION_FAIL\n", test->name);
+            break;
+        case TEST_RESULT_TODO:
+            todos++;
+            printf("%s: TO_DO\n", test->name);
+            break;
+        default:
+            if (gTestRunnerState.result == gTestRunnerState.expectedResult)
+            {
+                knownFails++;
+                printf("%s: KNOWN_FAILING\n", test->name);
+            }
+            else
+            {
+                fails++;
+                printf("%s: FAIL\n", test->name);
+            }
+            break;
+        }
+    }
+
+    printf("\n- Tests PASSED:         %u\n", passes);
+    printf("- Tests SKIPPED:        %u\n", skips);
+    printf("- Tests KNOWN_FAILING:  %u\n", knownFails);
+    printf("- Tests TO_DO:          %u\n", todos);
+    printf("- Tests FAILED:         %u\n", fails);
+    return fails == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
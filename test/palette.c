@@ -0,0 +1,129 @@
+#include "global.h"
+#include "fpmath.h"
+#include "malloc.h"
+#include "palette.h"
+#include "random.h"
+#include "test/test.h"
+#include "constants/rgb.h"
+
+#define TEST_COLORS 64
+
+static void Old_BlendColors(const u16 *src, u16 *dst, u32 count, u32 coeff, u32 blendColor)
+{
+    u32 i;
+    s32 rBlend = GET_R(blendColor);
+    s32 gBlend = GET_G(blendColor);
+    s32 bBlend = GET_B(blendColor);
+
+    for (i = 0; i < count; i++)
+    {
+        s32 r = GET_R(src[i]);
+        s32 g = GET_G(src[i]);
+        s32 b = GET_B(src[i]);
+        dst[i] = RGB(r + (((rBlend - r) * (s32)coeff) >> 4),
+                     g + (((gBlend - g) * (s32)coeff) >> 4),
+                     b + (((bBlend - b) * (s32)coeff) >> 4));
+    }
+}
+
+static u32 Old_Gray(u32 color)
+{
+    return (GET_R(color) * Q_8_8(0.3) + GET_G(color) * Q_8_8(0.59) + GET_B(color) * Q_8_8(0.1133)) >> 8;
+}
+
+static u16 *AllocRandomColors(void)
+{
+    u32 i;
+    u16 *colors = Alloc(TEST_COLORS * sizeof(u16));
+    for (i = 0; i < TEST_COLORS; i++)
+        colors[i] = Random() & 0x7FFF;
+    return colors;
+}
+
+TEST("BlendColors matches per-channel blending")
+{
+    u32 coeff, srcOffset, dstOffset;
+    u16 *src = AllocRandomColors();
+    u16 *oldDst = Alloc(TEST_COLORS * sizeof(u16));
+    u16 *newDst = Alloc(TEST_COLORS * sizeof(u16));
+    u16 blendColor = Random() & 0x7FFF;
+
+    PARAMETRIZE { srcOffset = 0; dstOffset = 0; }
+    PARAMETRIZE { srcOffset = 1; dstOffset = 1; }
+    PARAMETRIZE { srcOffset = 0; dstOffset = 1; }
+    PARAMETRIZE { srcOffset = 1; dstOffset = 0; }
+
+    for (coeff = 0; coeff <= 16; coeff++)
+    {
+        u32 count = TEST_COLORS - 1 - (coeff % 2);
+        Old_BlendColors(&src[srcOffset], &oldDst[dstOffset], count, coeff, blendColor);
+        BlendColors(&src[srcOffset], &newDst[dstOffset], count, coeff, blendColor);
+        EXPECT(memcmp(&oldDst[dstOffset], &newDst[dstOffset], count * sizeof(u16)) == 0);
+    }
+
+    Free(newDst);
+    Free(oldDst);
+    Free(src);
+}
+
+TEST("BlendColors can blend in place")
+{
+    u16 *colors = AllocRandomColors();
+    u16 *expected = Alloc(TEST_COLORS * sizeof(u16));
+
+    Old_BlendColors(colors, expected, TEST_COLORS, 9, RGB_WHITE);
+    BlendColors(colors, colors, TEST_COLORS, 9, RGB_WHITE);
+    EXPECT(memcmp(colors, expected, TEST_COLORS * sizeof(u16)) == 0);
+
+    Free(expected);
+    Free(colors);
+}
+
+TEST("TintPalette_GrayScale and TintPalette_SepiaTone match per-channel tinting")
+{
+    u32 i;
+    u16 *src = AllocRandomColors();
+    u16 *gray = Alloc(TEST_COLORS * sizeof(u16));
+    u16 *sepia = Alloc(TEST_COLORS * sizeof(u16));
+
+    memcpy(gray, src, TEST_COLORS * sizeof(u16));
+    memcpy(sepia, src, TEST_COLORS * sizeof(u16));
+    // Odd counts exercise the trailing color.
+    TintPalette_GrayScale(gray, TEST_COLORS - 1);
+    TintPalette_SepiaTone(sepia, TEST_COLORS - 1);
+
+    for (i = 0; i < TEST_COLORS - 1; i++)
+    {
+        u32 g = Old_Gray(src[i]);
+        u32 r = min((Q_8_8(1.2) * g) >> 8, 31);
+        u32 b = (Q_8_8(0.94) * g) >> 8;
+        EXPECT_EQ(gray[i], RGB(g, g, g));
+        EXPECT_EQ(sepia[i], RGB(r, g, b));
+    }
+    EXPECT_EQ(gray[TEST_COLORS - 1], src[TEST_COLORS - 1]);
+    EXPECT_EQ(sepia[TEST_COLORS - 1], src[TEST_COLORS - 1]);
+
+    Free(sepia);
+    Free(gray);
+    Free(src);
+}
+
+TEST("BlendColors faster than per-channel blending")
+{
+    struct Benchmark oldBlend, newBlend;
+    u16 *src = AllocRandomColors();
+    u16 *dst = Alloc(TEST_COLORS * sizeof(u16));
+
+    BENCHMARK(&oldBlend)
+    {
+        Old_BlendColors(src, dst, TEST_COLORS, 8, RGB_BLACK);
+    }
+    BENCHMARK(&newBlend)
+    {
+        BlendColors(src, dst, TEST_COLORS, 8, RGB_BLACK);
+    }
+
+    EXPECT_FASTER(newBlend, oldBlend);
+    Free(dst);
+    Free(src);
+}
@@ -0,0 +1,89 @@
+#include "global.h"
+#include "pokemon_storage_system.h"
+#include "test/test.h"
+#include "constants/items.h"
+
+TEST("GetBoxMonSummaryAt matches the box Pokémon's data")
+{
+    u32 item = ITEM_ORAN_BERRY;
+    struct BoxMonSummary summary;
+
+    ResetPokemonStorageSystem();
+    CreateBoxMonAt(2, 5, SPECIES_WOBBUFFET, 20, USE_RANDOM_IVS, FALSE, 0, OT_ID_PLAYER_ID, 0);
+    SetBoxMonDataAt(2, 5, MON_DATA_HELD_ITEM, &item);
+
+    summary = GetBoxMonSummaryAt(2, 5);
+    EXPECT_EQ(summary.species, SPECIES_WOBBUFFET);
+    EXPECT_EQ(summary.heldItem, ITEM_ORAN_BERRY);
+    EXPECT_EQ(summary.level, 20);
+    EXPECT_EQ(summary.form, 0);
+    EXPECT_EQ(summary.personality, GetBoxMonDataAt(2, 5, MON_DATA_PERSONALITY));
+    EXPECT_EQ(GetBoxMonSummaryAt(2, 4).species, SPECIES_NONE);
+
+    ZeroBoxMonAt(2, 5);
+    EXPECT_EQ(GetBoxMonSummaryAt(2, 5).species, SPECIES_NONE);
+}
+
+TEST("GetBoxMonSummaryAt sees writes which bypass the storage functions")
+{
+    u32 item = ITEM_ORAN_BERRY;
+    bool32 isEgg = TRUE;
+
+    ResetPokemonStorageSystem();
+    CreateBoxMonAt(0, 0, SPECIES_WOBBUFFET, 20, USE_RANDOM_IVS, FALSE, 0, OT_ID_PLAYER_ID, 0);
+    EXPECT_EQ(GetBoxMonSummaryAt(0, 0).heldItem, ITEM_NONE);
+
+    SetBoxMonData(GetBoxedMonPtr(0, 0), MON_DATA_HELD_ITEM, &item);
+    EXPECT_EQ(GetBoxMonSummaryAt(0, 0).heldItem, ITEM_ORAN_BERRY);
+
+    SetBoxMonData(GetBoxedMonPtr(0, 0), MON_DATA_IS_EGG, &isEgg);
+    EXPECT_EQ(GetBoxMonSummaryAt(0, 0).species, SPECIES_EGG);
+}
+
+TEST("GetBoxMonSummaryAt gives the form of the box Pokémon's species")
+{
+    ASSUME(P_FAMILY_ROTOM == TRUE);
+
+    ResetPokemonStorageSystem();
+    CreateBoxMonAt(0, 0, SPECIES_ROTOM_HEAT, 20, USE_RANDOM_IVS, FALSE, 0, OT_ID_PLAYER_ID, 0);
+
+    EXPECT_EQ(GetBoxMonSummaryAt(0, 0).species, SPECIES_ROTOM_HEAT);
+    EXPECT_NE(GetBoxMonSummaryAt(0, 0).form, 0);
+    EXPECT_EQ(GetBoxMonSummaryAt(0, 0).form, GetFormIdFromFormSpeciesId(SPECIES_ROTOM_HEAT));
+}
+
+TEST("FindStorageMonWithSpecies and FindStorageMonWithHeldItem search every box")
+{
+    u32 item = ITEM_LEFTOVERS;
+    bool32 isEgg = TRUE;
+    u8 boxId = 0, boxPosition = 0;
+
+    ResetPokemonStorageSystem();
+    CreateBoxMonAt(0, 0, SPECIES_WOBBUFFET, 5, USE_RANDOM_IVS, FALSE, 0, OT_ID_PLAYER_ID, 0);
+    CreateBoxMonAt(TOTAL_BOXES_COUNT - 1, IN_BOX_COUNT - 1, SPECIES_WOBBUFFET, 5, USE_RANDOM_IVS, FALSE, 0, OT_ID_PLAYER_ID, 0);
+    CreateBoxMonAt(3, 7, SPECIES_WYNAUT, 5, USE_RANDOM_IVS, FALSE, 0, OT_ID_PLAYER_ID, 0);
+    SetBoxMonDataAt(3, 7, MON_DATA_HELD_ITEM, &item);
+    CreateBoxMonAt(4, 0, SPECIES_WYNAUT, 5, USE_RANDOM_IVS, FALSE, 0, OT_ID_PLAYER_ID, 0);
+    SetBoxMonDataAt(4, 0, MON_DATA_IS_EGG, &isEgg);
+
+    EXPECT(FindStorageMonWithSpecies(SPECIES_WOBBUFFET, &boxId, &boxPosition));
+    EXPECT_EQ(boxId, TOTAL_BOXES_COUNT - 1);
+    EXPECT_EQ(boxPosition, IN_BOX_COUNT - 1);
+    EXPECT(FindStorageMonWithSpecies(SPECIES_WOBBUFFET, &boxId, &boxPosition));
+    EXPECT_EQ(boxId, 0);
+    EXPECT_EQ(boxPosition, 0);
+
+    // Eggs don't give away their species.
+    EXPECT(FindStorageMonWithSpecies(SPECIES_WYNAUT, &boxId, &boxPosition));
+    EXPECT_EQ(boxId, 3);
+    EXPECT_EQ(boxPosition, 7);
+    EXPECT(FindStorageMonWithSpecies(SPECIES_WYNAUT, &boxId, &boxPosition));
+    EXPECT_EQ(boxId, 3);
+    EXPECT_EQ(boxPosition, 7);
+
+    boxId = boxPosition = 0;
+    EXPECT(FindStorageMonWithHeldItem(ITEM_LEFTOVERS, &boxId, &boxPosition));
+    EXPECT_EQ(boxId, 3);
+    EXPECT_EQ(boxPosition, 7);
+    EXPECT(!FindStorageMonWithHeldItem(ITEM_ORAN_BERRY, &boxId, &boxPosition));
+}
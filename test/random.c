@@ -254,6 +254,8 @@ TEST("RandomUniform mul-based faster than mod-based (run-time)")
     EXPECT_EQ(modSum, expectedModSum);
 }
 
+// Natively Random32 is the C implementation too, so there's nothing to compare.
+#if !NATIVE
 TEST("Thumb and C SFC32 implementations produce the same results")
 {
     u32 thumbSum;
@@ -274,4 +276,5 @@ TEST("Thumb and C SFC32 implementations produce the same results")
     }
 
     EXPECT_EQ(thumbSum, cSum);
-}
\ No newline at end of file
+}
+#endif // !NATIVE
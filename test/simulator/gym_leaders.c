@@ -0,0 +1,14 @@
+#include "global.h"
+#include "test/simulator.h"
+#include "constants/opponents.h"
+
+BATTLE_SIMULATION("Roxanne vs Brawly", TRAINER_ROXANNE_1, TRAINER_BRAWLY_1, 1000);
+BATTLE_SIMULATION("Brawly vs Wattson", TRAINER_BRAWLY_1, TRAINER_WATTSON_1, 1000);
+BATTLE_SIMULATION("Wattson vs Flannery", TRAINER_WATTSON_1, TRAINER_FLANNERY_1, 1000);
+BATTLE_SIMULATION("Flannery vs Norman", TRAINER_FLANNERY_1, TRAINER_NORMAN_1, 1000);
+BATTLE_SIMULATION("Norman vs Winona", TRAINER_NORMAN_1, TRAINER_WINONA_1, 1000);
+BATTLE_SIMULATION("Winona vs Juan", TRAINER_WINONA_1, TRAINER_JUAN_1, 1000);
+BATTLE_SIMULATION("Sidney vs Phoebe", TRAINER_SIDNEY, TRAINER_PHOEBE, 1000);
+BATTLE_SIMULATION("Phoebe vs Glacia", TRAINER_PHOEBE, TRAINER_GLACIA, 1000);
+BATTLE_SIMULATION("Glacia vs Drake", TRAINER_GLACIA, TRAINER_DRAKE, 1000);
+BATTLE_SIMULATION("Drake vs Wallace", TRAINER_DRAKE, TRAINER_WALLACE, 1000);
@@ -0,0 +1,197 @@
+/* Battle simulator. Plays AI vs AI battles between trainers and streams
+ * the results to mgba-rom-test-hydra.
+ *
+ * The simulator is linked instead of the battle test runner, so it
+ * provides its own implementation of the TestRunner_Battle_* hooks that
+ * the battle engine calls when TESTING.
+ *
+ * RECORDS
+ * Each record is printed as ":S" followed by space-separated integers.
+ * T <game> <turn> <move x4> <damage x4> <fainted>: One per turn. Moves
+ *    and damage are indexed by battler, fainted is a mask of battlers.
+ * R <game> <outcome> <turns>: One per game. Outcome is a B_OUTCOME_*
+ *    from the player's perspective. */
+#include "global.h"
+#include "battle.h"
+#include "battle_gimmick.h"
+#include "battle_main.h"
+#include "battle_setup.h"
+#include "data.h"
+#include "event_data.h"
+#include "fieldmap.h"
+#include "main.h"
+#include "pokemon.h"
+#include "random.h"
+#include "test/battle.h"
+#include "test/simulator.h"
+#include "constants/abilities.h"
+#include "constants/battle.h"
+
+#define STATE (&gBattleSimulationRunnerState)
+
+EWRAM_DATA struct BattleSimulationRunnerState gBattleSimulationRunnerState;
+
+// The battle engine reads the battle test state (e.g. forceMoveAnim),
+// so it has to exist even though no battle tests are linked.
+struct BattleTestRunnerState *const gBattleTestRunnerState = (void *)sBackupMapData;
+
+static void CB2_BattleSimulation_NextGame(void);
+
+static const struct BattleSimulation *GetBattleSimulation(void)
+{
+    const struct BattleSimulation *simulation = gTestRunnerState.test->data;
+    return simulation;
+}
+
+static void FlushTurn(void)
+{
+    const struct BattleSimulationTurn *turn = &STATE->current;
+
+    Test_MgbaPrintf(":ST %d %d %d %d %d %d %d %d %d %d %d",
+        STATE->game, STATE->turn,
+        turn->moves[0], turn->moves[1], turn->moves[2], turn->moves[3],
+        turn->damage[0], turn->damage[1], turn->damage[2], turn->damage[3],
+        turn->faintedBattlers);
+    memset(&STATE->current, 0, sizeof(STATE->current));
+}
+
+// The turn counter is only incremented once all of the end turn effects
+// have resolved, so the first event of a new turn flushes the last one.
+static void SyncTurn(void)
+{
+    if (STATE->turn == gBattleResults.battleTurnCounter)
+        return;
+
+    FlushTurn();
+    STATE->turn = gBattleResults.battleTurnCounter;
+    if (STATE->turn >= SIMULATION_MAX_TURNS && gBattleOutcome == 0)
+        gBattleOutcome = B_OUTCOME_DREW;
+}
+
+static void StartGame(void)
+{
+    const struct BattleSimulation *simulation = GetBattleSimulation();
+
+    memset(&STATE->current, 0, sizeof(STATE->current));
+    STATE->turn = 0;
+
+    ZeroPlayerPartyMons();
+    ZeroEnemyPartyMons();
+    gPartnerTrainerId = simulation->playerTrainer;
+    CreateNPCTrainerPartyFromTrainer(gPlayerParty, GetTrainerStructFromId(simulation->playerTrainer), TRUE, BATTLE_TYPE_TRAINER);
+    CalculatePlayerPartyCount();
+
+    memset(&gTrainerBattleParameter, 0, sizeof(gTrainerBattleParameter));
+    TRAINER_BATTLE_PARAM.opponentA = simulation->opponentTrainer;
+    gBattleTypeFlags = BATTLE_TYPE_TRAINER;
+    FlagSet(B_FLAG_AI_VS_AI_BATTLE);
+
+    SeedRng(STATE->game);
+    SeedRng2(STATE->game);
+    gMain.savedCallback = CB2_BattleSimulation_NextGame;
+    SetMainCallback2(CB2_InitBattle);
+}
+
+static void BattleSimulation_SetUp(void *data)
+{
+    memset(gBattleTestRunnerState, 0, sizeof(*gBattleTestRunnerState));
+    memset(STATE, 0, sizeof(*STATE));
+    STATE->game = gTestRunnerI;
+}
+
+static void BattleSimulation_Run(void *data)
+{
+    const struct BattleSimulation *simulation = data;
+    if (STATE->game < simulation->games)
+        StartGame();
+}
+
+static void CB2_BattleSimulation_NextGame(void)
+{
+    TestRunner_CheckMemory();
+    STATE->game += gTestRunnerN;
+    if (STATE->game >= GetBattleSimulation()->games)
+        SetMainCallback2(CB2_TestRunner);
+    else
+        StartGame();
+}
+
+static void BattleSimulation_TearDown(void *data)
+{
+    FlagClear(B_FLAG_AI_VS_AI_BATTLE);
+}
+
+static bool32 BattleSimulation_CheckProgress(void *data)
+{
+    // Every turn is progress, SIMULATION_MAX_TURNS bounds each game.
+    bool32 madeProgress = STATE->checkProgressGame != STATE->game
+                       || STATE->checkProgressTurn != gBattleResults.battleTurnCounter;
+    STATE->checkProgressGame = STATE->game;
+    STATE->checkProgressTurn = gBattleResults.battleTurnCounter;
+    return madeProgress;
+}
+
+const struct TestRunner gBattleSimulationRunner =
+{
+    .setUp = BattleSimulation_SetUp,
+    .run = BattleSimulation_Run,
+    .tearDown = BattleSimulation_TearDown,
+    .checkProgress = BattleSimulation_CheckProgress,
+    .runOnAllProcesses = TRUE,
+};
+
+void TestRunner_Battle_RecordHP(u32 battlerId, u32 oldHP, u32 newHP)
+{
+    SyncTurn();
+    if (newHP < oldHP)
+        STATE->current.damage[battlerId] += oldHP - newHP;
+    if (newHP == 0 && oldHP != 0)
+        STATE->current.faintedBattlers |= 1u << battlerId;
+}
+
+void TestRunner_Battle_CheckChosenMove(u32 battlerId, u32 moveId, u32 target)
+{
+    SyncTurn();
+    STATE->current.moves[battlerId] = moveId;
+}
+
+void TestRunner_Battle_AfterLastTurn(void)
+{
+    FlushTurn();
+    Test_MgbaPrintf(":SR %d %d %d", STATE->game, gBattleOutcome, gBattleResults.battleTurnCounter);
+    // Evolutions would only slow down the next game.
+    gLeveledUpInBattle = 0;
+}
+
+u32 TestRunner_Battle_GetChosenGimmick(u32 side, u32 partyIndex)
+{
+    const struct BattleSimulation *simulation = GetBattleSimulation();
+    u32 trainerId = side == B_SIDE_PLAYER ? simulation->playerTrainer : simulation->opponentTrainer;
+    const struct Trainer *trainer = GetTrainerStructFromId(trainerId);
+
+    if (partyIndex >= trainer->partySize)
+        return GIMMICK_NONE;
+    else if (trainer->party[partyIndex].teraType != TYPE_NONE)
+        return GIMMICK_TERA;
+    else if (trainer->party[partyIndex].shouldUseDynamax)
+        return GIMMICK_DYNAMAX;
+    else
+        return GIMMICK_NONE;
+}
+
+u32 TestRunner_Battle_GetForcedAbility(u32 side, u32 partyIndex)
+{
+    return ABILITY_NONE;
+}
+
+void TestRunner_Battle_RecordAbilityPopUp(u32 battlerId, u32 ability) {}
+void TestRunner_Battle_RecordAnimation(u32 animType, u32 animId) {}
+void TestRunner_Battle_RecordExp(u32 battlerId, u32 oldExp, u32 newExp) {}
+void TestRunner_Battle_RecordMessage(const u8 *message) {}
+void TestRunner_Battle_RecordStatus1(u32 battlerId, u32 status1) {}
+void TestRunner_Battle_CheckSwitch(u32 battlerId, u32 partyIndex) {}
+void TestRunner_Battle_CheckAiMoveScores(u32 battlerId) {}
+void TestRunner_Battle_AISetScore(const char *file, u32 line, u32 battlerId, u32 moveIndex, s32 score) {}
+void TestRunner_Battle_AIAdjustScore(const char *file, u32 line, u32 battlerId, u32 moveIndex, s32 score) {}
+void TestRunner_Battle_InvalidNoHPMon(u32 battlerId, u32 partyIndex) {}
+void TestRunner_Battle_CheckBattleRecordActionType(u32 battlerId, u32 recordIndex, u32 actionType) {}
@@ -1,9 +1,11 @@
 #include "global.h"
 #include "main.h"
 #include "malloc.h"
+#include "palette.h"
 #include "random.h"
 #include "sprite.h"
 #include "test/test.h"
+#include "constants/rgb.h"
 
 #define OAM_MATRIX_COUNT 32
 
@@ -121,6 +123,126 @@ TEST("BuildOamBuffer faster with mix of sprites")
     BenchmarkBuildOamBuffer(FALSE);
 }
 
+static void LoadTestSpriteSheet(u16 tag, u32 tileCount, u32 fill)
+{
+    struct SpriteSheet sheet;
+    u8 *data = Alloc(tileCount * TILE_SIZE_4BPP);
+
+    memset(data, fill, tileCount * TILE_SIZE_4BPP);
+    sheet.data = data;
+    sheet.size = tileCount * TILE_SIZE_4BPP;
+    sheet.tag = tag;
+    LoadSpriteSheet(&sheet);
+    Free(data);
+}
+
+TEST("AllocSpriteTiles uses the smallest free span that fits")
+{
+    ResetSpriteData_();
+    LoadTestSpriteSheet(1, 16, 0);
+    LoadTestSpriteSheet(2, 4, 0);
+    LoadTestSpriteSheet(3, 8, 0);
+    LoadTestSpriteSheet(4, 4, 0);
+    FreeSpriteTilesByTag(1);
+    FreeSpriteTilesByTag(3);
+
+    EXPECT_EQ(AllocSpriteTiles(6), 20);
+    EXPECT_EQ(AllocSpriteTiles(2), 26);
+    EXPECT_EQ(AllocSpriteTiles(3), 0);
+    EXPECT_EQ(AllocSpriteTiles(TOTAL_OBJ_TILE_COUNT - 32), 32);
+    EXPECT_EQ(AllocSpriteTiles(14), -1);
+    ResetSpriteData_();
+}
+
+TEST("CompactSpriteTiles moves sheets and the sprites using them")
+{
+    u32 spriteId;
+    struct SpriteTemplate template = gDummySpriteTemplate;
+
+    ResetSpriteData_();
+    LoadTestSpriteSheet(1, 16, 0);
+    LoadTestSpriteSheet(2, 4, 0x22);
+    template.tileTag = 2;
+    spriteId = CreateSprite(&template, 0, 0, 0);
+    FreeSpriteTilesByTag(1);
+    EXPECT_EQ((u32)gSprites[spriteId].oam.tileNum, 16);
+
+    CompactSpriteTiles();
+
+    EXPECT_EQ(GetSpriteTileStartByTag(2), 0);
+    EXPECT_EQ(gSprites[spriteId].sheetTileStart, 0);
+    EXPECT_EQ((u32)gSprites[spriteId].oam.tileNum, 0);
+    EXPECT_EQ(((u8 *)OBJ_VRAM0)[4 * TILE_SIZE_4BPP - 1], 0x22);
+    EXPECT_EQ(AllocSpriteTiles(TOTAL_OBJ_TILE_COUNT - 4), 4);
+    ResetSpriteData_();
+}
+
+static const u16 sTestPaletteA[16] = { RGB_BLACK, RGB_WHITE, RGB_RED };
+static const u16 sTestPaletteB[16] = { RGB_BLACK, RGB_WHITE, RGB_BLUE };
+
+TEST("AcquireSpritePalette keeps palettes until the last release")
+{
+    const struct SpritePalette palette = { sTestPaletteA, 1 };
+    u32 paletteNum;
+
+    FreeAllSpritePalettes();
+    paletteNum = AcquireSpritePalette(&palette, FALSE);
+    EXPECT_EQ(AcquireSpritePalette(&palette, FALSE), paletteNum);
+    ReleaseSpritePalette(1);
+    EXPECT_EQ(IndexOfSpritePaletteTag(1), paletteNum);
+    ReleaseSpritePalette(1);
+    EXPECT_EQ(IndexOfSpritePaletteTag(1), 0xFF);
+
+    // Palettes loaded without a reference count are never released.
+    LoadSpritePalette(&palette);
+    ReleaseSpritePalette(1);
+    EXPECT_EQ(IndexOfSpritePaletteTag(1), paletteNum);
+    FreeAllSpritePalettes();
+}
+
+TEST("AcquireSpritePalette shares slots between identical shared palettes")
+{
+    const struct SpritePalette palettes[] =
+    {
+        { sTestPaletteA, 1 },
+        { sTestPaletteA, 2 },
+        { sTestPaletteB, 3 },
+        { sTestPaletteA, 4 },
+    };
+    u32 paletteNum;
+
+    FreeAllSpritePalettes();
+    paletteNum = AcquireSpritePalette(&palettes[0], TRUE);
+    EXPECT_EQ(AcquireSpritePalette(&palettes[1], TRUE), paletteNum);
+    EXPECT_NE(AcquireSpritePalette(&palettes[2], TRUE), paletteNum);
+    EXPECT_NE(AcquireSpritePalette(&palettes[3], FALSE), paletteNum);
+    EXPECT_EQ(IndexOfSpritePaletteTag(2), paletteNum);
+
+    ReleaseSpritePalette(1);
+    EXPECT_EQ(IndexOfSpritePaletteTag(1), paletteNum);
+    EXPECT_EQ(IndexOfSpritePaletteTag(2), paletteNum);
+    ReleaseSpritePalette(2);
+    EXPECT_EQ(IndexOfSpritePaletteTag(1), 0xFF);
+    EXPECT_EQ(IndexOfSpritePaletteTag(2), 0xFF);
+    FreeAllSpritePalettes();
+}
+
+TEST("AcquireSpriteSheet keeps sheets until the last release")
+{
+    static const u8 tiles[4 * TILE_SIZE_4BPP] = {0};
+    const struct SpriteSheet sheet = { tiles, sizeof(tiles), 1 };
+    u16 tileStart;
+
+    ResetSpriteData_();
+    tileStart = AcquireSpriteSheet(&sheet);
+    EXPECT_EQ(AcquireSpriteSheet(&sheet), tileStart);
+    ReleaseSpriteSheet(1);
+    EXPECT_EQ(GetSpriteTileStartByTag(1), tileStart);
+    ReleaseSpriteSheet(1);
+    EXPECT_EQ(GetSpriteTileStartByTag(1), TAG_NONE);
+    ResetSpriteData_();
+}
+
 // Old implementation.
 
 #define UBFIX
@@ -0,0 +1,37 @@
+#include "global.h"
+#include "string_util.h"
+#include "test/test.h"
+#include "constants/characters.h"
+
+TEST("ConvertIntToDecimalStringN pads the number to n digits")
+{
+    u8 str[8];
+    const u8 rightAligned[] = { CHAR_SPACER, CHAR_4, CHAR_2, EOS };
+
+    ConvertIntToDecimalStringN(str, 42, STR_CONV_MODE_LEFT_ALIGN, 3);
+    EXPECT_EQ(StringCompare(str, COMPOUND_STRING("42")), 0);
+    ConvertIntToDecimalStringN(str, 42, STR_CONV_MODE_RIGHT_ALIGN, 3);
+    EXPECT_EQ(StringCompare(str, rightAligned), 0);
+    ConvertIntToDecimalStringN(str, 42, STR_CONV_MODE_LEADING_ZEROS, 3);
+    EXPECT_EQ(StringCompare(str, COMPOUND_STRING("042")), 0);
+    // The digits which don't fit are shown as one '?'.
+    ConvertIntToDecimalStringN(str, 1234, STR_CONV_MODE_LEFT_ALIGN, 3);
+    EXPECT_EQ(StringCompare(str, COMPOUND_STRING("?34")), 0);
+}
+
+TEST("StringExpandPlaceholders expands the player's name")
+{
+    u8 str[32];
+
+    StringCopy(gSaveBlock2Ptr->playerName, COMPOUND_STRING("MAY"));
+    StringExpandPlaceholders(str, COMPOUND_STRING("Hi, {PLAYER}!"));
+    EXPECT_EQ(StringCompare(str, COMPOUND_STRING("Hi, MAY!")), 0);
+}
+
+TEST("StringCopyUppercase only changes lowercase letters")
+{
+    u8 str[16];
+
+    StringCopyUppercase(str, COMPOUND_STRING("Route 101é"));
+    EXPECT_EQ(StringCompare(str, COMPOUND_STRING("ROUTE 101é")), 0);
+}
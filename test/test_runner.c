@@ -12,6 +12,8 @@
 
 #define TIMEOUT_SECONDS 60
 
+#define SCRIPT_PROFILE_COUNT 256 // See ScriptProfileHash.
+
 void CB2_TestRunner(void);
 
 EWRAM_DATA struct TestRunnerState gTestRunnerState;
@@ -27,6 +29,18 @@ __attribute__((section(".persistent"))) static struct {
     u32 state:1;
 } sCurrentTest = {0};
 
+struct ScriptProfileEntry
+{
+    const void *cmdTable;
+    const u8 *scriptPtr;
+    u32 count;
+};
+
+// Open addressed by scriptPtr, flushed to Hydra after each test and
+// whenever it is three quarters full.
+EWRAM_DATA static struct ScriptProfileEntry sScriptProfile[SCRIPT_PROFILE_COUNT] = {0};
+EWRAM_DATA static u16 sScriptProfileCount = 0;
+
 void TestRunner_Battle(const struct Test *);
 
 static bool32 MgbaOpen_(void);
@@ -88,7 +102,8 @@ static u32 AssignCostToRunner(void)
 {
     u32 minCostProcess;
 
-    if (gTestRunnerState.test->runner == &gAssumptionsRunner)
+    if (gTestRunnerState.test->runner == &gAssumptionsRunner
+     || gTestRunnerState.test->runner->runOnAllProcesses)
         return gTestRunnerI;
 
     minCostProcess = MinCostProcess();
@@ -160,6 +175,55 @@ void TestRunner_CheckMemory(void)
     }
 }
 
+static u32 ScriptProfileHash(const u8 *scriptPtr)
+{
+    return ((uintptr_t)scriptPtr * 2654435761u) >> (32 - 8);
+}
+
+static void FlushScriptProfile(void)
+{
+    u32 i;
+
+    if (sScriptProfileCount == 0)
+        return;
+
+    for (i = 0; i < SCRIPT_PROFILE_COUNT; i++)
+    {
+        if (sScriptProfile[i].count != 0)
+            Test_MgbaPrintf(":C%d %d %d", (uintptr_t)sScriptProfile[i].cmdTable, (uintptr_t)sScriptProfile[i].scriptPtr, sScriptProfile[i].count);
+    }
+    memset(sScriptProfile, 0, sizeof(sScriptProfile));
+    sScriptProfileCount = 0;
+}
+
+// Called with the address of each battle and event script command
+// before it is executed. Commands which wait (e.g. waitmessage) are
+// counted once per frame that they run for.
+void TestRunner_RecordScriptCommand(const void *cmdTable, const u8 *scriptPtr)
+{
+    u32 i;
+
+    if (!gTestRunnerProfileScripts)
+        return;
+
+    i = ScriptProfileHash(scriptPtr);
+    while (sScriptProfile[i].count != 0 && sScriptProfile[i].scriptPtr != scriptPtr)
+        i = (i + 1) % SCRIPT_PROFILE_COUNT;
+
+    if (sScriptProfile[i].count == 0)
+    {
+        if (sScriptProfileCount >= SCRIPT_PROFILE_COUNT * 3 / 4)
+        {
+            FlushScriptProfile();
+            i = ScriptProfileHash(scriptPtr);
+        }
+        sScriptProfile[i].cmdTable = cmdTable;
+        sScriptProfile[i].scriptPtr = scriptPtr;
+        sScriptProfileCount++;
+    }
+    sScriptProfile[i].count++;
+}
+
 void CB2_TestRunner(void)
 {
 top:
@@ -242,6 +306,8 @@ top:
         gTestRunnerState.result = TEST_RESULT_PASS;
         gTestRunnerState.expectedResult = TEST_RESULT_PASS;
         gTestRunnerState.expectLeaks = FALSE;
+        gTestRunnerState.parameters = 0;
+        gTestRunnerState.trials = 0;
         if (gTestRunnerHeadless)
             gTestRunnerState.timeoutSeconds = TIMEOUT_SECONDS;
         else
@@ -267,6 +333,8 @@ top:
     case STATE_RUN_TEST:
         gTestRunnerState.state = STATE_REPORT_RESULT;
         sCurrentTest.state = CURRENT_TEST_STATE_RUN;
+        Test_MgbaPrintf(":B");
+        gTestRunnerState.startVblankCounter = gMain.vblankCounter1;
         SeedRng(0);
         SeedRng2(0);
         if (gTestRunnerState.test->runner->setUp)
@@ -299,6 +367,7 @@ top:
         }
 
         TestRunner_CheckMemory();
+        FlushScriptProfile();
 
         if (gTestRunnerState.test->runner == &gAssumptionsRunner)
         {
@@ -327,6 +396,8 @@ top:
                 color = "";
             }
 
+            Test_MgbaPrintf(":M%d %d %d", gMain.vblankCounter1 - gTestRunnerState.startVblankCounter, gTestRunnerState.parameters, gTestRunnerState.trials);
+
             switch (gTestRunnerState.result)
             {
             case TEST_RESULT_FAIL:
@@ -441,6 +512,7 @@ static void FunctionTest_Run(void *data)
 static void FunctionTest_TearDown(void *data)
 {
     (void)data;
+    gTestRunnerState.parameters = gFunctionTestRunnerState->parameters;
     FREE_AND_SET_NULL(gFunctionTestRunnerState);
 }
 
@@ -161,6 +161,8 @@ static void BattleTest_SetUp(void *data)
     const struct BattleTest *test = data;
     memset(STATE, 0, sizeof(*STATE));
     TestInitConfigData();
+    // Tests which set it don't get to clear it if they fail.
+    VarSet(TESTING_VAR_AI_CYCLES_PER_FRAME, 0);
     InvokeTestFunction(test);
     STATE->parameters = STATE->parametersCount;
     if (STATE->parametersCount == 0 && test->resultsSize > 0)
@@ -1419,6 +1421,8 @@ static void BattleTest_TearDown(void *data)
     // aborted unexpectedly.
     ClearFlagAfterTest();
     TestFreeConfigData();
+    gTestRunnerState.parameters = STATE->parameters;
+    gTestRunnerState.trials = STATE->trials;
     if (STATE->tearDownBattle)
         TearDownBattle();
 }
@@ -0,0 +1,55 @@
+#include "global.h"
+#include "test/test.h"
+#include "wild_encounter.h"
+#include "constants/maps.h"
+
+static void ExpectEncounter(u32 headerId, u32 area, const struct WildPokemonInfo *info, u32 count)
+{
+    u32 i, j, minLevel, maxLevel;
+    const struct WildSpeciesEncounter *encounter;
+
+    if (info == NULL)
+        return;
+
+    for (i = 0; i < count; i++)
+    {
+        u32 species = info->wildPokemon[i].species;
+        minLevel = info->wildPokemon[i].minLevel;
+        maxLevel = info->wildPokemon[i].maxLevel;
+        for (j = 0; j < count; j++)
+        {
+            if (info->wildPokemon[j].species != species)
+                continue;
+            minLevel = min(minLevel, info->wildPokemon[j].minLevel);
+            maxLevel = max(maxLevel, info->wildPokemon[j].maxLevel);
+        }
+
+        EXPECT(WildMonHeaderHasSpecies(headerId, species));
+        encounter = GetWildSpeciesEncounter(headerId, area, species);
+        EXPECT(encounter != NULL);
+        EXPECT_EQ(encounter->minLevel, minLevel);
+        EXPECT_EQ(encounter->maxLevel, maxLevel);
+    }
+}
+
+TEST("Wild species index matches the wild mon headers")
+{
+    u32 headerId;
+
+    for (headerId = 0; gWildMonHeaders[headerId].mapGroup != MAP_GROUP(UNDEFINED); headerId++)
+    {
+        const struct WildPokemonHeader *header = &gWildMonHeaders[headerId];
+        ExpectEncounter(headerId, WILD_AREA_LAND, header->landMonsInfo, LAND_WILD_COUNT);
+        ExpectEncounter(headerId, WILD_AREA_WATER, header->waterMonsInfo, WATER_WILD_COUNT);
+        ExpectEncounter(headerId, WILD_AREA_ROCKS, header->rockSmashMonsInfo, ROCK_WILD_COUNT);
+        ExpectEncounter(headerId, WILD_AREA_FISHING, header->fishingMonsInfo, FISH_WILD_COUNT);
+        ExpectEncounter(headerId, WILD_AREA_HIDDEN, header->hiddenMonsInfo, HIDDEN_WILD_COUNT);
+    }
+}
+
+TEST("Wild species index rejects species which aren't encountered")
+{
+    EXPECT(!WildMonHeaderHasSpecies(0, SPECIES_NONE));
+    EXPECT(!WildMonHeaderHasSpecies(0, SPECIES_MEW));
+    EXPECT(GetWildSpeciesEncounter(0, WILD_AREA_LAND, SPECIES_MEW) == NULL);
+}
@@ -18,12 +18,16 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 // THE SOFTWARE.
 
+#define _POSIX_C_SOURCE 200809L
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <limits.h>
+#include <pthread.h>
+#include <unistd.h>
 
 /* extended.c */
 void ieee754_write_extended (double, uint8_t*);
@@ -106,6 +110,30 @@ void write_bytearray(const char *filename, struct Bytes *bytes)
 	fclose(f);
 }
 
+// Like write_bytearray, but leaves the file (and its timestamp) alone if it
+// already has the same contents, so that make doesn't rebuild its dependents.
+void write_bytearray_if_changed(const char *filename, struct Bytes *bytes)
+{
+	FILE *f = fopen(filename, "rb");
+	if (f)
+	{
+		bool same = false;
+		fseek(f, 0, SEEK_END);
+		if ((unsigned long)ftell(f) == bytes->length)
+		{
+			uint8_t *data = malloc(bytes->length);
+			fseek(f, 0, SEEK_SET);
+			if (fread(data, bytes->length, 1, f) == 1)
+				same = memcmp(data, bytes->data, bytes->length) == 0;
+			free(data);
+		}
+		fclose(f);
+		if (same)
+			return;
+	}
+	write_bytearray(filename, bytes);
+}
+
 void free_bytearray(struct Bytes *bytes)
 {
 	free(bytes->data);
@@ -482,6 +510,21 @@ int get_delta_index(uint8_t sample, uint8_t prev_sample)
 	return best_index;
 }
 
+// get_delta_index only depends on the two samples, so it is cheaper to
+// search every pair once up front than to search for every sample.
+uint8_t gDeltaIndexLUT[256][256];
+
+void init_delta_index_lut(void)
+{
+	for (int prev_sample = 0; prev_sample < 256; prev_sample++)
+	{
+		for (int sample = 0; sample < 256; sample++)
+		{
+			gDeltaIndexLUT[prev_sample][sample] = get_delta_index(sample, prev_sample);
+		}
+	}
+}
+
 struct Bytes *delta_compress(struct Bytes *pcm)
 {
 	struct Bytes *delta = malloc(sizeof(struct Bytes));
@@ -522,7 +565,7 @@ struct Bytes *delta_compress(struct Bytes *pcm)
 		{
 			break;
 		}
-		delta_index = get_delta_index(pcm->data[i++], base);
+		delta_index = gDeltaIndexLUT[base][pcm->data[i++]];
 		base += gDeltaEncodingTable[delta_index];
 		delta->data[j++] = delta_index;
 
@@ -532,7 +575,7 @@ struct Bytes *delta_compress(struct Bytes *pcm)
 			{
 				break;
 			}
-			delta_index = get_delta_index(pcm->data[i++], base);
+			delta_index = gDeltaIndexLUT[base][pcm->data[i++]];
 			base += gDeltaEncodingTable[delta_index];
 			delta->data[j] = (delta_index << 4);
 
@@ -540,7 +583,7 @@ struct Bytes *delta_compress(struct Bytes *pcm)
 			{
 				break;
 			}
-			delta_index = get_delta_index(pcm->data[i++], base);
+			delta_index = gDeltaIndexLUT[base][pcm->data[i++]];
 			base += gDeltaEncodingTable[delta_index];
 			delta->data[j++] |= delta_index;
 		}
@@ -568,7 +611,7 @@ do { \
 } while (0)
 
 // Reads an .aif file and produces a .pcm file containing an array of 8-bit samples.
-void aif2pcm(const char *aif_filename, const char *pcm_filename, bool compress)
+void aif2pcm(const char *aif_filename, const char *pcm_filename, bool compress, bool only_if_changed)
 {
 	struct Bytes *aif = read_bytearray(aif_filename);
 	AifData aif_data = {0};
@@ -619,7 +662,10 @@ void aif2pcm(const char *aif_filename, const char *pcm_filename, bool compress)
 	STORE_U32_LE(output.data + 8, loop_offset);
 	STORE_U32_LE(output.data + 12, adjusted_num_samples);
 	memcpy(&output.data[header_size], pcm->data, pcm->length);
-	write_bytearray(pcm_filename, &output);
+	if (only_if_changed)
+		write_bytearray_if_changed(pcm_filename, &output);
+	else
+		write_bytearray(pcm_filename, &output);
 
 	free(aif->data);
 	free(aif);
@@ -878,10 +924,137 @@ void pcm2aif(const char *pcm_filename, const char *aif_filename, uint32_t base_n
 	free(aif);
 }
 
+struct BatchJob {
+	char *aif_filename;
+	char *pcm_filename;
+	bool compress;
+};
+
+struct Batch {
+	struct BatchJob *jobs;
+	int num_jobs;
+	int next_job;
+	pthread_mutex_t mutex;
+};
+
+// Reads a manifest with one conversion per line:
+//     aif_file bin_file [--compress]
+// Blank lines and lines starting with '#' are ignored. A manifest_filename
+// of "-" reads the manifest from stdin.
+void read_batch_manifest(const char *manifest_filename, struct Batch *batch)
+{
+	FILE *f = strcmp(manifest_filename, "-") == 0 ? stdin : fopen(manifest_filename, "r");
+	if (!f)
+	{
+		FATAL_ERROR("Failed to open '%s' for reading!\n", manifest_filename);
+	}
+
+	int capacity = 0;
+	char line[1024];
+	int line_num = 0;
+	batch->jobs = NULL;
+	batch->num_jobs = 0;
+	while (fgets(line, sizeof(line), f))
+	{
+		line_num++;
+		char *aif_filename = strtok(line, " \t\r\n");
+		if (!aif_filename || aif_filename[0] == '#')
+			continue;
+		char *pcm_filename = strtok(NULL, " \t\r\n");
+		if (!pcm_filename)
+		{
+			FATAL_ERROR("%s:%d: Missing output file for '%s'!\n", manifest_filename, line_num, aif_filename);
+		}
+		bool compress = false;
+		char *option;
+		while ((option = strtok(NULL, " \t\r\n")))
+		{
+			if (strcmp(option, "--compress") == 0)
+				compress = true;
+			else
+				FATAL_ERROR("%s:%d: Unknown option '%s'!\n", manifest_filename, line_num, option);
+		}
+
+		if (batch->num_jobs == capacity)
+		{
+			capacity = capacity ? capacity * 2 : 256;
+			batch->jobs = realloc(batch->jobs, capacity * sizeof(struct BatchJob));
+		}
+		struct BatchJob *job = &batch->jobs[batch->num_jobs++];
+		job->aif_filename = strdup(aif_filename);
+		job->pcm_filename = strdup(pcm_filename);
+		job->compress = compress;
+	}
+	if (f != stdin)
+		fclose(f);
+}
+
+void *batch_worker(void *data)
+{
+	struct Batch *batch = data;
+	for (;;)
+	{
+		pthread_mutex_lock(&batch->mutex);
+		int i = batch->next_job++;
+		pthread_mutex_unlock(&batch->mutex);
+		if (i >= batch->num_jobs)
+			return NULL;
+		struct BatchJob *job = &batch->jobs[i];
+		aif2pcm(job->aif_filename, job->pcm_filename, job->compress, true);
+	}
+}
+
+// Converts every .aif file in the manifest on 'num_threads' threads.
+// Outputs are only written if their contents change.
+void aif2pcm_batch(const char *manifest_filename, int num_threads)
+{
+	struct Batch batch = {0};
+	read_batch_manifest(manifest_filename, &batch);
+	pthread_mutex_init(&batch.mutex, NULL);
+
+	if (num_threads > batch.num_jobs)
+		num_threads = batch.num_jobs;
+	if (num_threads < 1)
+		num_threads = 1;
+
+	pthread_t *threads = malloc(num_threads * sizeof(pthread_t));
+	for (int i = 0; i < num_threads; i++)
+	{
+		if (pthread_create(&threads[i], NULL, batch_worker, &batch) != 0)
+		{
+			FATAL_ERROR("Failed to create worker thread!\n");
+		}
+	}
+	for (int i = 0; i < num_threads; i++)
+	{
+		pthread_join(threads[i], NULL);
+	}
+	free(threads);
+
+	pthread_mutex_destroy(&batch.mutex);
+	for (int i = 0; i < batch.num_jobs; i++)
+	{
+		free(batch.jobs[i].aif_filename);
+		free(batch.jobs[i].pcm_filename);
+	}
+	free(batch.jobs);
+}
+
+int get_default_num_threads(void)
+{
+#ifdef _SC_NPROCESSORS_ONLN
+	long n = sysconf(_SC_NPROCESSORS_ONLN);
+	if (n > 0)
+		return n;
+#endif
+	return 1;
+}
+
 void usage(void)
 {
 	fprintf(stderr, "Usage: aif2pcm bin_file [aif_file]\n");
 	fprintf(stderr, "       aif2pcm aif_file [bin_file] [--compress]\n");
+	fprintf(stderr, "       aif2pcm --batch manifest_file [-j jobs]\n");
 }
 
 int main(int argc, char **argv)
@@ -892,6 +1065,32 @@ int main(int argc, char **argv)
 		exit(1);
 	}
 
+	init_delta_index_lut();
+
+	if (strcmp(argv[1], "--batch") == 0)
+	{
+		if (argc < 3)
+		{
+			usage();
+			exit(1);
+		}
+		int num_threads = get_default_num_threads();
+		for (int i = 3; i < argc; i++)
+		{
+			if (strcmp(argv[i], "-j") == 0 && i + 1 < argc)
+			{
+				num_threads = atoi(argv[++i]);
+			}
+			else
+			{
+				usage();
+				exit(1);
+			}
+		}
+		aif2pcm_batch(argv[2], num_threads);
+		return 0;
+	}
+
 	char *input_file = argv[1];
 	char *extension = get_file_extension(input_file);
 	char *output_file;
@@ -913,12 +1112,12 @@ int main(int argc, char **argv)
 		if (argc >= 3)
 		{
 			output_file = argv[2];
-			aif2pcm(input_file, output_file, compressed);
+			aif2pcm(input_file, output_file, compressed, false);
 		}
 		else
 		{
 			output_file = new_file_extension(input_file, "bin");
-			aif2pcm(input_file, output_file, compressed);
+			aif2pcm(input_file, output_file, compressed, false);
 			free(output_file);
 		}
 	}
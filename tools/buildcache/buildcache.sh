@@ -0,0 +1,83 @@
+#!/bin/sh
+# Runs a command which converts its inputs into its outputs, and keeps the
+# outputs in a content-addressed cache under $BUILD_CACHE_DIR. If the same
+# command has already been run on inputs with the same contents, e.g. on
+# another branch or in another checkout, the outputs are copied from the
+# cache instead.
+#
+# Usage: buildcache.sh [-i <input>]... [-o <output>]... -- <command> [<arg>]...
+#
+# The cache key is the command line, the command's executable and the
+# contents of the inputs. Commands must not read files other than their
+# inputs and executable, or write files other than their outputs.
+
+set -e
+
+inputs=
+outputs=
+while [ $# -gt 0 ]; do
+    case $1 in
+    -i) inputs="$inputs
+$2"; shift 2 ;;
+    -o) outputs="$outputs
+$2"; shift 2 ;;
+    --) shift; break ;;
+    *) echo "$0: unknown option '$1'" >&2; exit 2 ;;
+    esac
+done
+
+if [ $# -eq 0 ]; then
+    echo "Usage: $0 [-i <input>]... [-o <output>]... -- <command> [<arg>]..." >&2
+    exit 2
+fi
+
+if [ -z "$BUILD_CACHE_DIR" ] || [ -z "$outputs" ]; then
+    exec "$@"
+fi
+
+sha1=$(command -v sha1sum || command -v shasum) || exec "$@"
+tool=$(command -v "$1") || exec "$@"
+[ -f "$tool" ] || tool=
+
+set -f
+IFS='
+'
+for input in $inputs; do
+    # Directories and phony prerequisites can't be hashed.
+    [ -f "$input" ] || exec "$@"
+done
+
+key=$({ printf '%s\n' "$@"; "$sha1" $tool $inputs; } | "$sha1")
+key=${key%% *}
+entry=$BUILD_CACHE_DIR/${key%"${key#??}"}/$key
+
+if [ -d "$entry" ]; then
+    n=0
+    for output in $outputs; do
+        if cmp -s "$entry/$n" "$output"; then
+            touch "$output"
+        else
+            cp "$entry/$n" "$output"
+        fi
+        n=$((n + 1))
+    done
+    exit 0
+fi
+
+"$@"
+
+# Failing to fill the cache doesn't fail the build.
+tmp=$BUILD_CACHE_DIR/tmp.$$
+if mkdir -p "$tmp" "${entry%/*}" 2>/dev/null; then
+    n=0
+    complete=1
+    for output in $outputs; do
+        cp "$output" "$tmp/$n" 2>/dev/null || { complete=0; break; }
+        n=$((n + 1))
+    done
+    # Another build may have added the same entry in the meantime.
+    if [ $complete -eq 1 ] && [ ! -d "$entry" ]; then
+        mv "$tmp" "$entry" 2>/dev/null || true
+    fi
+    rm -rf "$tmp"
+fi
@@ -12,6 +12,9 @@ using std::string; using std::to_string;
 #include <algorithm>
 using std::replace_if;
 
+#include <cstdio>
+#include <vector>
+
 #include <inja.hpp>
 using namespace inja;
 using json = nlohmann::json;
@@ -120,6 +123,77 @@ int main(int argc, char *argv[])
         return str;
     });
 
+    // Groups the mons of a list of wild encounters by species, merging the slots of each
+    // encounter area into a level range. Species are numbered in name order, and each
+    // encounter gets a bitset of the species numbers it contains.
+    env.add_callback("wildSpeciesIndex", 1, [](Arguments& args) {
+        static const std::pair<string, string> areas[] = {
+            { "land_mons", "WILD_AREA_LAND" },
+            { "water_mons", "WILD_AREA_WATER" },
+            { "rock_smash_mons", "WILD_AREA_ROCKS" },
+            { "fishing_mons", "WILD_AREA_FISHING" },
+            { "hidden_mons", "WILD_AREA_HIDDEN" },
+        };
+        const json& encounters = *args.at(0);
+        std::map<string, json> bySpecies;
+
+        for (size_t header = 0; header < encounters.size(); header++) {
+            for (const auto& area : areas) {
+                if (!encounters[header].contains(area.first))
+                    continue;
+
+                std::map<string, std::pair<int, int>> levels;
+                for (const json& mon : encounters[header][area.first]["mons"]) {
+                    string species = mon["species"].get<string>();
+                    if (species == "SPECIES_NONE")
+                        continue;
+                    int minLevel = mon["min_level"].get<int>();
+                    int maxLevel = mon["max_level"].get<int>();
+                    auto it = levels.find(species);
+                    if (it == levels.end()) {
+                        levels[species] = { minLevel, maxLevel };
+                    } else {
+                        it->second.first = std::min(it->second.first, minLevel);
+                        it->second.second = std::max(it->second.second, maxLevel);
+                    }
+                }
+                for (const auto& [species, range] : levels) {
+                    bySpecies[species].push_back({
+                        { "header", header },
+                        { "area", area.second },
+                        { "min_level", range.first },
+                        { "max_level", range.second },
+                    });
+                }
+            }
+        }
+
+        size_t words = std::max<size_t>(1, (bySpecies.size() + 31) / 32);
+        std::vector<std::vector<unsigned long>> bitsets(encounters.size(), std::vector<unsigned long>(words, 0));
+        json species = json::array();
+        size_t first = 0;
+        for (const auto& [name, list] : bySpecies) {
+            size_t id = species.size();
+            for (const json& encounter : list)
+                bitsets[encounter["header"].get<size_t>()][id / 32] |= 1ul << (id % 32);
+            species.push_back({ { "species", name }, { "first", first }, { "encounters", list } });
+            first += list.size();
+        }
+
+        json maps = json::array();
+        for (const auto& bitset : bitsets) {
+            json hexWords = json::array();
+            for (unsigned long word : bitset) {
+                char buffer[16];
+                snprintf(buffer, sizeof(buffer), "0x%08lX", word);
+                hexWords.push_back(buffer);
+            }
+            maps.push_back(hexWords);
+        }
+
+        return json{ { "species", species }, { "maps", maps }, { "words", words } };
+    });
+
     try
     {
         env.write_with_json_file(templateFilepath, jsonfilepath, outputFilepath);
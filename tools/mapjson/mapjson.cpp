@@ -189,6 +189,38 @@ string generate_map_connections_text(Json map_data) {
     return text.str();
 }
 
+// Writes the ids of the events in 'events' sorted by position (y, then x) to 'text'.
+// The game binary searches this index to find the events on a tile. Events on the
+// same tile keep their order, because the first event that matches wins.
+// Returns the label of the index, or NULL if the index couldn't be built because
+// an event's position isn't a number.
+string generate_event_index_text(ostringstream &text, const Json::array &events, string label) {
+    vector<std::pair<unsigned long, unsigned int>> keys;
+
+    if (events.empty())
+        return "NULL";
+
+    for (unsigned int i = 0; i < events.size(); i++) {
+        if (!events[i]["x"].is_number() || !events[i]["y"].is_number())
+            return "NULL";
+        // Matches the key that the game compares, which treats coordinates as u16.
+        unsigned long x = static_cast<unsigned long>(events[i]["x"].int_value()) & 0xFFFF;
+        unsigned long y = static_cast<unsigned long>(events[i]["y"].int_value()) & 0xFFFF;
+        keys.push_back({(y << 16) | x, i});
+    }
+
+    std::stable_sort(keys.begin(), keys.end(), [](const std::pair<unsigned long, unsigned int> &a, const std::pair<unsigned long, unsigned int> &b) {
+        return a.first < b.first;
+    });
+
+    text << label << ":\n\t.byte ";
+    for (unsigned int i = 0; i < keys.size(); i++)
+        text << (i == 0 ? "" : ", ") << keys[i].second;
+    text << "\n\n";
+
+    return label;
+}
+
 string generate_map_events_text(Json map_data) {
     if (map_data.object_items().find("shared_events_map") != map_data.object_items().end())
         return string("\n");
@@ -200,6 +232,7 @@ string generate_map_events_text(Json map_data) {
     text << "@\n@ DO NOT MODIFY THIS FILE! It is auto-generated from data/maps/" << mapName << "/map.json\n@\n\n\t.align 2\n\n";
 
     string objects_label, warps_label, coords_label, bgs_label;
+    string warps_index_label, coords_index_label, bgs_index_label;
 
     if (map_data["object_events"].array_items().size() > 0) {
         objects_label = mapName + "_ObjectEvents";
@@ -325,9 +358,15 @@ string generate_map_events_text(Json map_data) {
         bgs_label = "NULL";
     }
 
-    text << mapName << "_MapEvents::\n"
+    warps_index_label = generate_event_index_text(text, map_data["warp_events"].array_items(), mapName + "_MapWarpsIndex");
+    coords_index_label = generate_event_index_text(text, map_data["coord_events"].array_items(), mapName + "_MapCoordEventsIndex");
+    bgs_index_label = generate_event_index_text(text, map_data["bg_events"].array_items(), mapName + "_MapBGEventsIndex");
+
+    text << "\t.align 2\n"
+         << mapName << "_MapEvents::\n"
          << "\tmap_events " << objects_label << ", " << warps_label << ", "
-         << coords_label << ", " << bgs_label << "\n\n";
+         << coords_label << ", " << bgs_label << ", "
+         << warps_index_label << ", " << coords_index_label << ", " << bgs_index_label << "\n\n";
 
     return text.str();
 }
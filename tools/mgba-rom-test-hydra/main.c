@@ -1,6 +1,10 @@
 /* mgba-rom-test-hydra. Runs multiple mgba-rom-test processes and
  * parses the output to display human-readable progress.
  *
+ * If several ROMs are given (e.g. the shards from 'make check-shards'),
+ * each gets a share of the processes proportional to its number of
+ * tests, and the results of all of them are merged into one summary.
+ *
  * Output lines starting with "GBA Debug: :" are parsed as commands to
  * Hydra, other output lines starting with "GBA Debug: " or with "GBA: "
  * are parsed as output from the current test, and any other lines are
@@ -14,6 +18,29 @@
  * P/K/F/A: Sets the result to the remaining of the line, flushes any
  *    output since the previous P/K/F/A and increment the number of
  *    passes/known fails/assumption fails/fails.
+ * S: Writes the remainder of the line, prefixed by the test name, to the
+ *    records file (if any). Records which start with "R " are the
+ *    results of simulated games and are also summarized at exit.
+ * C: "<command table> <script address> <count>", a count of how many
+ *    times the script command at that address was executed. Summed
+ *    across all the tests and written to the profile (-p) at exit.
+ * B: The current test has started running on this process.
+ * M: "<frames> <parameters> <trials>" of the current test, sent just
+ *    before its result.
+ * E: "<cycles>" measured by the current test's benchmark. Compared
+ *    against the test's baseline in the baselines file (-b) at exit.
+ *
+ * Every result is streamed to the JSON lines file (-J) as soon as it is
+ * received, and all of them are written to the JUnit XML file (-X) at
+ * exit.
+ *
+ * BASELINES
+ * Each line of the baselines file is "<test name>\t<cycles>\t<threshold>",
+ * where a benchmark regresses if it takes more than <threshold> percent
+ * more cycles than <cycles>. "-" cycles means that there is no baseline
+ * yet, which fails like a regression does if the benchmark runs. With -u
+ * the file is rewritten with the measured cycles instead of being
+ * compared against.
  */
 #include <fcntl.h>
 #include <math.h>
@@ -32,21 +59,43 @@
 #endif
 #include <sys/stat.h>
 #include <sys/wait.h>
+#include <time.h>
 #include <unistd.h>
 #include "elf.h"
 
 #define min(a, b) ((a) < (b) ? (a) : (b))
 
 #define MAX_PROCESSES               32 // See also test/test.h
-#define MAX_SUMMARY_TESTS_TO_LIST   50
-#define MAX_TEST_LIST_BUFFER_LENGTH 256
 
 #define ARRAY_COUNT(arr) (sizeof((arr)) / sizeof((arr)[0]))
 
+struct Symbol {
+    const char *name;
+    uint32_t address;
+    size_t size;
+};
+
+struct SymbolTable {
+    struct Symbol *symbols;
+    size_t symbols_n;
+};
+
+struct Elf
+{
+    const char *path;
+    void *image;
+    size_t size;
+    size_t tests_size;
+    struct SymbolTable symbol_table;
+};
+
 struct Runner
 {
     pid_t pid;
     int outfd;
+    const struct Elf *elf;
+    int elf_i; // Patched into gTestRunnerI.
+    int elf_n; // Patched into gTestRunnerN.
     char rom_path[FILENAME_MAX];
     char test_name[256];
     char filename_line[256];
@@ -63,32 +112,104 @@ struct Runner
     int assumptionFails;
     int fails;
     int results;
-    char failed_TestNames[MAX_SUMMARY_TESTS_TO_LIST][MAX_TEST_LIST_BUFFER_LENGTH];
-    char failed_TestFilenameLine[MAX_SUMMARY_TESTS_TO_LIST][MAX_TEST_LIST_BUFFER_LENGTH];
-    char knownFailingPassed_TestNames[MAX_SUMMARY_TESTS_TO_LIST][MAX_TEST_LIST_BUFFER_LENGTH];
-    char knownFailingPassed_FilenameLine[MAX_SUMMARY_TESTS_TO_LIST][MAX_TEST_LIST_BUFFER_LENGTH];
-    char assumeFailed_TestNames[MAX_SUMMARY_TESTS_TO_LIST][MAX_TEST_LIST_BUFFER_LENGTH];
-    char assumeFailed_FilenameLine[MAX_SUMMARY_TESTS_TO_LIST][MAX_TEST_LIST_BUFFER_LENGTH];
+    struct timespec test_start;
+    unsigned frames;
+    unsigned parameters;
+    unsigned trials;
 };
 
-struct Symbol {
-    const char *name;
+enum ResultKind
+{
+    RESULT_PASS,
+    RESULT_KNOWN_FAIL,
+    RESULT_KNOWN_FAIL_PASSING,
+    RESULT_TODO,
+    RESULT_ASSUMPTION_FAIL,
+    RESULT_FAIL,
+};
+
+struct TestResult
+{
+    enum ResultKind kind;
+    char *name;
+    char *location; // "<filename>:<line>".
+    char *status; // e.g. "PASS" or "TIMEOUT".
+    char *output;
+    const struct Elf *elf;
+    double seconds;
+    unsigned frames;
+    unsigned parameters;
+    unsigned trials;
+};
+
+struct Simulation
+{
+    char name[256];
+    int games;
+    int wins;
+    int losses;
+};
+
+// Percent, for benchmarks which aren't in the baselines file yet.
+#define DEFAULT_BENCHMARK_THRESHOLD 5
+
+struct Benchmark
+{
+    char name[256];
+    long baseline; // -1 if there's no baseline.
+    unsigned threshold;
+    long cycles; // -1 if the benchmark didn't run.
+};
+
+struct ScriptCommandCount
+{
+    uint32_t cmd_table;
     uint32_t address;
-    size_t size;
+    uint64_t count;
 };
 
-struct SymbolTable {
-    struct Symbol *symbols;
-    size_t symbols_n;
+struct Label
+{
+    const char *name;
+    uint32_t address;
+    uint64_t count;
 };
 
 static unsigned nrunners = 0;
 static unsigned runners_digits = 0;
 static struct Runner *runners = NULL;
 
+static FILE *records = NULL;
+static FILE *json_results = NULL;
+static const char *junit_path = NULL;
+static size_t test_results_n = 0;
+static size_t test_results_c = 0;
+static struct TestResult *test_results = NULL;
+static size_t simulations_n = 0;
+static size_t simulations_c = 0;
+static struct Simulation *simulations = NULL;
+static const char *baselines_path = NULL;
+static bool update_baselines = false;
+static size_t benchmarks_n = 0;
+static size_t benchmarks_c = 0;
+static struct Benchmark *benchmarks = NULL;
+
 // TODO: Build the symbol table on demand.
+// The symbol table of the ELF whose output is being printed.
 static struct SymbolTable symbol_table = { NULL, 0 };
 
+static size_t elfs_n = 0;
+static struct Elf *elfs = NULL;
+
+// Script addresses are the same in every ELF because the game's objects
+// are linked before the tests, so the profile uses the first ELF.
+static const void *elf_image = NULL;
+
+static const char *profile_path = NULL;
+static size_t script_counts_n = 0;
+static size_t script_counts_c = 0;
+static struct ScriptCommandCount *script_counts = NULL;
+
 static const struct Symbol *lookup_address(uint32_t address)
 {
     int lo = 0, hi = symbol_table.symbols_n;
@@ -192,8 +313,510 @@ static void fprint_buffer(FILE *f, const char *buffer, size_t size)
     }
 }
 
+// Like 'fprint_buffer', but into a new string so that the symbols are
+// resolved while the runner's symbol table is current.
+static char *sprint_buffer(const char *buffer, size_t size)
+{
+    char *string;
+    size_t string_size;
+    FILE *f = open_memstream(&string, &string_size);
+    if (!f)
+    {
+        perror("open_memstream failed");
+        exit(2);
+    }
+    fprint_buffer(f, buffer, size);
+    if (fclose(f) == EOF)
+    {
+        perror("fclose memstream failed");
+        exit(2);
+    }
+    return string;
+}
+
+// Copies 'size' bytes of 'buffer' without the color escape sequences
+// or the trailing newline.
+static char *strip_colors(const char *buffer, size_t size)
+{
+    char *string = malloc(size + 1);
+    if (!string)
+    {
+        perror("malloc strip_colors failed");
+        exit(2);
+    }
+    size_t n = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        if (buffer[i] == '\e')
+        {
+            while (i < size && buffer[i] != 'm')
+                i++;
+        }
+        else
+        {
+            string[n++] = buffer[i];
+        }
+    }
+    while (n > 0 && string[n - 1] == '\n')
+        n--;
+    string[n] = '\0';
+    return string;
+}
+
+static void fprint_json_string(FILE *f, const char *string)
+{
+    fputc('"', f);
+    for (; *string; string++)
+    {
+        if (*string == '"' || *string == '\\')
+            fprintf(f, "\\%c", *string);
+        else if (*string == '\n')
+            fputs("\\n", f);
+        else if ((unsigned char)*string < 0x20)
+            fprintf(f, "\\u%04x", *string);
+        else
+            fputc(*string, f);
+    }
+    fputc('"', f);
+}
+
+// Writes at most the first n bytes of string.
+static void fprint_xml_string_n(FILE *f, const char *string, size_t n)
+{
+    const char *end = string + n;
+    for (; string < end && *string; string++)
+    {
+        switch (*string)
+        {
+        case '&': fputs("&amp;", f); break;
+        case '<': fputs("&lt;", f); break;
+        case '>': fputs("&gt;", f); break;
+        case '"': fputs("&quot;", f); break;
+        case '\e': // Not allowed in XML 1.0, skip the whole escape.
+            while (string + 1 < end && string[1] && *string != 'm')
+                string++;
+            break;
+        default:
+            if ((unsigned char)*string >= 0x20 || *string == '\n' || *string == '\t')
+                fputc(*string, f);
+            break;
+        }
+    }
+}
+
+static void fprint_xml_string(FILE *f, const char *string)
+{
+    fprint_xml_string_n(f, string, strlen(string));
+}
+
+static void write_json_result(const struct TestResult *result)
+{
+    fprintf(json_results, "{\"name\":");
+    fprint_json_string(json_results, result->name);
+    fprintf(json_results, ",\"location\":");
+    fprint_json_string(json_results, result->location);
+    fprintf(json_results, ",\"elf\":");
+    fprint_json_string(json_results, result->elf->path);
+    fprintf(json_results, ",\"result\":");
+    fprint_json_string(json_results, result->status);
+    fprintf(json_results, ",\"seconds\":%.3f,\"frames\":%u,\"parameters\":%u,\"trials\":%u",
+            result->seconds, result->frames, result->parameters, result->trials);
+    if (result->output[0])
+    {
+        fprintf(json_results, ",\"output\":");
+        fprint_json_string(json_results, result->output);
+    }
+    fprintf(json_results, "}\n");
+    fflush(json_results);
+}
+
+static void add_result(struct Runner *runner, enum ResultKind kind, const char *status, size_t n)
+{
+    if (test_results_n == test_results_c)
+    {
+        test_results_c = test_results_c ? test_results_c * 2 : 1024;
+        test_results = realloc(test_results, test_results_c * sizeof(*test_results));
+        if (!test_results)
+        {
+            perror("realloc test_results failed");
+            exit(2);
+        }
+    }
+
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    struct TestResult *result = &test_results[test_results_n++];
+    result->kind = kind;
+    result->name = strdup(runner->test_name);
+    result->location = sprint_buffer(runner->filename_line, strlen(runner->filename_line));
+    result->status = strip_colors(status, n);
+    result->output = sprint_buffer(runner->output_buffer, runner->output_buffer_size);
+    result->elf = runner->elf;
+    result->seconds = (now.tv_sec - runner->test_start.tv_sec) + (now.tv_nsec - runner->test_start.tv_nsec) / 1e9;
+    result->frames = runner->frames;
+    result->parameters = runner->parameters;
+    result->trials = runner->trials;
+    if (!result->name || !result->location)
+    {
+        perror("strdup result failed");
+        exit(2);
+    }
+
+    if (json_results)
+        write_json_result(result);
+
+    // In case the next test doesn't send 'B'.
+    runner->test_start = now;
+    runner->frames = runner->parameters = runner->trials = 0;
+}
+
+static void print_results(enum ResultKind kind, const char *color)
+{
+    for (size_t i = 0; i < test_results_n; i++)
+    {
+        if (test_results[i].kind == kind)
+            fprintf(stdout, "  - %s%s\e[0m - %s.\n", color, test_results[i].location, test_results[i].name);
+    }
+}
+
+// Tests are grouped into one test suite per ELF.
+static void write_junit_results(void)
+{
+    FILE *f = fopen(junit_path, "w");
+    if (!f)
+    {
+        perror("fopen junit failed");
+        exit(2);
+    }
+
+    fprintf(f, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<testsuites>\n");
+    for (size_t i = 0; i < elfs_n; i++)
+    {
+        int tests = 0, failures = 0, skipped = 0;
+        double seconds = 0;
+        for (size_t j = 0; j < test_results_n; j++)
+        {
+            if (test_results[j].elf != &elfs[i])
+                continue;
+            tests++;
+            seconds += test_results[j].seconds;
+            if (test_results[j].kind == RESULT_FAIL || test_results[j].kind == RESULT_KNOWN_FAIL_PASSING)
+                failures++;
+            else if (test_results[j].kind != RESULT_PASS)
+                skipped++;
+        }
+
+        fprintf(f, "  <testsuite name=\"");
+        fprint_xml_string(f, elfs[i].path);
+        fprintf(f, "\" tests=\"%d\" failures=\"%d\" skipped=\"%d\" time=\"%.3f\">\n", tests, failures, skipped, seconds);
+        for (size_t j = 0; j < test_results_n; j++)
+        {
+            const struct TestResult *result = &test_results[j];
+            if (result->elf != &elfs[i])
+                continue;
+
+            const char *colon = strrchr(result->location, ':');
+            size_t classname_n = colon ? (size_t)(colon - result->location) : strlen(result->location);
+            fprintf(f, "    <testcase classname=\"");
+            fprint_xml_string_n(f, result->location, classname_n);
+            fprintf(f, "\" name=\"");
+            fprint_xml_string(f, result->name);
+            fprintf(f, "\" time=\"%.3f\">\n", result->seconds);
+            fprintf(f, "      <properties>\n");
+            fprintf(f, "        <property name=\"frames\" value=\"%u\"/>\n", result->frames);
+            fprintf(f, "        <property name=\"parameters\" value=\"%u\"/>\n", result->parameters);
+            fprintf(f, "        <property name=\"trials\" value=\"%u\"/>\n", result->trials);
+            fprintf(f, "      </properties>\n");
+            if (result->kind == RESULT_FAIL || result->kind == RESULT_KNOWN_FAIL_PASSING)
+            {
+                fprintf(f, "      <failure message=\"");
+                fprint_xml_string(f, result->status);
+                fprintf(f, "\">");
+                fprint_xml_string(f, result->location);
+                fprintf(f, "</failure>\n");
+            }
+            else if (result->kind != RESULT_PASS)
+            {
+                fprintf(f, "      <skipped message=\"");
+                fprint_xml_string(f, result->status);
+                fprintf(f, "\"/>\n");
+            }
+            if (result->output[0])
+            {
+                fprintf(f, "      <system-out>");
+                fprint_xml_string(f, result->output);
+                fprintf(f, "</system-out>\n");
+            }
+            fprintf(f, "    </testcase>\n");
+        }
+        fprintf(f, "  </testsuite>\n");
+    }
+    fprintf(f, "</testsuites>\n");
+
+    if (fclose(f) == EOF)
+    {
+        perror("fclose junit failed");
+        exit(2);
+    }
+}
+
+static struct Simulation *lookup_simulation(const char *name)
+{
+    for (size_t i = 0; i < simulations_n; i++)
+    {
+        if (strcmp(simulations[i].name, name) == 0)
+            return &simulations[i];
+    }
+
+    if (simulations_n == simulations_c)
+    {
+        simulations_c = simulations_c ? simulations_c * 2 : 16;
+        simulations = realloc(simulations, simulations_c * sizeof(*simulations));
+        if (!simulations)
+        {
+            perror("realloc simulations failed");
+            exit(2);
+        }
+    }
+    struct Simulation *simulation = &simulations[simulations_n++];
+    memset(simulation, 0, sizeof(*simulation));
+    strcpy(simulation->name, name);
+    return simulation;
+}
+
+static struct Benchmark *lookup_benchmark(const char *name)
+{
+    for (size_t i = 0; i < benchmarks_n; i++)
+    {
+        if (strcmp(benchmarks[i].name, name) == 0)
+            return &benchmarks[i];
+    }
+
+    if (benchmarks_n == benchmarks_c)
+    {
+        benchmarks_c = benchmarks_c ? benchmarks_c * 2 : 16;
+        benchmarks = realloc(benchmarks, benchmarks_c * sizeof(*benchmarks));
+        if (!benchmarks)
+        {
+            perror("realloc benchmarks failed");
+            exit(2);
+        }
+    }
+    struct Benchmark *benchmark = &benchmarks[benchmarks_n++];
+    if (strlen(name) >= sizeof(benchmark->name))
+    {
+        fprintf(stderr, "benchmark name too long: '%s'\n", name);
+        exit(2);
+    }
+    strcpy(benchmark->name, name);
+    benchmark->baseline = -1;
+    benchmark->threshold = DEFAULT_BENCHMARK_THRESHOLD;
+    benchmark->cycles = -1;
+    return benchmark;
+}
+
+static void load_baselines(void)
+{
+    FILE *f = fopen(baselines_path, "r");
+    if (!f)
+    {
+        // The first 'make bench BENCH_UPDATE=1' creates the file.
+        if (update_baselines)
+            return;
+        perror("fopen baselines failed");
+        exit(2);
+    }
+
+    char line[512];
+    int lineno = 0;
+    while (fgets(line, sizeof(line), f))
+    {
+        lineno++;
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[0] == '#' || line[0] == '\0')
+            continue;
+
+        char *cycles = strchr(line, '\t');
+        char *threshold = cycles ? strchr(cycles + 1, '\t') : NULL;
+        if (!threshold)
+        {
+            fprintf(stderr, "%s:%d: expected '<test name>\\t<cycles>\\t<threshold>'\n", baselines_path, lineno);
+            exit(2);
+        }
+        *cycles++ = '\0';
+        *threshold++ = '\0';
+
+        struct Benchmark *benchmark = lookup_benchmark(line);
+        if (strcmp(cycles, "-") != 0 && sscanf(cycles, "%ld", &benchmark->baseline) != 1)
+        {
+            fprintf(stderr, "%s:%d: invalid cycles '%s'\n", baselines_path, lineno, cycles);
+            exit(2);
+        }
+        if (sscanf(threshold, "%u", &benchmark->threshold) != 1)
+        {
+            fprintf(stderr, "%s:%d: invalid threshold '%s'\n", baselines_path, lineno, threshold);
+            exit(2);
+        }
+    }
+
+    if (fclose(f) == EOF)
+    {
+        perror("fclose baselines failed");
+        exit(2);
+    }
+}
+
+static int compare_benchmarks_by_name(const void *a, const void *b)
+{
+    const struct Benchmark *ba = a, *bb = b;
+    return strcmp(ba->name, bb->name);
+}
+
+// Benchmarks which didn't run (e.g. because of TESTS) keep their old
+// baselines.
+static void write_baselines(void)
+{
+    FILE *f = fopen(baselines_path, "w");
+    if (!f)
+    {
+        perror("fopen baselines failed");
+        exit(2);
+    }
+
+    fprintf(f, "# Written by 'make bench BENCH_UPDATE=1'. Each line is:\n");
+    fprintf(f, "# <test name>\t<cycles>\t<percent slower which counts as a regression>\n");
+    for (size_t i = 0; i < benchmarks_n; i++)
+    {
+        const struct Benchmark *benchmark = &benchmarks[i];
+        long cycles = benchmark->cycles >= 0 ? benchmark->cycles : benchmark->baseline;
+        if (cycles >= 0)
+            fprintf(f, "%s\t%ld\t%u\n", benchmark->name, cycles, benchmark->threshold);
+        else
+            fprintf(f, "%s\t-\t%u\n", benchmark->name, benchmark->threshold);
+    }
+
+    if (fclose(f) == EOF)
+    {
+        perror("fclose baselines failed");
+        exit(2);
+    }
+}
+
+static void handle_benchmark(struct Runner *runner, const char *record)
+{
+    long cycles;
+    if (baselines_path && sscanf(record, "%ld", &cycles) == 1)
+        lookup_benchmark(runner->test_name)->cycles = cycles;
+}
+
+// Returns the number of benchmarks which regressed, and sets *missing to
+// the number which ran without a baseline.
+static int print_benchmarks(int *missing)
+{
+    int regressions = 0;
+    *missing = 0;
+    fprintf(stdout, "\n  Benchmarks:\n");
+    for (size_t i = 0; i < benchmarks_n; i++)
+    {
+        const struct Benchmark *benchmark = &benchmarks[i];
+        if (benchmark->cycles < 0)
+            continue;
+
+        if (benchmark->baseline < 0)
+        {
+            fprintf(stdout, "  - %s: \e[31m%ld cycles\e[0m (no baseline)\n", benchmark->name, benchmark->cycles);
+            (*missing)++;
+            continue;
+        }
+
+        double change = 100.0 * (benchmark->cycles - benchmark->baseline) / (benchmark->baseline ? benchmark->baseline : 1);
+        const char *color = "";
+        if (change > benchmark->threshold)
+        {
+            color = "\e[31m";
+            regressions++;
+        }
+        else if (change < -(double)benchmark->threshold)
+        {
+            color = "\e[32m";
+        }
+        fprintf(stdout, "  - %s: %s%ld cycles\e[0m (baseline %ld, %+.1f%%, threshold %u%%)\n",
+                benchmark->name, color, benchmark->cycles, benchmark->baseline, change, benchmark->threshold);
+    }
+    return regressions;
+}
+
+// Game results are "R <game> <outcome> <turns>", where the outcome is
+// from the player's perspective (1 = won, 2 = lost, anything else is a
+// draw).
+static void handle_record(struct Runner *runner, const char *record, size_t n)
+{
+    int game, outcome, turns;
+
+    if (records)
+    {
+        fprintf(records, "%s\t", runner->test_name);
+        fwrite(record, 1, n, records);
+    }
+
+    if (sscanf(record, "R %d %d %d", &game, &outcome, &turns) == 3)
+    {
+        struct Simulation *simulation = lookup_simulation(runner->test_name);
+        simulation->games++;
+        if (outcome == 1)
+            simulation->wins++;
+        else if (outcome == 2)
+            simulation->losses++;
+    }
+}
+
+// Open addressed by address, grown when it is half full.
+static void add_script_command_count(uint32_t cmd_table, uint32_t address, uint64_t count)
+{
+    if (script_counts_n * 2 >= script_counts_c)
+    {
+        size_t old_c = script_counts_c;
+        struct ScriptCommandCount *old = script_counts;
+        script_counts_c = old_c ? old_c * 2 : 4096;
+        script_counts = calloc(script_counts_c, sizeof(*script_counts));
+        if (!script_counts)
+        {
+            perror("calloc script_counts failed");
+            exit(2);
+        }
+        script_counts_n = 0;
+        for (size_t i = 0; i < old_c; i++)
+        {
+            if (old[i].count != 0)
+                add_script_command_count(old[i].cmd_table, old[i].address, old[i].count);
+        }
+        free(old);
+    }
+
+    size_t i = (address * 2654435761u) & (script_counts_c - 1);
+    while (script_counts[i].count != 0 && script_counts[i].address != address)
+        i = (i + 1) & (script_counts_c - 1);
+    if (script_counts[i].count == 0)
+    {
+        script_counts[i].cmd_table = cmd_table;
+        script_counts[i].address = address;
+        script_counts_n++;
+    }
+    script_counts[i].count += count;
+}
+
+static void handle_script_profile(const char *record)
+{
+    unsigned cmd_table, address, count;
+    if (profile_path && sscanf(record, "%u %u %u", &cmd_table, &address, &count) == 3)
+        add_script_command_count(cmd_table, address, count);
+}
+
 static void handle_read(int i, struct Runner *runner)
 {
+    enum ResultKind kind;
+    symbol_table = runner->elf->symbol_table;
     char *sol = runner->input_buffer;
     char *eol;
     size_t consumed = 0;
@@ -238,41 +861,56 @@ static void handle_read(int i, struct Runner *runner)
                     runner->filename_line[eol - soc - 1] = '\0';
                     break;
 
-                case 'P':
-                    runner->passes++;
-                    goto add_to_results;
-                case 'K':
-                    runner->knownFails++;
-                    goto add_to_results;
-                case 'U':
-                    if (runner->knownFailsPassing < MAX_SUMMARY_TESTS_TO_LIST)
-                    {
-                        strcpy(runner->knownFailingPassed_TestNames[runner->knownFailsPassing], runner->test_name);
-                        strcpy(runner->knownFailingPassed_FilenameLine[runner->knownFailsPassing], runner->filename_line);
-                    }
-                    runner->knownFailsPassing++;
-                    goto add_to_results;
+                case 'S':
+                    soc += 2;
+                    handle_record(runner, soc, eol - soc);
+                    break;
+
+                case 'C':
+                    soc += 2;
+                    handle_script_profile(soc);
+                    break;
+
+                case 'E':
+                    soc += 2;
+                    handle_benchmark(runner, soc);
+                    break;
+
+                case 'B':
+                    clock_gettime(CLOCK_MONOTONIC, &runner->test_start);
+                    break;
+
+                case 'M':
+                    sscanf(soc + 2, "%u %u %u", &runner->frames, &runner->parameters, &runner->trials);
+                    break;
+
+                case 'P':
+                    runner->passes++;
+                    kind = RESULT_PASS;
+                    goto add_to_results;
+                case 'K':
+                    runner->knownFails++;
+                    kind = RESULT_KNOWN_FAIL;
+                    goto add_to_results;
+                case 'U':
+                    runner->knownFailsPassing++;
+                    kind = RESULT_KNOWN_FAIL_PASSING;
+                    goto add_to_results;
                 case 'T':
                     runner->todos++;
+                    kind = RESULT_TODO;
                     goto add_to_results;
                 case 'A':
-                    if (runner->assumptionFails < MAX_SUMMARY_TESTS_TO_LIST)
-                    {
-                        strcpy(runner->assumeFailed_TestNames[runner->assumptionFails], runner->test_name);
-                        strcpy(runner->assumeFailed_FilenameLine[runner->assumptionFails], runner->filename_line);
-                    }
                     runner->assumptionFails++;
+                    kind = RESULT_ASSUMPTION_FAIL;
                     goto add_to_results;
                 case 'F':
-                    if (runner->fails < MAX_SUMMARY_TESTS_TO_LIST)
-                    {
-                        strcpy(runner->failed_TestNames[runner->fails], runner->test_name);
-                        strcpy(runner->failed_TestFilenameLine[runner->fails], runner->filename_line);
-                    }
                     runner->fails++;
+                    kind = RESULT_FAIL;
 add_to_results:
                     runner->results++;
                     soc += 2;
+                    add_result(runner, kind, soc, eol - soc);
                     fprintf(stdout, "[%0*d] %s: ", runners_digits, i, runner->test_name);
                     fwrite(soc, 1, eol - soc, stdout);
                     fprint_buffer(stdout, runner->output_buffer, runner->output_buffer_size);
@@ -321,114 +959,571 @@ buffer_output:
         runner->input_buffer = realloc(runner->input_buffer, runner->input_buffer_capacity);
         if (!runner->input_buffer)
         {
-            perror("realloc input_buffer failed");
+            perror("realloc input_buffer failed");
+            exit(2);
+        }
+    }
+}
+
+static void unlink_roms(void)
+{
+    for (int i = 0; i < nrunners; i++)
+    {
+        if (runners[i].rom_path[0])
+        {
+            if (unlink(runners[i].rom_path) == -1)
+            {
+                int fd;
+                if ((fd = open(runners[i].rom_path, O_RDONLY)) != -1)
+                    perror("unlink rom_path failed");
+            }
+        }
+    }
+}
+
+static void exit2(int _)
+{
+    exit(2);
+}
+
+static int compare_addresses(const void *a, const void *b)
+{
+    const struct Symbol *sa = a, *sb = b;
+    if (sa->address < sb->address)
+        return -1;
+    else if (sa->address == sb->address)
+        return 0;
+    else
+        return 1;
+}
+
+static void build_symbol_table(void *elf)
+{
+    if (memcmp(elf, ELFMAG, 4) != 0)
+        goto error;
+
+    size_t symbol_table_symbols_c = 1024;
+    symbol_table.symbols = malloc(symbol_table_symbols_c * sizeof(*symbol_table.symbols));
+    if (symbol_table.symbols == NULL)
+        goto error;
+
+    const Elf32_Ehdr *ehdr = (Elf32_Ehdr *)elf;
+    const Elf32_Shdr *shdrs = (Elf32_Shdr *)(elf + ehdr->e_shoff);
+
+    if (ehdr->e_shstrndx == SHN_UNDEF)
+        goto error;
+    const Elf32_Shdr *shdr_shstr = &shdrs[ehdr->e_shstrndx];
+    const char *shstr = (const char *)(elf + shdr_shstr->sh_offset);
+    const Elf32_Shdr *shdr_symtab = NULL;
+    const Elf32_Shdr *shdr_strtab = NULL;
+    for (int i = 0; i < ehdr->e_shnum; i++)
+    {
+        const char *sh_name = shstr + shdrs[i].sh_name;
+        if (strcmp(sh_name, ".symtab") == 0)
+            shdr_symtab = &shdrs[i];
+        else if (strcmp(sh_name, ".strtab") == 0)
+            shdr_strtab = &shdrs[i];
+    }
+    if (!shdr_symtab)
+        goto error;
+    if (!shdr_strtab)
+        goto error;
+
+    const Elf32_Sym *symtab = (Elf32_Sym *)(elf + shdr_symtab->sh_offset);
+    const char *strtab = (const char *)(elf + shdr_strtab->sh_offset);
+    for (int i = 0; i < shdr_symtab->sh_size / shdr_symtab->sh_entsize; i++)
+    {
+        if (symtab[i].st_name == 0) continue;
+        if (symtab[i].st_shndx > ehdr->e_shnum) continue;
+        if (symtab[i].st_value < 0x2000000 || symtab[i].st_size == 0) continue;
+        struct Symbol symbol =
+        {
+            .name = strtab + symtab[i].st_name,
+            .address = symtab[i].st_value,
+            .size = symtab[i].st_size,
+        };
+        if (symbol_table.symbols_n == symbol_table_symbols_c)
+        {
+            symbol_table_symbols_c *= 2;
+            void *symbols = realloc(symbol_table.symbols, symbol_table_symbols_c * sizeof(*symbol_table.symbols));
+            if (symbols == NULL)
+                goto error;
+            symbol_table.symbols = symbols;
+        }
+        symbol_table.symbols[symbol_table.symbols_n++] = symbol;
+    }
+
+    qsort(symbol_table.symbols, symbol_table.symbols_n, sizeof(*symbol_table.symbols), compare_addresses);
+    return;
+
+error:
+    free(symbol_table.symbols);
+    symbol_table.symbols = NULL;
+    symbol_table.symbols_n = 0;
+}
+
+static const Elf32_Shdr *find_section(const void *elf, const char *name)
+{
+    const Elf32_Ehdr *ehdr = elf;
+    const Elf32_Shdr *shdrs = (const Elf32_Shdr *)(elf + ehdr->e_shoff);
+    if (ehdr->e_shstrndx == SHN_UNDEF)
+        return NULL;
+    const char *shstr = (const char *)(elf + shdrs[ehdr->e_shstrndx].sh_offset);
+    for (int i = 0; i < ehdr->e_shnum; i++)
+    {
+        if (strcmp(shstr + shdrs[i].sh_name, name) == 0)
+            return &shdrs[i];
+    }
+    return NULL;
+}
+
+// Returns a pointer to the 'size' bytes at 'address' in the ROM image,
+// or NULL if they aren't part of any section.
+static const void *lookup_data(const void *elf, uint32_t address, size_t size)
+{
+    const Elf32_Ehdr *ehdr = elf;
+    const Elf32_Shdr *shdrs = (const Elf32_Shdr *)(elf + ehdr->e_shoff);
+    for (int i = 0; i < ehdr->e_shnum; i++)
+    {
+        if (!(shdrs[i].sh_flags & SHF_ALLOC) || shdrs[i].sh_type == SHT_NOBITS)
+            continue;
+        if (shdrs[i].sh_addr <= address && address + size <= shdrs[i].sh_addr + shdrs[i].sh_size)
+            return elf + shdrs[i].sh_offset + (address - shdrs[i].sh_addr);
+    }
+    return NULL;
+}
+
+enum
+{
+    SCRIPT_KIND_OTHER,
+    SCRIPT_KIND_BATTLE,
+    SCRIPT_KIND_EVENT,
+    SCRIPT_KIND_COUNT,
+};
+
+// Scripts are only found by their names, so labels which don't follow
+// the naming conventions are only reported if they're executed.
+static int script_kind(const char *name)
+{
+    if (strncmp(name, "BattleScript_", strlen("BattleScript_")) == 0)
+        return SCRIPT_KIND_BATTLE;
+    else if (strstr(name, "EventScript_"))
+        return SCRIPT_KIND_EVENT;
+    else
+        return SCRIPT_KIND_OTHER;
+}
+
+static int compare_labels_by_address(const void *a, const void *b)
+{
+    const struct Label *la = a, *lb = b;
+    if (la->address != lb->address)
+        return la->address < lb->address ? -1 : 1;
+    return strcmp(la->name, lb->name);
+}
+
+static int compare_labels_by_count(const void *a, const void *b)
+{
+    const struct Label *la = a, *lb = b;
+    if (la->count != lb->count)
+        return la->count > lb->count ? -1 : 1;
+    return compare_labels_by_address(a, b);
+}
+
+// Every named ROM symbol, including the sizeless labels in the .s files
+// which 'build_symbol_table' skips.
+static struct Label *build_label_table(const void *elf, size_t *labels_n)
+{
+    const Elf32_Shdr *shdr_symtab = find_section(elf, ".symtab");
+    const Elf32_Shdr *shdr_strtab = find_section(elf, ".strtab");
+    if (!shdr_symtab || !shdr_strtab)
+        return NULL;
+
+    const Elf32_Sym *symtab = (const Elf32_Sym *)(elf + shdr_symtab->sh_offset);
+    const char *strtab = (const char *)(elf + shdr_strtab->sh_offset);
+    size_t symtab_n = shdr_symtab->sh_size / shdr_symtab->sh_entsize;
+    struct Label *labels = calloc(symtab_n, sizeof(*labels));
+    if (!labels)
+    {
+        perror("calloc labels failed");
+        exit(2);
+    }
+
+    *labels_n = 0;
+    for (size_t i = 0; i < symtab_n; i++)
+    {
+        const char *name = strtab + symtab[i].st_name;
+        if (symtab[i].st_name == 0 || name[0] == '$') continue; // '$' are ARM mapping symbols.
+        if (symtab[i].st_shndx == SHN_UNDEF || symtab[i].st_shndx >= SHN_LORESERVE) continue;
+        if (ELF32_ST_TYPE(symtab[i].st_info) > STT_FUNC) continue;
+        if (symtab[i].st_value < 0x8000000) continue;
+        labels[*labels_n].name = name;
+        labels[*labels_n].address = symtab[i].st_value;
+        if (ELF32_ST_TYPE(symtab[i].st_info) == STT_FUNC)
+            labels[*labels_n].address &= ~1; // Thumb bit.
+        (*labels_n)++;
+    }
+    qsort(labels, *labels_n, sizeof(*labels), compare_labels_by_address);
+    return labels;
+}
+
+struct CommandCount
+{
+    uint32_t cmd_table;
+    uint8_t opcode;
+    uint64_t count;
+};
+
+static int compare_commands_by_count(const void *a, const void *b)
+{
+    const struct CommandCount *ca = a, *cb = b;
+    if (ca->count != cb->count)
+        return ca->count > cb->count ? -1 : 1;
+    if (ca->cmd_table != cb->cmd_table)
+        return ca->cmd_table < cb->cmd_table ? -1 : 1;
+    return ca->opcode - cb->opcode;
+}
+
+// The name of the function which implements a command, e.g.
+// "Cmd_attackcanceler" or "ScrCmd_setflag".
+static const char *command_name(const struct CommandCount *command, char *buffer, size_t size)
+{
+    const uint32_t *function = lookup_data(elf_image, command->cmd_table + 4 * command->opcode, 4);
+    const struct Symbol *symbol = function ? lookup_address(*function & ~1) : NULL;
+    if (symbol)
+        return symbol->name;
+    snprintf(buffer, size, "0x%08x[0x%02x]", command->cmd_table, command->opcode);
+    return buffer;
+}
+
+// Writes a TSV of "command <name> <executions>" lines followed by
+// "label <name> <executions>" lines, both sorted from hottest to
+// coldest. Unexecuted script labels are listed with 0 executions.
+static void write_script_profile(void)
+{
+    size_t labels_n;
+    struct Label *labels = build_label_table(elf_image, &labels_n);
+    if (!labels)
+    {
+        fprintf(stderr, "could not read the symbol table for the script profile\n");
+        return;
+    }
+
+    size_t commands_n = 0, commands_c = 256;
+    struct CommandCount *commands = malloc(commands_c * sizeof(*commands));
+    if (!commands)
+    {
+        perror("malloc commands failed");
+        exit(2);
+    }
+
+    for (size_t i = 0; i < script_counts_c; i++)
+    {
+        const struct ScriptCommandCount *script_count = &script_counts[i];
+        if (script_count->count == 0)
+            continue;
+
+        // Credit every label at the nearest address at or before the
+        // command, since scripts often have several labels.
+        size_t lo = 0, hi = labels_n;
+        while (lo < hi)
+        {
+            size_t mi = lo + (hi - lo) / 2;
+            if (labels[mi].address <= script_count->address)
+                lo = mi + 1;
+            else
+                hi = mi;
+        }
+        if (lo > 0)
+        {
+            uint32_t address = labels[lo - 1].address;
+            for (size_t j = lo; j > 0 && labels[j - 1].address == address; j--)
+                labels[j - 1].count += script_count->count;
+        }
+
+        const uint8_t *opcode = lookup_data(elf_image, script_count->address, 1);
+        if (!opcode)
+            continue;
+        size_t j;
+        for (j = 0; j < commands_n; j++)
+        {
+            if (commands[j].cmd_table == script_count->cmd_table && commands[j].opcode == *opcode)
+                break;
+        }
+        if (j == commands_n)
+        {
+            if (commands_n == commands_c)
+            {
+                commands_c *= 2;
+                commands = realloc(commands, commands_c * sizeof(*commands));
+                if (!commands)
+                {
+                    perror("realloc commands failed");
+                    exit(2);
+                }
+            }
+            commands[commands_n++] = (struct CommandCount) { script_count->cmd_table, *opcode, 0 };
+        }
+        commands[j].count += script_count->count;
+    }
+
+    FILE *f = fopen(profile_path, "w");
+    if (!f)
+    {
+        perror("fopen profile failed");
+        exit(2);
+    }
+
+    char buffer[32];
+    qsort(commands, commands_n, sizeof(*commands), compare_commands_by_count);
+    for (size_t i = 0; i < commands_n; i++)
+        fprintf(f, "command\t%s\t%llu\n", command_name(&commands[i], buffer, sizeof(buffer)), (unsigned long long)commands[i].count);
+
+    int executed[SCRIPT_KIND_COUNT] = {0};
+    int total[SCRIPT_KIND_COUNT] = {0};
+    qsort(labels, labels_n, sizeof(*labels), compare_labels_by_count);
+    for (size_t i = 0; i < labels_n; i++)
+    {
+        int kind = script_kind(labels[i].name);
+        total[kind]++;
+        if (labels[i].count > 0)
+            executed[kind]++;
+        if (labels[i].count > 0 || kind != SCRIPT_KIND_OTHER)
+            fprintf(f, "label\t%s\t%llu\n", labels[i].name, (unsigned long long)labels[i].count);
+    }
+
+    if (fclose(f) == EOF)
+    {
+        perror("fclose profile failed");
+        exit(2);
+    }
+
+    fprintf(stdout, "\n  Script profile (%s):\n", profile_path);
+    fprintf(stdout, "  - Battle script labels executed: %d/%d\n", executed[SCRIPT_KIND_BATTLE], total[SCRIPT_KIND_BATTLE]);
+    fprintf(stdout, "  - Event script labels executed:  %d/%d\n", executed[SCRIPT_KIND_EVENT], total[SCRIPT_KIND_EVENT]);
+    for (size_t i = 0; i < commands_n && i < 5; i++)
+        fprintf(stdout, "  - %s: %llu executions\n", command_name(&commands[i], buffer, sizeof(buffer)), (unsigned long long)commands[i].count);
+
+    free(commands);
+    free(labels);
+}
+
+static void start_runner(struct Runner *runner, const char *mgba_rom_test, const char *objcopy)
+{
+    pid_t parent_pid = getpid();
+    int pipefds[2];
+    if (pipe(pipefds) == -1)
+    {
+        perror("pipe failed");
+        exit(2);
+    }
+    pid_t pid = fork();
+    if (pid == -1) {
+        perror("fork mgba-rom-test failed");
+        exit(2);
+    } else if (pid == 0) {
+        #ifndef __APPLE__
+        if (prctl(PR_SET_PDEATHSIG, SIGTERM) == -1)
+        {
+            perror("prctl failed");
+            _exit(2);
+        }
+        #endif
+        if (getppid() != parent_pid) // Parent died.
+        {
+            _exit(2);
+        }
+        if (close(pipefds[0]) == -1)
+        {
+            perror("close pipefds[0] failed");
+            _exit(2);
+        }
+        if (dup2(pipefds[1], STDOUT_FILENO) == -1)
+        {
+            perror("dup2 stdout failed");
+            _exit(2);
+        }
+        if (close(pipefds[1]) == -1)
+        {
+            perror("close pipefds[1] failed");
+            _exit(2);
+        }
+        char rom_path[FILENAME_MAX];
+        sprintf(rom_path, "/tmp/mgba-rom-test-hydra-%05d", getpid());
+        int tmpfd;
+        if ((tmpfd = open(rom_path, O_WRONLY | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR)) == -1)
+        {
+            perror("open tmpfd failed");
+            _exit(2);
+        }
+        if ((write(tmpfd, runner->elf->image, runner->elf->size)) == -1)
+        {
+            perror("write tmpfd failed");
+            _exit(2);
+        }
+        pid_t patchelfpid = fork();
+        if (patchelfpid == -1)
+        {
+            perror("fork patchelf failed");
+            _exit(2);
+        }
+        else if (patchelfpid == 0)
+        {
+            char n_arg[5], i_arg[5];
+            snprintf(n_arg, sizeof(n_arg), "\\x%02x", runner->elf_n);
+            snprintf(i_arg, sizeof(i_arg), "\\x%02x", runner->elf_i);
+            if (execlp("tools/patchelf/patchelf", "tools/patchelf/patchelf", rom_path, "gTestRunnerN", n_arg, "gTestRunnerI", i_arg, NULL) == -1)
+            {
+                perror("execlp patchelf failed");
+                _exit(2);
+            }
+        }
+        else
+        {
+            int wstatus;
+            if (waitpid(patchelfpid, &wstatus, 0) == -1)
+            {
+                perror("waitpid patchelfpid failed");
+                _exit(2);
+            }
+            if (!WIFEXITED(wstatus) || WEXITSTATUS(wstatus) != 0)
+            {
+                fprintf(stderr, "patchelf exited with an error\n");
+                _exit(2);
+            }
+        }
+#ifdef __APPLE__
+        pid_t objcopypid = fork();
+        if (objcopypid == -1)
+        {
+            perror("fork objcopy failed");
+            _exit(2);
+        }
+        else if (objcopypid == 0)
+        {
+            if (execlp(objcopy, objcopy, "-O", "binary", rom_path, rom_path, NULL) == -1)
+            {
+                perror("execlp objcopy failed");
+                _exit(2);
+            }
+        }
+        else
+        {
+            int wstatus;
+            if (waitpid(objcopypid, &wstatus, 0) == -1)
+            {
+                perror("waitpid objcopy failed");
+                _exit(2);
+            }
+            if (!WIFEXITED(wstatus) || WEXITSTATUS(wstatus) != 0)
+            {
+                fprintf(stderr, "objcopy exited with an error\n");
+                _exit(2);
+            }
+        }
+#endif
+        // stdbuf is required because otherwise mgba never flushes
+        // stdout.
+        if (execlp("stdbuf", "stdbuf", "-oL", mgba_rom_test, "-l15", "-ClogLevel.gba.dma=16", "-Rr0", rom_path, NULL) == -1)
+        {
+            perror("execl stdbuf mgba-rom-test failed");
+            _exit(2);
+        }
+    } else {
+        runner->pid = pid;
+        sprintf(runner->rom_path, "/tmp/mgba-rom-test-hydra-%05d", runner->pid);
+        runner->outfd = pipefds[0];
+        if (close(pipefds[1]) == -1)
+        {
+            perror("close pipefds[1] failed");
             exit(2);
         }
     }
 }
 
-static void unlink_roms(void)
+static void load_elf(struct Elf *elf, const char *path)
 {
-    for (int i = 0; i < nrunners; i++)
+    int elffd;
+    if ((elffd = open(path, O_RDONLY)) == -1)
     {
-        if (runners[i].rom_path[0])
-        {
-            if (unlink(runners[i].rom_path) == -1)
-            {
-                int fd;
-                if ((fd = open(runners[i].rom_path, O_RDONLY)) != -1)
-                    perror("unlink rom_path failed");
-            }
-        }
+        perror("open elffd failed");
+        exit(2);
     }
-}
-
-static void exit2(int _)
-{
-    exit(2);
-}
-
-static int compare_addresses(const void *a, const void *b)
-{
-    const struct Symbol *sa = a, *sb = b;
-    if (sa->address < sb->address)
-        return -1;
-    else if (sa->address == sb->address)
-        return 0;
-    else
-        return 1;
-}
-
-static void build_symbol_table(void *elf)
-{
-    if (memcmp(elf, ELFMAG, 4) != 0)
-        goto error;
-
-    size_t symbol_table_symbols_c = 1024;
-    symbol_table.symbols = malloc(symbol_table_symbols_c * sizeof(*symbol_table.symbols));
-    if (symbol_table.symbols == NULL)
-        goto error;
-
-    const Elf32_Ehdr *ehdr = (Elf32_Ehdr *)elf;
-    const Elf32_Shdr *shdrs = (Elf32_Shdr *)(elf + ehdr->e_shoff);
 
-    if (ehdr->e_shstrndx == SHN_UNDEF)
-        goto error;
-    const Elf32_Shdr *shdr_shstr = &shdrs[ehdr->e_shstrndx];
-    const char *shstr = (const char *)(elf + shdr_shstr->sh_offset);
-    const Elf32_Shdr *shdr_symtab = NULL;
-    const Elf32_Shdr *shdr_strtab = NULL;
-    for (int i = 0; i < ehdr->e_shnum; i++)
+    struct stat elfst;
+    if (fstat(elffd, &elfst) == -1)
     {
-        const char *sh_name = shstr + shdrs[i].sh_name;
-        if (strcmp(sh_name, ".symtab") == 0)
-            shdr_symtab = &shdrs[i];
-        else if (strcmp(sh_name, ".strtab") == 0)
-            shdr_strtab = &shdrs[i];
+        perror("stat elffd failed");
+        exit(2);
     }
-    if (!shdr_symtab)
-        goto error;
-    if (!shdr_strtab)
-        goto error;
 
-    const Elf32_Sym *symtab = (Elf32_Sym *)(elf + shdr_symtab->sh_offset);
-    const char *strtab = (const char *)(elf + shdr_strtab->sh_offset);
-    for (int i = 0; i < shdr_symtab->sh_size / shdr_symtab->sh_entsize; i++)
+    if ((elf->image = mmap(NULL, elfst.st_size, PROT_READ, MAP_PRIVATE, elffd, 0)) == MAP_FAILED)
     {
-        if (symtab[i].st_name == 0) continue;
-        if (symtab[i].st_shndx > ehdr->e_shnum) continue;
-        if (symtab[i].st_value < 0x2000000 || symtab[i].st_size == 0) continue;
-        struct Symbol symbol =
-        {
-            .name = strtab + symtab[i].st_name,
-            .address = symtab[i].st_value,
-            .size = symtab[i].st_size,
-        };
-        if (symbol_table.symbols_n == symbol_table_symbols_c)
-        {
-            symbol_table_symbols_c *= 2;
-            void *symbols = realloc(symbol_table.symbols, symbol_table_symbols_c * sizeof(*symbol_table.symbols));
-            if (symbols == NULL)
-                goto error;
-            symbol_table.symbols = symbols;
-        }
-        symbol_table.symbols[symbol_table.symbols_n++] = symbol;
+        perror("mmap elffd failed");
+        exit(2);
     }
+    elf->path = path;
+    elf->size = elfst.st_size;
 
-    qsort(symbol_table.symbols, symbol_table.symbols_n, sizeof(*symbol_table.symbols), compare_addresses);
-    return;
+    const Elf32_Shdr *shdr_tests = find_section(elf->image, "tests");
+    elf->tests_size = shdr_tests ? shdr_tests->sh_size : 0;
 
-error:
-    free(symbol_table.symbols);
-    symbol_table.symbols = NULL;
-    symbol_table.symbols_n = 0;
+    build_symbol_table(elf->image);
+    elf->symbol_table = symbol_table;
+}
+
+static int compare_elfs_by_tests_size(const void *a, const void *b)
+{
+    const struct Elf *ea = a, *eb = b;
+    if (ea->tests_size != eb->tests_size)
+        return ea->tests_size > eb->tests_size ? -1 : 1;
+    return 0;
 }
 
 int main(int argc, char *argv[])
 {
+    const char *program = argv[0];
+    int opt;
+    while ((opt = getopt(argc, argv, "+b:up:r:J:X:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'b':
+            baselines_path = optarg;
+            break;
+        case 'u':
+            update_baselines = true;
+            break;
+        case 'p':
+            profile_path = optarg;
+            break;
+        case 'J':
+            if ((json_results = fopen(optarg, "w")) == NULL)
+            {
+                perror("fopen json results failed");
+                exit(2);
+            }
+            break;
+        case 'X':
+            junit_path = optarg;
+            break;
+        case 'r':
+            if ((records = fopen(optarg, "w")) == NULL)
+            {
+                perror("fopen records failed");
+                exit(2);
+            }
+            break;
+        default:
+            argc = 0;
+            break;
+        }
+    }
+    argc -= optind - 1;
+    argv += optind - 1;
+
     if (argc < 4)
     {
-        fprintf(stderr, "usage %s mgba-rom-test objcopy rom\n", argv[0]);
+        fprintf(stderr, "usage %s [-b baselines [-u]] [-p profile] [-r records] [-J json-lines] [-X junit-xml] mgba-rom-test objcopy rom...\n", program);
         exit(2);
     }
 
@@ -454,30 +1549,25 @@ int main(int argc, char *argv[])
         setvbuf(stdout, NULL, _IONBF, 0);
     }
 
-    int elffd;
-    if ((elffd = open(argv[3], O_RDONLY)) == -1)
-    {
-        perror("open elffd failed");
-        exit(2);
-    }
-
-    struct stat elfst;
-    if (fstat(elffd, &elfst) == -1)
-    {
-        perror("stat elffd failed");
-        exit(2);
-    }
+    if (baselines_path)
+        load_baselines();
 
-    void *elf;
-    if ((elf = mmap(NULL, elfst.st_size, PROT_READ, MAP_PRIVATE, elffd, 0)) == MAP_FAILED)
+    elfs_n = argc - 3;
+    elfs = calloc(elfs_n, sizeof(*elfs));
+    if (!elfs)
     {
-        perror("mmap elffd failed");
+        perror("calloc elfs failed");
         exit(2);
     }
+    for (size_t i = 0; i < elfs_n; i++)
+        load_elf(&elfs[i], argv[3 + i]);
+    elf_image = elfs[0].image;
 
-    build_symbol_table(elf);
+    // Start the biggest ELFs first, so that the small ones fill in the
+    // gaps at the end.
+    qsort(elfs, elfs_n, sizeof(*elfs), compare_elfs_by_tests_size);
 
-    nrunners = 1;
+    unsigned nprocesses = 1;
     const char *makeflags = getenv("MAKEFLAGS");
     if (makeflags)
     {
@@ -494,14 +1584,29 @@ int main(int argc, char *argv[])
         if (regexec(&preg, makeflags, ARRAY_COUNT(pmatch), pmatch, 0) != REG_NOMATCH)
         {
             if (pmatch[2].rm_so == pmatch[2].rm_eo)
-                nrunners = sysconf(_SC_NPROCESSORS_ONLN);
+                nprocesses = sysconf(_SC_NPROCESSORS_ONLN);
             else
-                sscanf(makeflags + pmatch[2].rm_so, "%d", &nrunners);
+                sscanf(makeflags + pmatch[2].rm_so, "%d", &nprocesses);
         }
         regfree(&preg);
     }
-    if (nrunners > MAX_PROCESSES)
-        nrunners = MAX_PROCESSES;
+    if (nprocesses > MAX_PROCESSES)
+        nprocesses = MAX_PROCESSES;
+
+    // Each ELF gets a share of the processes proportional to its number
+    // of tests. If there are more ELFs than processes, they're queued.
+    size_t tests_size = 0;
+    for (size_t i = 0; i < elfs_n; i++)
+        tests_size += elfs[i].tests_size;
+    for (size_t i = 0; i < elfs_n; i++)
+    {
+        unsigned n = tests_size ? (nprocesses * elfs[i].tests_size + tests_size / 2) / tests_size : 1;
+        if (n < 1)
+            n = 1;
+        if (n > nprocesses)
+            n = nprocesses;
+        nrunners += n;
+    }
     runners_digits = ceil(log10(nrunners));
     runners = calloc(nrunners, sizeof(*runners));
     if (!runners)
@@ -509,15 +1614,28 @@ int main(int argc, char *argv[])
         perror("calloc runners failed");
         exit(2);
     }
+    for (size_t i = 0, r = 0; i < elfs_n; i++)
+    {
+        unsigned n = tests_size ? (nprocesses * elfs[i].tests_size + tests_size / 2) / tests_size : 1;
+        if (n < 1)
+            n = 1;
+        if (n > nprocesses)
+            n = nprocesses;
+        for (unsigned j = 0; j < n; j++, r++)
+        {
+            runners[r].elf = &elfs[i];
+            runners[r].elf_i = j;
+            runners[r].elf_n = n;
+        }
+    }
     for (int i = 0; i < nrunners; i++)
     {
+        runners[i].outfd = -1;
         runners[i].input_buffer_capacity = 4096;
         runners[i].input_buffer = malloc(runners[i].input_buffer_capacity);
         runners[i].output_buffer_capacity = 4096;
         runners[i].output_buffer = malloc(runners[i].output_buffer_capacity);
         strcpy(runners[i].test_name, "WAITING...");
-        if (tty)
-            fprintf(stdout, "[%0*d] %s\n", runners_digits, i, runners[i].test_name);
     }
     fflush(stdout);
     atexit(unlink_roms);
@@ -525,141 +1643,17 @@ int main(int argc, char *argv[])
     signal(SIGTERM, exit2);
 
     // Start test runners.
-    pid_t parent_pid = getpid();
-    for (int i = 0; i < nrunners; i++)
+    unsigned started = 0;
+    while (started < nrunners && started < nprocesses)
     {
-        int pipefds[2];
-        if (pipe(pipefds) == -1)
-        {
-            perror("pipe failed");
-            exit(2);
-        }
-        pid_t pid = fork();
-        if (pid == -1) {
-            perror("fork mgba-rom-test failed");
-            exit(2);
-        } else if (pid == 0) {
-            #ifndef __APPLE__
-            if (prctl(PR_SET_PDEATHSIG, SIGTERM) == -1)
-            {
-                perror("prctl failed");
-                _exit(2);
-            }
-            #endif
-            if (getppid() != parent_pid) // Parent died.
-            {
-                _exit(2);
-            }
-            if (close(pipefds[0]) == -1)
-            {
-                perror("close pipefds[0] failed");
-                _exit(2);
-            }
-            if (dup2(pipefds[1], STDOUT_FILENO) == -1)
-            {
-                perror("dup2 stdout failed");
-                _exit(2);
-            }
-            if (close(pipefds[1]) == -1)
-            {
-                perror("close pipefds[1] failed");
-                _exit(2);
-            }
-            char rom_path[FILENAME_MAX];
-            sprintf(rom_path, "/tmp/mgba-rom-test-hydra-%05d", getpid());
-            int tmpfd;
-            if ((tmpfd = open(rom_path, O_WRONLY | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR)) == -1)
-            {
-                perror("open tmpfd failed");
-                _exit(2);
-            }
-            if ((write(tmpfd, elf, elfst.st_size)) == -1)
-            {
-                perror("write tmpfd failed");
-                _exit(2);
-            }
-            pid_t patchelfpid = fork();
-            if (patchelfpid == -1)
-            {
-                perror("fork patchelf failed");
-                _exit(2);
-            }
-            else if (patchelfpid == 0)
-            {
-                char n_arg[5], i_arg[5];
-                snprintf(n_arg, sizeof(n_arg), "\\x%02x", nrunners);
-                snprintf(i_arg, sizeof(i_arg), "\\x%02x", i);
-                if (execlp("tools/patchelf/patchelf", "tools/patchelf/patchelf", rom_path, "gTestRunnerN", n_arg, "gTestRunnerI", i_arg, NULL) == -1)
-                {
-                    perror("execlp patchelf failed");
-                    _exit(2);
-                }
-            }
-            else
-            {
-                int wstatus;
-                if (waitpid(patchelfpid, &wstatus, 0) == -1)
-                {
-                    perror("waitpid patchelfpid failed");
-                    _exit(2);
-                }
-                if (!WIFEXITED(wstatus) || WEXITSTATUS(wstatus) != 0)
-                {
-                    fprintf(stderr, "patchelf exited with an error\n");
-                    _exit(2);
-                }
-            }
-#ifdef __APPLE__
-            pid_t objcopypid = fork();
-            if (objcopypid == -1)
-            {
-                perror("fork objcopy failed");
-                _exit(2);
-            }
-            else if (objcopypid == 0)
-            {
-                if (execlp(argv[2], argv[2], "-O", "binary", rom_path, rom_path, NULL) == -1)
-                {
-                    perror("execlp objcopy failed");
-                    _exit(2);
-                }
-            }
-            else
-            {
-                int wstatus;
-                if (waitpid(objcopypid, &wstatus, 0) == -1)
-                {
-                    perror("waitpid objcopy failed");
-                    _exit(2);
-                }
-                if (!WIFEXITED(wstatus) || WEXITSTATUS(wstatus) != 0)
-                {
-                    fprintf(stderr, "objcopy exited with an error\n");
-                    _exit(2);
-                }
-            }
-#endif
-            // stdbuf is required because otherwise mgba never flushes
-            // stdout.
-            if (execlp("stdbuf", "stdbuf", "-oL", argv[1], "-l15", "-ClogLevel.gba.dma=16", "-Rr0", rom_path, NULL) == -1)
-            {
-                perror("execl stdbuf mgba-rom-test failed");
-                _exit(2);
-            }
-        } else {
-            runners[i].pid = pid;
-            sprintf(runners[i].rom_path, "/tmp/mgba-rom-test-hydra-%05d", runners[i].pid);
-            runners[i].outfd = pipefds[0];
-            if (close(pipefds[1]) == -1)
-            {
-                perror("close pipefds[1] failed");
-                exit(2);
-            }
-        }
+        start_runner(&runners[started], argv[1], argv[2]);
+        if (tty)
+            fprintf(stdout, "[%0*d] %s\n", runners_digits, started, runners[started].test_name);
+        started++;
     }
 
     // Process test runner output.
-    int openfds = nrunners;
+    int openfds = started;
     struct pollfd *pollfds = calloc(nrunners, sizeof(*pollfds));
     if (!pollfds)
     {
@@ -719,6 +1713,14 @@ int main(int argc, char *argv[])
                 }
                 runners[i].outfd = pollfds[i].fd = -pollfds[i].fd;
                 openfds--;
+
+                if (started < nrunners)
+                {
+                    start_runner(&runners[started], argv[1], argv[2]);
+                    pollfds[started].fd = runners[started].outfd;
+                    openfds++;
+                    started++;
+                }
             }
         }
 
@@ -744,15 +1746,6 @@ int main(int argc, char *argv[])
     int fails = 0;
     int results = 0;
 
-    char failed_TestNames[MAX_SUMMARY_TESTS_TO_LIST * MAX_PROCESSES][MAX_TEST_LIST_BUFFER_LENGTH];
-    char failed_TestFilenameLine[MAX_SUMMARY_TESTS_TO_LIST * MAX_PROCESSES][MAX_TEST_LIST_BUFFER_LENGTH];
-
-    char knownFailingPassed_TestNames[MAX_SUMMARY_TESTS_TO_LIST * MAX_PROCESSES][MAX_TEST_LIST_BUFFER_LENGTH];
-    char knownFailingPassed_FilenameLine[MAX_SUMMARY_TESTS_TO_LIST * MAX_PROCESSES][MAX_TEST_LIST_BUFFER_LENGTH];
-
-    char assumeFailed_TestNames[MAX_SUMMARY_TESTS_TO_LIST * MAX_PROCESSES][MAX_TEST_LIST_BUFFER_LENGTH];
-    char assumeFailed_FilenameLine[MAX_SUMMARY_TESTS_TO_LIST * MAX_PROCESSES][MAX_TEST_LIST_BUFFER_LENGTH];
-
     for (int i = 0; i < nrunners; i++)
     {
         int wstatus;
@@ -767,35 +1760,52 @@ int main(int argc, char *argv[])
             exit_code = WEXITSTATUS(wstatus);
         passes += runners[i].passes;
         knownFails += runners[i].knownFails;
-        for (int j = 0; j < runners[i].knownFailsPassing; j++)
-        {
-            if (j < MAX_SUMMARY_TESTS_TO_LIST)
-            {
-                strcpy(knownFailingPassed_TestNames[knownFailsPassing], runners[i].knownFailingPassed_TestNames[j]);
-                strcpy(knownFailingPassed_FilenameLine[knownFailsPassing], runners[i].knownFailingPassed_FilenameLine[j]);
-            }
-            knownFailsPassing++;
-        }
+        knownFailsPassing += runners[i].knownFailsPassing;
         todos += runners[i].todos;
-        for (int j = 0; j < runners[i].assumptionFails; j++)
-        {
-            if (j < MAX_SUMMARY_TESTS_TO_LIST)
-            {
-                strcpy(assumeFailed_TestNames[assumptionFails], runners[i].assumeFailed_TestNames[j]);
-                strcpy(assumeFailed_FilenameLine[assumptionFails], runners[i].assumeFailed_FilenameLine[j]);
-            }
-            assumptionFails++;
-        }
-        for (int j = 0; j < runners[i].fails; j++)
+        assumptionFails += runners[i].assumptionFails;
+        fails += runners[i].fails;
+        results += runners[i].results;
+    }
+
+    if (simulations_n > 0)
+    {
+        fprintf(stdout, "\n  Simulations:\n");
+        for (size_t i = 0; i < simulations_n; i++)
         {
-            if (j < MAX_SUMMARY_TESTS_TO_LIST)
-            {
-                strcpy(failed_TestNames[fails], runners[i].failed_TestNames[j]);
-                strcpy(failed_TestFilenameLine[fails], runners[i].failed_TestFilenameLine[j]);
-            }
-            fails++;
+            const struct Simulation *simulation = &simulations[i];
+            int draws = simulation->games - simulation->wins - simulation->losses;
+            fprintf(stdout, "  - %s: %d games, %.1f%% won, %.1f%% lost, %.1f%% drawn\n",
+                    simulation->name,
+                    simulation->games,
+                    100.0 * simulation->wins / simulation->games,
+                    100.0 * simulation->losses / simulation->games,
+                    100.0 * draws / simulation->games);
         }
-        results += runners[i].results;
+    }
+
+    int regressions = 0, missingBaselines = 0;
+    qsort(benchmarks, benchmarks_n, sizeof(*benchmarks), compare_benchmarks_by_name);
+    if (baselines_path && update_baselines)
+        write_baselines();
+    else if (baselines_path)
+        regressions = print_benchmarks(&missingBaselines);
+
+    if (profile_path)
+        write_script_profile();
+
+    if (json_results && fclose(json_results) == EOF)
+    {
+        perror("fclose json results failed");
+        exit(2);
+    }
+
+    if (junit_path)
+        write_junit_results();
+
+    if (records && fclose(records) == EOF)
+    {
+        perror("fclose records failed");
+        exit(2);
     }
 
     if (results == 0)
@@ -807,49 +1817,19 @@ int main(int argc, char *argv[])
         if (fails > 0)
         {
             fprintf(stdout, "\n  \e[31mFAILED\e[0m tests:\n");
-            for (int i = 0; i < fails; i++)
-            {
-                if (i >= MAX_SUMMARY_TESTS_TO_LIST)
-                {
-                    fprintf(stdout, "  - \e[31mand %d more...\e[0m\n", fails - MAX_SUMMARY_TESTS_TO_LIST);
-                    break;
-                }
-                fprintf(stdout, "  - \e[31m");
-                fprint_buffer(stdout, failed_TestFilenameLine[i], strlen(failed_TestFilenameLine[i]));
-                fprintf(stdout, "\e[0m - %s.\n", failed_TestNames[i]);
-            }
+            print_results(RESULT_FAIL, "\e[31m");
         }
 
         if (assumptionFails > 0)
         {
             fprintf(stdout, "\n  Tests with \e[33mASSUMPTIONS_FAILED\e[0m:\n");
-            for (int i = 0; i < assumptionFails; i++)
-            {
-                if (i >= MAX_SUMMARY_TESTS_TO_LIST)
-                {
-                    fprintf(stdout, "  - \e[33mand %d more...\e[0m\n", assumptionFails - MAX_SUMMARY_TESTS_TO_LIST);
-                    break;
-                }
-                fprintf(stdout, "  - \e[33m");
-                fprint_buffer(stdout, assumeFailed_FilenameLine[i], strlen(assumeFailed_FilenameLine[i]));
-                fprintf(stdout, "\e[0m - %s.\n", assumeFailed_TestNames[i]);
-            }
+            print_results(RESULT_ASSUMPTION_FAIL, "\e[33m");
         }
 
         if (knownFailsPassing > 0)
         {
             fprintf(stdout, "\n  \e[33mKNOWN_FAILING\e[0m tests \e[32mPASSING\e[0m:\n");
-            for (int i = 0; i < knownFailsPassing; i++)
-            {
-                if (i >= MAX_SUMMARY_TESTS_TO_LIST)
-                {
-                    fprintf(stdout, "  - \e[32mand %d more...\e[0m\n", knownFailsPassing - MAX_SUMMARY_TESTS_TO_LIST);
-                    break;
-                }
-                fprintf(stdout, "  - \e[32m");
-                fprint_buffer(stdout, knownFailingPassed_FilenameLine[i], strlen(knownFailingPassed_FilenameLine[i]));
-                fprintf(stdout, "\e[0m - %s.\n", knownFailingPassed_TestNames[i]);
-            }
+            print_results(RESULT_KNOWN_FAIL_PASSING, "\e[32m");
         }
 
         fprintf(stdout, "\n");
@@ -863,11 +1843,18 @@ int main(int argc, char *argv[])
             fprintf(stdout, "- Tests \e[33mTO_DO\e[0m:           %d\n", todos);
         if (knownFailsPassing > 0)
             fprintf(stdout, "- \e[32mKNOWN_FAILING_PASSING\e[0m: %d   \e[33mPlease remove KNOWN_FAILING if these tests intentionally PASS\e[0m\n", knownFailsPassing);
+        if (regressions > 0)
+            fprintf(stdout, "- Benchmarks \e[31mREGRESSED\e[0m:   %d    Run 'make bench BENCH_UPDATE=1' if they are expected.\n", regressions);
+        if (missingBaselines > 0)
+            fprintf(stdout, "- Benchmarks \e[31mNO_BASELINE\e[0m: %d    Run 'make bench BENCH_UPDATE=1' to record them.\n", missingBaselines);
         fprintf(stdout, "- Tests \e[32mPASSED\e[0m:          %d\n", passes);
         fprintf(stdout, "- Tests \e[34mTOTAL\e[0m:           %d\n", results);
     }
     fprintf(stdout, "\n");
 
+    if ((regressions > 0 || missingBaselines > 0) && exit_code == 0)
+        exit_code = 1;
+
     fflush(stdout);
     return exit_code;
 }
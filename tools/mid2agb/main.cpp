@@ -25,22 +25,27 @@
 #include <cassert>
 #include <string>
 #include <set>
+#include <vector>
+#include <sstream>
+#include <fstream>
+#include <thread>
+#include <mutex>
 #include "main.h"
 #include "error.h"
 #include "midi.h"
 #include "agb.h"
 
-FILE* g_inputFile = nullptr;
-FILE* g_outputFile = nullptr;
+thread_local FILE* g_inputFile = nullptr;
+thread_local FILE* g_outputFile = nullptr;
 
-std::string g_asmLabel;
-int g_masterVolume = 127;
-int g_voiceGroup = 0;
-int g_priority = 0;
-int g_reverb = -1;
-int g_clocksPerBeat = 1;
-bool g_exactGateTime = false;
-bool g_compressionEnabled = true;
+thread_local std::string g_asmLabel;
+thread_local int g_masterVolume = 127;
+thread_local int g_voiceGroup = 0;
+thread_local int g_priority = 0;
+thread_local int g_reverb = -1;
+thread_local int g_clocksPerBeat = 1;
+thread_local bool g_exactGateTime = false;
+thread_local bool g_compressionEnabled = true;
 
 [[noreturn]] static void PrintUsage()
 {
@@ -58,6 +63,12 @@ bool g_compressionEnabled = true;
         "            -X  48 clocks/beat (default:24 clocks/beat)\n"
         "            -E  exact gate-time\n"
         "            -N  no compression\n"
+        "\n"
+        "Usage: MID2AGB --batch config_file [-j jobs] [input_file ...]\n"
+        "\n"
+        "   config_file  lines of \"input_file: [options]\", e.g. midi.cfg\n"
+        "    input_file  only convert these entries (default:all)\n"
+        "            -j  number of conversions to run in parallel\n"
     );
     std::exit(1);
 }
@@ -127,11 +138,8 @@ static const char *GetArgument(int argc, char **argv, int& index)
     }
 }
 
-int main(int argc, char** argv)
+static void ParseArguments(int argc, char** argv, std::string& inputFilename, std::string& outputFilename)
 {
-    std::string inputFilename;
-    std::string outputFilename;
-
     for (int i = 1; i < argc; i++)
     {
         const char *option = argv[i];
@@ -195,10 +203,26 @@ int main(int argc, char** argv)
                 PrintUsage();
         }
     }
+}
 
-    if (inputFilename.empty())
-        PrintUsage();
+static std::string ReadFile(std::FILE *file)
+{
+    std::string contents;
+    char buffer[4096];
+    std::size_t count;
 
+    while ((count = std::fread(buffer, 1, sizeof(buffer), file)) > 0)
+        contents.append(buffer, count);
+
+    return contents;
+}
+
+// Converts a MIDI file with the options in the globals. If onlyIfChanged is
+// set, the output is written to a temporary file first, and the real output
+// file is only touched if the contents differ. This keeps make from
+// reassembling songs which haven't changed.
+static void Convert(std::string inputFilename, std::string outputFilename, bool onlyIfChanged)
+{
     if (GetExtension(inputFilename) != "mid")
         RaiseError("input filename extension is not \"mid\"");
 
@@ -216,7 +240,10 @@ int main(int argc, char** argv)
     if (g_inputFile == nullptr)
         RaiseError("failed to open \"%s\" for reading", inputFilename.c_str());
 
-    g_outputFile = std::fopen(outputFilename.c_str(), "w");
+    if (onlyIfChanged)
+        g_outputFile = std::tmpfile();
+    else
+        g_outputFile = std::fopen(outputFilename.c_str(), "w");
 
     if (g_outputFile == nullptr)
         RaiseError("failed to open \"%s\" for writing", outputFilename.c_str());
@@ -227,7 +254,156 @@ int main(int argc, char** argv)
     PrintAgbFooter();
 
     std::fclose(g_inputFile);
-    std::fclose(g_outputFile);
+
+    if (onlyIfChanged)
+    {
+        std::rewind(g_outputFile);
+        std::string contents = ReadFile(g_outputFile);
+        std::fclose(g_outputFile);
+
+        std::FILE *oldFile = std::fopen(outputFilename.c_str(), "rb");
+        if (oldFile != nullptr)
+        {
+            bool same = ReadFile(oldFile) == contents;
+            std::fclose(oldFile);
+            if (same)
+                return;
+        }
+
+        std::FILE *file = std::fopen(outputFilename.c_str(), "wb");
+        if (file == nullptr || std::fwrite(contents.data(), 1, contents.size(), file) != contents.size())
+            RaiseError("failed to write \"%s\"", outputFilename.c_str());
+        std::fclose(file);
+    }
+    else
+    {
+        std::fclose(g_outputFile);
+    }
+}
+
+struct BatchJob
+{
+    std::string inputFilename;
+    std::vector<std::string> options;
+};
+
+static void RunBatchJob(const BatchJob& job)
+{
+    std::vector<char *> argv;
+    argv.push_back(nullptr);
+    for (const std::string& option : job.options)
+        argv.push_back(const_cast<char *>(option.c_str()));
+
+    std::string inputFilename;
+    std::string outputFilename;
+    ParseArguments(argv.size(), argv.data(), inputFilename, outputFilename);
+    if (!inputFilename.empty())
+        RaiseError("unexpected filename \"%s\" in options for \"%s\"", inputFilename.c_str(), job.inputFilename.c_str());
+
+    Convert(job.inputFilename, "", true);
+}
+
+// Converts every song in a config file (e.g. midi.cfg), with each line
+// being "input_file: [options]" and input_file relative to the config
+// file. Songs run on separate threads, each of which starts with a fresh
+// copy of the thread_local conversion state.
+static void RunBatch(const std::string& configFilename, int jobCount, const std::set<std::string>& filter)
+{
+    std::ifstream config(configFilename);
+
+    if (!config)
+        RaiseError("failed to open \"%s\" for reading", configFilename.c_str());
+
+    std::string directory;
+    std::size_t slashPos = configFilename.find_last_of("/\\");
+    if (slashPos != std::string::npos)
+        directory = configFilename.substr(0, slashPos + 1);
+
+    std::vector<BatchJob> jobs;
+    std::string line;
+    while (std::getline(config, line))
+    {
+        std::size_t colonPos = line.find(':');
+        if (colonPos == std::string::npos)
+            continue;
+
+        BatchJob job;
+        // Like audio_rules.mk, accept entries without the .mid extension.
+        job.inputFilename = directory + StripExtension(line.substr(0, colonPos)) + ".mid";
+        if (!filter.empty() && filter.count(job.inputFilename) == 0)
+            continue;
+
+        std::istringstream options(line.substr(colonPos + 1));
+        std::string option;
+        while (options >> option)
+            job.options.push_back(option);
+        jobs.push_back(job);
+    }
+
+    if (jobCount < 1)
+        jobCount = 1;
+
+    std::mutex mutex;
+    std::size_t nextJob = 0;
+    std::vector<std::thread> workers;
+    for (int i = 0; i < jobCount; i++)
+    {
+        workers.emplace_back([&]()
+        {
+            for (;;)
+            {
+                std::size_t jobIndex;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    jobIndex = nextJob++;
+                }
+                if (jobIndex >= jobs.size())
+                    break;
+                std::thread(RunBatchJob, std::cref(jobs[jobIndex])).join();
+            }
+        });
+    }
+
+    for (std::thread& worker : workers)
+        worker.join();
+}
+
+int main(int argc, char** argv)
+{
+    if (argc >= 2 && std::strcmp(argv[1], "--batch") == 0)
+    {
+        if (argc < 3)
+            PrintUsage();
+
+        int jobCount = std::thread::hardware_concurrency();
+        std::set<std::string> filter;
+        for (int i = 3; i < argc; i++)
+        {
+            if (std::strcmp(argv[i], "-j") == 0)
+            {
+                if (i + 1 >= argc)
+                    PrintUsage();
+                jobCount = std::stoi(argv[++i]);
+            }
+            else
+            {
+                filter.insert(argv[i]);
+            }
+        }
+
+        RunBatch(argv[2], jobCount, filter);
+        return 0;
+    }
+
+    std::string inputFilename;
+    std::string outputFilename;
+
+    ParseArguments(argc, argv, inputFilename, outputFilename);
+
+    if (inputFilename.empty())
+        PrintUsage();
+
+    Convert(inputFilename, outputFilename, false);
 
     return 0;
 }
@@ -38,21 +38,21 @@ enum class MidiEventCategory
     Invalid,
 };
 
-MidiFormat g_midiFormat;
-std::int_fast32_t g_midiTrackCount;
-std::int16_t g_midiTimeDiv;
-
-int g_midiChan;
-std::int32_t g_initialWait;
-
-static long s_trackDataStart;
-static std::vector<Event> s_seqEvents;
-static std::vector<Event> s_trackEvents;
-static std::int32_t s_absoluteTime;
-static int s_blockCount = 0;
-static int s_minNote;
-static int s_maxNote;
-static int s_runningStatus;
+thread_local MidiFormat g_midiFormat;
+thread_local std::int_fast32_t g_midiTrackCount;
+thread_local std::int16_t g_midiTimeDiv;
+
+thread_local int g_midiChan;
+thread_local std::int32_t g_initialWait;
+
+static thread_local long s_trackDataStart;
+static thread_local std::vector<Event> s_seqEvents;
+static thread_local std::vector<Event> s_trackEvents;
+static thread_local std::int32_t s_absoluteTime;
+static thread_local int s_blockCount = 0;
+static thread_local int s_minNote;
+static thread_local int s_maxNote;
+static thread_local int s_runningStatus;
 
 void Seek(long offset)
 {
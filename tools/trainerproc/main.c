@@ -2000,6 +2000,184 @@ static void fprint_trainers(const char *output_path, FILE *f, struct Parsed *par
     }
 }
 
+/* Reads the rest of 'f' into a malloc'd buffer. */
+static unsigned char *read_all(FILE *f, int *buffer_n)
+{
+    unsigned char *buffer = NULL;
+    int buffer_c = 4096;
+    *buffer_n = 0;
+    for (;;)
+    {
+        unsigned char *new_buffer;
+        if (!(new_buffer = realloc(buffer, buffer_c)))
+        {
+            fprintf(stderr, "could not allocate %d bytes\n", buffer_c);
+            free(buffer);
+            return NULL;
+        }
+        buffer = new_buffer;
+
+        *buffer_n += fread(&buffer[*buffer_n], 1, buffer_c - *buffer_n, f);
+        if (*buffer_n < buffer_c)
+            return buffer;
+
+        buffer_c += *buffer_n / 2; // 1.5x growth rate.
+    }
+}
+
+/* The output for one trainer, from its '[DIFFICULTY_...][TRAINER_...] ='
+ * line up to the next trainer. */
+struct OutputTrainer
+{
+    struct String key;
+    struct String body;
+};
+
+static int split_output_trainers(struct String output, struct OutputTrainer **trainers)
+{
+    static const char prefix[] = "    [DIFFICULTY_";
+    int trainers_n = 0, trainers_c = 0;
+    int i = 0;
+    *trainers = NULL;
+    while (i < output.string_n)
+    {
+        const unsigned char *line = &output.string[i];
+        const unsigned char *eol = memchr(line, '\n', output.string_n - i);
+        int line_n = eol ? eol - line : output.string_n - i;
+
+        if (line_n >= (int)sizeof(prefix) - 1 && memcmp(line, prefix, sizeof(prefix) - 1) == 0)
+        {
+            if (trainers_n == trainers_c)
+            {
+                struct OutputTrainer *new_trainers;
+                trainers_c = trainers_c ? 2 * trainers_c : 256;
+                if (!(new_trainers = realloc(*trainers, trainers_c * sizeof(**trainers))))
+                {
+                    fprintf(stderr, "could not allocate %zu bytes\n", trainers_c * sizeof(**trainers));
+                    free(*trainers);
+                    *trainers = NULL;
+                    return -1;
+                }
+                *trainers = new_trainers;
+            }
+            (*trainers)[trainers_n].key = (struct String) { line, line_n };
+            (*trainers)[trainers_n].body = (struct String) { line, output.string_n - i };
+            if (trainers_n > 0)
+                (*trainers)[trainers_n - 1].body.string_n = line - (*trainers)[trainers_n - 1].body.string;
+            trainers_n++;
+        }
+
+        i += line_n + 1;
+    }
+    return trainers_n;
+}
+
+/* Compares two trainers' output, ignoring '#line' markers so that
+ * trainers which only moved within the source compare equal. */
+static bool output_trainer_equal(struct String a, struct String b)
+{
+    int i = 0, j = 0;
+    for (;;)
+    {
+        while (i < a.string_n && a.string_n - i >= 5 && memcmp(&a.string[i], "#line", 5) == 0)
+        {
+            const unsigned char *eol = memchr(&a.string[i], '\n', a.string_n - i);
+            i = eol ? eol - a.string + 1 : a.string_n;
+        }
+        while (j < b.string_n && b.string_n - j >= 5 && memcmp(&b.string[j], "#line", 5) == 0)
+        {
+            const unsigned char *eol = memchr(&b.string[j], '\n', b.string_n - j);
+            j = eol ? eol - b.string + 1 : b.string_n;
+        }
+        if (i == a.string_n || j == b.string_n)
+            return i == a.string_n && j == b.string_n;
+
+        const unsigned char *a_eol = memchr(&a.string[i], '\n', a.string_n - i);
+        const unsigned char *b_eol = memchr(&b.string[j], '\n', b.string_n - j);
+        int a_line_n = a_eol ? a_eol - &a.string[i] + 1 : a.string_n - i;
+        int b_line_n = b_eol ? b_eol - &b.string[j] + 1 : b.string_n - j;
+        if (a_line_n != b_line_n || memcmp(&a.string[i], &b.string[j], a_line_n) != 0)
+            return false;
+        i += a_line_n;
+        j += b_line_n;
+    }
+}
+
+static bool string_equal(struct String a, struct String b)
+{
+    return a.string_n == b.string_n && memcmp(a.string, b.string, a.string_n) == 0;
+}
+
+static int find_output_trainer(const struct OutputTrainer *trainers, int trainers_n, struct String key, int hint)
+{
+    // Trainers are usually in the same order, so check 'hint' first.
+    if (hint < trainers_n && string_equal(trainers[hint].key, key))
+        return hint;
+    for (int i = 0; i < trainers_n; i++)
+    {
+        if (string_equal(trainers[i].key, key))
+            return i;
+    }
+    return -1;
+}
+
+#define MAX_REPORTED_TRAINERS 10
+
+static void report_trainer(const char *output_path, const char *change, struct String key, int *reported_n)
+{
+    if (*reported_n < MAX_REPORTED_TRAINERS)
+    {
+        // Strip the indentation and trailing ' ='.
+        while (key.string_n > 0 && key.string[0] == ' ')
+        {
+            key.string++;
+            key.string_n--;
+        }
+        if (ends_with(key, " ="))
+            key.string_n -= 2;
+        printf("%s: %s ", output_path, change);
+        fprint_string(stdout, key);
+        printf("\n");
+    }
+    (*reported_n)++;
+}
+
+/* Prints which trainers were added, removed or changed between the old
+ * and new output. */
+static void report_trainer_changes(const char *output_path, struct String old_output, struct String new_output)
+{
+    struct OutputTrainer *old_trainers, *new_trainers;
+    int old_trainers_n, new_trainers_n;
+    int reported_n = 0;
+
+    if ((old_trainers_n = split_output_trainers(old_output, &old_trainers)) < 0)
+        return;
+    if ((new_trainers_n = split_output_trainers(new_output, &new_trainers)) < 0)
+    {
+        free(old_trainers);
+        return;
+    }
+
+    for (int i = 0; i < new_trainers_n; i++)
+    {
+        int j = find_output_trainer(old_trainers, old_trainers_n, new_trainers[i].key, i);
+        if (j < 0)
+            report_trainer(output_path, "added", new_trainers[i].key, &reported_n);
+        else if (!output_trainer_equal(old_trainers[j].body, new_trainers[i].body))
+            report_trainer(output_path, "changed", new_trainers[i].key, &reported_n);
+    }
+    for (int i = 0; i < old_trainers_n; i++)
+    {
+        if (find_output_trainer(new_trainers, new_trainers_n, old_trainers[i].key, i) < 0)
+            report_trainer(output_path, "removed", old_trainers[i].key, &reported_n);
+    }
+    if (reported_n > MAX_REPORTED_TRAINERS)
+        printf("%s: ... and %d more\n", output_path, reported_n - MAX_REPORTED_TRAINERS);
+
+    free(old_trainers);
+    free(new_trainers);
+}
+
 static void usage(FILE *file, char *argv0)
 {
     fprintf(file, "Usage: %s -o <output> <source>\n", argv0);
@@ -2011,6 +2189,10 @@ int main(int argc, char *argv[])
     FILE *source_file = NULL;
     FILE *output_file = NULL;
     unsigned char *source_buffer = NULL;
+    unsigned char *output_buffer = NULL;
+    int output_buffer_n = 0;
+    unsigned char *old_output_buffer = NULL;
+    int old_output_buffer_n = 0;
     struct Parsed parsed = {
         .default_ivs = { 31, 31, 31, 31, 31, 31 },
         .default_level = 100,
@@ -2057,22 +2239,8 @@ int main(int argc, char *argv[])
         source_file = stdin;
         source_path = "<stdin>";
 
-        int source_buffer_c = 4096;
-        source_buffer_n = 0;
-        for (;;)
-        {
-            if (!(source_buffer = realloc(source_buffer, source_buffer_c)))
-            {
-                fprintf(stderr, "could not allocate %d bytes\n", source_buffer_c);
-                goto exit;
-            }
-
-            source_buffer_n += fread(&source_buffer[source_buffer_n], 1, source_buffer_c - source_buffer_n, source_file);
-            if (source_buffer_n < source_buffer_c)
-                break;
-
-            source_buffer_c += source_buffer_n / 2; // 1.5x growth rate.
-        }
+        if (!(source_buffer = read_all(source_file, &source_buffer_n)))
+            goto exit;
     }
     else
     {
@@ -2124,24 +2292,62 @@ int main(int argc, char *argv[])
 
     if (strcmp(output_path, "-") == 0)
     {
-        source_file = stdout;
-        output_path = "<stdout>";
+        fprint_trainers("<stdout>", stdout, &parsed);
+        status = 0;
+        goto exit;
     }
-    else
+
+    /* Format into memory and only replace the output if it changed, so
+     * that make doesn't rebuild what includes it when, e.g., only a
+     * comment in the source was edited. */
+    if (!(output_file = tmpfile()))
+    {
+        fprintf(stderr, "could not create a temporary file\n");
+        goto exit;
+    }
+    fprint_trainers(output_path, output_file, &parsed);
+    rewind(output_file);
+    if (!(output_buffer = read_all(output_file, &output_buffer_n)))
+        goto exit;
+    fclose(output_file);
+    output_file = NULL;
+
+    if ((output_file = fopen(output_path, "rb")))
     {
-        output_file = fopen(output_path, "w");
-        if (output_file == NULL)
+        if (!(old_output_buffer = read_all(output_file, &old_output_buffer_n)))
+            goto exit;
+        fclose(output_file);
+        output_file = NULL;
+
+        if (old_output_buffer_n == output_buffer_n && memcmp(old_output_buffer, output_buffer, output_buffer_n) == 0)
         {
-            fprintf(stderr, "could not open '%s' for writing\n", output_path);
+            status = 0;
             goto exit;
         }
+
+        report_trainer_changes(output_path,
+            (struct String) { old_output_buffer, old_output_buffer_n },
+            (struct String) { output_buffer, output_buffer_n });
+    }
+
+    output_file = fopen(output_path, "wb");
+    if (output_file == NULL)
+    {
+        fprintf(stderr, "could not open '%s' for writing\n", output_path);
+        goto exit;
+    }
+    if (fwrite(output_buffer, 1, output_buffer_n, output_file) < output_buffer_n)
+    {
+        fprintf(stderr, "could not write '%s'\n", output_path);
+        goto exit;
     }
-    fprint_trainers(output_path, output_file, &parsed);
 
     status = 0;
 
 exit:
     if (output_file) fclose(output_file);
+    if (output_buffer) free(output_buffer);
+    if (old_output_buffer) free(old_output_buffer);
     if (parsed.trainers) free(parsed.trainers);
     if (source_buffer) free(source_buffer);
     if (source_file) fclose(source_file);